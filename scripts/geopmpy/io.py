@@ -42,6 +42,7 @@ import glob
 import json
 import sys
 import subprocess
+import multiprocessing
 from natsort import natsorted
 from geopmpy import __version__
 
@@ -54,6 +55,105 @@ except subprocess.CalledProcessError:
 pandas.set_option('display.width', int(os.environ['COLUMNS']))
 pandas.set_option('display.max_colwidth', 80)
 
+_INDEX_VERSION = 1
+
+
+def _index_path(path):
+    """Returns the path of the sidecar index for a report or trace file.
+
+    The index is a hidden file in the same directory so that it is not
+    matched by the report and trace globs.
+    """
+    dir_name, base_name = os.path.split(path)
+    return os.path.join(dir_name, '.{}.geopmidx'.format(base_name))
+
+
+def _load_index(path):
+    """Loads the sidecar index for path.
+
+    Returns:
+        dict: The index, or None if there is no index or it does not
+              match the current size and modification time of path.
+    """
+    try:
+        with open(_index_path(path)) as fid:
+            index = json.load(fid)
+        stat = os.stat(path)
+        if (index.get('index_version') != _INDEX_VERSION or
+            index.get('size') != stat.st_size or
+            index.get('mtime') != stat.st_mtime):
+            return None
+        return index
+    except (IOError, OSError, ValueError):
+        return None
+
+
+def _save_index(path, index):
+    """Writes the sidecar index for path.
+
+    Failure to write the index (e.g. a read only directory) is not an
+    error; the file will be indexed again the next time it is opened.
+    """
+    stat = os.stat(path)
+    index['index_version'] = _INDEX_VERSION
+    index['size'] = stat.st_size
+    index['mtime'] = stat.st_mtime
+    try:
+        with open(_index_path(path), 'w') as fid:
+            json.dump(index, fid)
+    except (IOError, OSError):
+        pass
+
+
+def _parse_report_file(report_path):
+    """Parses every report in a combined report file.
+
+    Used as a pool worker by AppOutput.  The Report objects only hold
+    the totals and the per region values, so they are cheap to return
+    from a worker process.
+
+    Returns:
+        list: The Report objects for the nodes in the file.
+    """
+    Report.reset_vars()
+    result = []
+    for entry in Report.index(report_path)['reports']:
+        rr = Report(report_path, entry['offset'])
+        if rr.get_node_name() is not None:
+            result.append(rr)
+    Report.reset_vars()
+    return result
+
+
+def _index_trace_file(trace_path):
+    """Creates the sidecar index of a trace file if it is missing or
+    out of date.
+
+    Returns:
+        str: The trace path.
+    """
+    if _load_index(trace_path) is None:
+        _save_index(trace_path, Trace._build_index(trace_path))
+    return trace_path
+
+
+def _map_files(func, args, num_proc):
+    """Applies func to each element of args, in parallel when num_proc
+    is greater than one.  The order of the results matches args.  If
+    num_proc is None one process per CPU is used.
+    """
+    if num_proc is None:
+        num_proc = multiprocessing.cpu_count()
+    num_proc = min(num_proc, len(args))
+    if num_proc <= 1:
+        return [func(aa) for aa in args]
+    pool = multiprocessing.Pool(num_proc)
+    try:
+        return pool.map(func, args)
+    finally:
+        pool.close()
+        pool.join()
+
 
 class AppOutput(object):
     """The container class for all report and trace related data.
@@ -65,7 +165,10 @@ class AppOutput(object):
     their data will be parsed into objects for easy data access.
     Additionally a Pandas DataFrame is constructed containing all of
     the report data and a separate DataFrame containing all of the
-    trace data.  These DataFrames are indexed based on the version of
+    trace data.  Report files are parsed when the object is created.
+    Trace files are only indexed; the trace data is loaded when it is
+    first accessed through get_trace() or get_trace_df().  These
+    DataFrames are indexed based on the version of
     GEOPM found in the files, the profile name, global power budget
     set for the run, the tree and leaf deciders used, and the number
     of times that particular configuration has been seen by the parser
@@ -76,17 +179,25 @@ class AppOutput(object):
         trace_glob: The string pattern to use to search for trace files.
         dir_name: The directory path to use when searching for files.
         verbose: A bool to control whether verbose output is printed to stdout.
+        num_proc: The number of processes used to parse reports and
+                  index traces in parallel; one process per CPU is
+                  used by default.
+        trace_columns: Optional list of trace columns to load; all
+                       columns are loaded by default.
 
     """
-    def __init__(self, reports=None, traces=None, dir_name='.', verbose=False):
+    def __init__(self, reports=None, traces=None, dir_name='.', verbose=False,
+                 num_proc=None, trace_columns=None):
         self._reports = {}
         self._reports_df = pandas.DataFrame()
         self._traces = {}
         self._traces_df = pandas.DataFrame()
+        self._trace_list = []
         self._all_paths = []
         self._reports_df_list = []
         self._traces_df_list = []
         self._index_tracker = IndexTracker()
+        self._verbose = verbose
 
         if reports:
             if type(reports) is str:
@@ -102,39 +213,15 @@ class AppOutput(object):
             self._all_paths.extend(report_paths)
 
             # Create a dict of <NODE_NAME> : <REPORT_OBJ>; Create DF
-            files = 0
-            filesize = 0
-            for rp in report_paths: # Get report count for verbose progress
-                filesize += os.stat(rp).st_size
-                with open(rp, 'r') as fid:
-                    for line in fid:
-                        if re.findall(r'Host:', line):
-                            files += 1
-
-            filesize = '{}KiB'.format(filesize/1024)
-            fileno = 1
-            for rp in report_paths:
-                # Parse the first report
-                rr_size = os.stat(rp).st_size
-                rr = Report(rp)
-                if verbose:
-                    sys.stdout.write('\rParsing report {} of {} ({}).. '.format(fileno, files, filesize))
-                    sys.stdout.flush()
-                fileno += 1
-                self.add_report_df(rr)
-                self._reports[rr.get_node_name()] = rr
-
-                # Parse the remaining reports in this file
-                while (rr.get_last_offset() != rr_size):
-                    rr = Report(rp, rr.get_last_offset())
-                    if rr.get_node_name() is not None:
-                        self.add_report_df(rr)
-                        self._reports[rr.get_node_name()] = rr
-                        if verbose:
-                            sys.stdout.write('\rParsing report {} of {} ({})... '.format(fileno, files, filesize))
-                            sys.stdout.flush()
-                        fileno += 1
-                Report.reset_vars() # If we've reached the end of a report, reset the static vars
+            if verbose:
+                files = sum([len(Report.index(rp)['reports']) for rp in report_paths])
+                filesize = sum([os.stat(rp).st_size for rp in report_paths])
+                sys.stdout.write('Parsing {} reports ({}KiB)... '.format(files, filesize / 1024))
+                sys.stdout.flush()
+            for file_reports in _map_files(_parse_report_file, report_paths, num_proc):
+                for rr in file_reports:
+                    self.add_report_df(rr)
+                    self._reports[rr.get_node_name()] = rr
             if verbose:
                 sys.stdout.write('Done.\n')
                 sys.stdout.flush()
@@ -160,29 +247,17 @@ class AppOutput(object):
                 raise TypeError('AppOutput: traces must be a list of paths or a glob pattern')
 
             self._all_paths.extend(trace_paths)
-            self._index_tracker.reset()
-            # Create a dict of <NODE_NAME> : <TRACE_DATAFRAME>
-            fileno = 1
-            filesize = 0
-            for tp in trace_paths: # Get size of all trace files
-                filesize += os.stat(tp).st_size
-            filesize = '{}MiB'.format(filesize/1024/1024)
-            for tp in trace_paths:
-                if verbose:
-                    sys.stdout.write('\rParsing trace file {} of {} ({})... '.format(fileno, len(trace_paths), filesize))
-                    sys.stdout.flush()
-                fileno += 1
-                tt = Trace(tp)
-                self._traces[tt.get_node_name()] = tt.get_df() # Basic dict assumes one node per trace
-                self.add_trace_df(tt) # Handles multiple traces per node
-            if verbose:
-                sys.stdout.write('Done.\n')
-                sys.stdout.flush()
+            # Create a dict of <NODE_NAME> : <TRACE_OBJ>
             if verbose:
-                sys.stdout.write('Creating combined traces DF... ')
+                filesize = sum([os.stat(tp).st_size for tp in trace_paths])
+                sys.stdout.write('Indexing {} trace files ({}MiB)... '.format(len(trace_paths), filesize / 1024 / 1024))
                 sys.stdout.flush()
-            self._traces_df = pandas.concat(self._traces_df_list)
-            self._traces_df = self._traces_df.sort_index(ascending=True)
+            for tp in _map_files(_index_trace_file, trace_paths, num_proc):
+                tt = Trace(tp, trace_columns)
+                self._traces[tt.get_node_name()] = tt # Basic dict assumes one node per trace
+                self._trace_list.append(tt) # Handles multiple traces per node
+            # The combined DataFrame is created by get_trace_df()
+            self._traces_df = None
             if verbose:
                 sys.stdout.write('Done.\n')
                 sys.stdout.flush()
@@ -190,10 +265,11 @@ class AppOutput(object):
     def remove_files(self):
         """Deletes all files currently tracked by this object."""
         for ff in self._all_paths:
-            try:
-                os.remove(ff)
-            except OSError:
-                pass
+            for path in (ff, _index_path(ff)):
+                try:
+                    os.remove(path)
+                except OSError:
+                    pass
 
     def add_report_df(self, rr):
         """Adds a report DataFrame to the tracking list.
@@ -207,7 +283,7 @@ class AppOutput(object):
 
         """
         # Build and index the DF
-        rdf = pandas.DataFrame(rr).T.drop('name', 1)
+        rdf = pandas.DataFrame(rr).T.drop('name', axis=1)
         numeric_cols = ['count', 'energy', 'frequency', 'mpi_runtime', 'runtime']
         rdf[numeric_cols] = rdf[numeric_cols].apply(pandas.to_numeric)
 
@@ -319,10 +395,26 @@ class AppOutput(object):
         trace.  For more information on this index, see the
         IndexTracker docstring.
 
+        The trace files are loaded the first time this method is
+        called.
+
         Returns:
             pandas.DataFrame: Contains all parsed data.
 
         """
+        if self._traces_df is None:
+            if self._verbose:
+                sys.stdout.write('Creating combined traces DF... ')
+                sys.stdout.flush()
+            self._index_tracker.reset()
+            for tt in self._trace_list:
+                self.add_trace_df(tt)
+            self._traces_df = pandas.concat(self._traces_df_list)
+            self._traces_df = self._traces_df.sort_index(ascending=True)
+            self._traces_df_list = []
+            if self._verbose:
+                sys.stdout.write('Done.\n')
+                sys.stdout.flush()
         return self._traces_df
 
 
@@ -482,6 +574,75 @@ class Report(dict):
         (Report._version, Report._name, Report._mode, Report._tree_decider, Report._leaf_decider, Report._power_budget) = \
             None, None, None, None, None, None
 
+    @staticmethod
+    def index(report_path):
+        """Returns the sidecar index of a combined report file.
+
+        The index lists the reports contained in the file with the
+        node name, the byte offset range and the region names of each
+        report.  It is created by a quick scan of the file the first
+        time the file is opened and reused while the file is
+        unchanged.
+
+        Args:
+            report_path: A string path to a report file.
+
+        Returns:
+            dict: The index; index['reports'] is a list of dicts with
+                  the keys 'node_name', 'offset', 'end' and 'regions'.
+        """
+        index = _load_index(report_path)
+        if index is not None:
+            return index
+        reports = []
+        entry = {'node_name': None, 'offset': 0, 'regions': []}
+        found_totals = False
+        offset = 0
+        with open(report_path, 'rb') as fid:
+            for line in fid:
+                offset += len(line)
+                if line.startswith(b'Host: '):
+                    entry['node_name'] = line[6:].decode().strip()
+                elif line.startswith(b'Region '):
+                    entry['regions'].append(line.split()[1].decode())
+                elif line.startswith(b'Application Totals:'):
+                    found_totals = True
+                elif found_totals and b'ignore-time' in line:
+                    # End of report blob
+                    entry['end'] = offset
+                    reports.append(entry)
+                    entry = {'node_name': None, 'offset': offset, 'regions': []}
+                    found_totals = False
+        if entry['offset'] != offset:
+            entry['end'] = offset
+            reports.append(entry)
+        index = {'reports': reports}
+        _save_index(report_path, index)
+        return index
+
+    @staticmethod
+    def load_node(report_path, node_name):
+        """Parses only the report for one node from a combined report file.
+
+        Args:
+            report_path: A string path to a report file.
+            node_name: The host name of the report to parse.
+
+        Returns:
+            Report: The report for node_name.
+        """
+        reports = Report.index(report_path)['reports']
+        offsets = [entry['offset'] for entry in reports if entry['node_name'] == node_name]
+        if not offsets:
+            raise KeyError('Report: node {} not found in {}'.format(node_name, report_path))
+        Report.reset_vars()
+        if offsets[0] != 0:
+            # The first report carries the header shared by all reports in the file
+            Report(report_path, 0)
+        result = Report(report_path, offsets[0])
+        Report.reset_vars()
+        return result
+
     def __init__(self, report_path, offset=0):
         super(Report, self).__init__()
         self._path = report_path
@@ -752,6 +913,13 @@ class Trace(object):
     file.  The header identifies the uniquely-identifying configuration
     for this file which is used for later indexing purposes.
 
+    The first time a trace file is opened a sidecar index (see
+    _index_path()) is written next to it recording the header, the
+    column names and the byte offset of the data.  When the index is
+    current, opening the trace only reads the index; the trace data
+    itself is not parsed until the DataFrame is first accessed, and
+    then only the requested columns are loaded.
+
     Even though __getattr__() and __getitem__() allow this object to
     effectively be treated like a DataFrame, you must use get_df() if
     you're building a list of DataFrames to pass to pandas.concat().
@@ -760,23 +928,34 @@ class Trace(object):
 
     Attributes:
         trace_path: The path to the trace file to parse.
+        columns: Optional list of column names to load; all columns
+                 are loaded by default.
 
     """
-    def __init__(self, trace_path):
+    _BINARY_MAGIC = b'GEOPMTRB'
+
+    def __init__(self, trace_path, columns=None):
         self._path = trace_path
-        self._df = pandas.read_csv(trace_path, sep='|', comment='#', dtype={'region_id': str})  # region_id must be a string because pandas can't handle 64-bit integers
-        self._df.columns = list(map(str.strip, self._df[:0]))  # Strip whitespace from column names
-        self._df['region_id'] = self._df['region_id'].astype(str).map(str.strip)  # Strip whitespace from region ID's
+        self._columns = columns
+        self._df = None
         self._version = None
         self._profile_name = None
         self._power_budget = None
         self._tree_decider = None
         self._leaf_decider = None
         self._node_name = None
-        self._parse_header(trace_path)
+        self._index = _load_index(trace_path)
+        if self._index is None:
+            self._index = self._build_index(trace_path)
+            _save_index(trace_path, self._index)
+        self._parse_header_lines(self._index['header'])
+        if columns is not None:
+            missing = [cc for cc in columns if cc not in self._index['columns']]
+            if missing:
+                raise KeyError('Trace: columns not in trace file {}: {}'.format(trace_path, missing))
 
     def __repr__(self):
-        return self._df.__repr__()
+        return self.get_df().__repr__()
 
     def __str__(self):
         return self.__repr__()
@@ -792,7 +971,10 @@ class Trace(object):
         Index([u'region_id', u'seconds', u'pkg_energy-0', u'dram_energy-0',...
 
         """
-        return getattr(self._df, attr)
+        if attr.startswith('__') or attr in ('_df', '_index', '_columns', '_path'):
+            # Not yet initialized, e.g. while unpickling
+            raise AttributeError(attr)
+        return getattr(self.get_df(), attr)
 
     def __getitem__(self, key):
         """Pass through item requests to the underlying DataFrame.
@@ -807,23 +989,114 @@ class Trace(object):
         3  2305843009213693952  0.677869  106013.998108   25631.105882
         4  2305843009213693952  0.682849  106014.621704   25631.136186
         """
-        return self._df.__getitem__(key)
+        return self.get_df().__getitem__(key)
+
+    @staticmethod
+    def _build_index(trace_path):
+        """Scans the trace file to create the sidecar index.
 
-    def _parse_header(self, trace_path):
-        """Parses the configuration header out of the top of the trace file.
+        For text traces the header lines, column names and the byte
+        offset of the first data line are recorded.  For binary traces
+        the column types and the offset and row count of each block
+        are recorded as well; the block data is not read.
 
         Args:
-            trace_path: The path to the trace file to parse.t
+            trace_path: The path to the trace file to index.
+
+        Returns:
+            dict: The index of the trace file.
         """
-        done = False
-        out = []
-        with open(trace_path) as fid:
-            while not done:
-                ll = fid.readline()
-                if ll.startswith('#'):
-                    out.append(ll[1:])
-                else:
-                    done = True
+        with open(trace_path, 'rb') as fid:
+            is_binary = fid.read(len(Trace._BINARY_MAGIC)) == Trace._BINARY_MAGIC
+            fid.seek(0)
+            if not is_binary:
+                header = []
+                line = fid.readline()
+                while line.startswith(b'#'):
+                    header.append(line.decode())
+                    line = fid.readline()
+                columns = [cc.strip() for cc in line.decode().split('|')]
+                return {'format': 'text',
+                        'header': header,
+                        'columns': columns,
+                        'data_offset': fid.tell()}
+
+            def read_u32(count):
+                return [int(vv) for vv in numpy.frombuffer(fid.read(4 * count), dtype='<u4')]
+
+            fid.seek(len(Trace._BINARY_MAGIC))
+            version, num_col, header_len = read_u32(3)
+            if version != 1:
+                raise SyntaxError('Unsupported binary trace version: {}'.format(version))
+            header = fid.read(header_len).decode().splitlines()
+            columns = []
+            column_types = []
+            for col in range(num_col):
+                col_type, name_len = read_u32(2)
+                column_types.append('<u8' if col_type == 1 else '<f8')
+                columns.append(fid.read(name_len).decode())
+            offset = 8 * ((fid.tell() + 7) // 8)
+            file_size = os.fstat(fid.fileno()).st_size
+            blocks = []
+            while offset < file_size:
+                fid.seek(offset)
+                num_row, encoding = read_u32(2)
+                if encoding != 0:
+                    raise SyntaxError('Unsupported binary trace block encoding: {}'.format(encoding))
+                blocks.append((offset + 8, num_row))
+                offset += 8 + 8 * num_row * num_col
+        return {'format': 'binary',
+                'header': header,
+                'columns': columns,
+                'column_types': column_types,
+                'blocks': blocks}
+
+    def _load_text(self):
+        """Loads the requested columns of a text trace."""
+        columns = self._index['columns']
+        with open(self._path, 'r') as fid:
+            fid.seek(self._index['data_offset'])
+            df = pandas.read_csv(fid, sep='|', header=None, names=columns, usecols=self._columns,
+                                 comment='#', dtype={'region_id': str})  # region_id must be a string because pandas can't handle 64-bit integers
+        if 'region_id' in df:
+            df['region_id'] = df['region_id'].astype(str).map(str.strip)  # Strip whitespace from region ID's
+        if self._columns is not None:
+            df = df[self._columns]
+        return df
+
+    def _load_binary(self):
+        """Loads the requested columns of a binary trace.
+
+        The file is memory mapped and each column is gathered from the
+        blocks without reading the other columns.  The hex encoded
+        columns (e.g. region_id) are formatted as strings so that the
+        resulting DataFrame matches the one created from a text trace.
+        """
+        columns = self._index['columns']
+        column_types = self._index['column_types']
+        blocks = self._index['blocks']
+        names = self._columns if self._columns is not None else columns
+        result = pandas.DataFrame()
+        if blocks:
+            data = numpy.memmap(self._path, dtype='u1', mode='r')
+        for name in names:
+            col = columns.index(name)
+            ctype = column_types[col]
+            values = numpy.concatenate(
+                [numpy.frombuffer(data, dtype=ctype, count=num_row, offset=offset + 8 * num_row * col)
+                 for offset, num_row in blocks]) if blocks else numpy.array([], dtype=ctype)
+            if ctype == '<u8':
+                values = ['0x{:016x}'.format(int(vv)) for vv in values]
+            result[name] = values
+        return result
+
+    def _parse_header_lines(self, header):
+        """Parses the configuration header from the lines beginning with '#'.
+
+        Args:
+            header: The list of header lines including the leading '#'.
+        """
+        out = [ll[1:] for ll in header]
         out.insert(0, '{')
         out.append('}')
         json_str = ''.join(out)
@@ -839,8 +1112,16 @@ class Trace(object):
             raise SyntaxError('Trace file header could not be parsed!')
 
     def get_df(self):
+        if self._df is None:
+            if self._index['format'] == 'binary':
+                self._df = self._load_binary()
+            else:
+                self._df = self._load_text()
         return self._df
 
+    def get_columns(self):
+        return list(self._index['columns'])
+
     def get_version(self):
         return self._version
 
@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions
+#  are met:
+#
+#      * Redistributions of source code must retain the above copyright
+#        notice, this list of conditions and the following disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above copyright
+#        notice, this list of conditions and the following disclaimer in
+#        the documentation and/or other materials provided with the
+#        distribution.
+#
+#      * Neither the name of Intel Corporation nor the names of its
+#        contributors may be used to endorse or promote products derived
+#        from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+#  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+#  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+#  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+#  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+#  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+#  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+#  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+import os
+import shutil
+import tempfile
+import unittest
+try:
+    import pandas
+    import geopm_context
+    import geopmpy.io
+    g_skip_io_test = False
+    g_skip_io_ex = None
+except ImportError as ex:
+    g_skip_io_test = True
+    g_skip_io_ex = "Warning, geopmpy.io requires the pandas module to be installed: {}".format(ex)
+
+version = '0.3.0'
+profile_name = 'test_io'
+power_budget = 400
+tree_decider = 'static'
+leaf_decider = 'simple'
+node_names = ['mynode0', 'mynode1']
+num_trace_row = 4
+
+
+def write_report(path, node_name):
+    with open(path, 'w') as fid:
+        fid.write('##### geopm {} #####\n'.format(version))
+        fid.write('Profile: {}\n'.format(profile_name))
+        fid.write('Policy Mode: dynamic\n')
+        fid.write('Tree Decider: {}\n'.format(tree_decider))
+        fid.write('Leaf Decider: {}\n'.format(leaf_decider))
+        fid.write('Power Budget: {}\n'.format(power_budget))
+        fid.write('\nHost: {}\n'.format(node_name))
+        fid.write('Region dgemm (0x00000002a7faa555):\n')
+        fid.write('        runtime (sec): 10.0\n')
+        fid.write('        energy (joules): 2000.0\n')
+        fid.write('        frequency (%): 90.0\n')
+        fid.write('        mpi-runtime (sec): 1.0\n')
+        fid.write('        count: 1\n')
+        fid.write('Application Totals:\n')
+        fid.write('        runtime (sec): 12.0\n')
+        fid.write('        energy (joules): 2400.0\n')
+        fid.write('        mpi-runtime (sec): 1.0\n')
+        fid.write('        ignore-time (sec): 0.0\n')
+
+
+def write_trace(path, node_name):
+    with open(path, 'w') as fid:
+        fid.write('#"geopm_version": "{}",\n'.format(version))
+        fid.write('#"profile_name": "{}",\n'.format(profile_name))
+        fid.write('#"power_budget": {},\n'.format(power_budget))
+        fid.write('#"tree_decider": "{}",\n'.format(tree_decider))
+        fid.write('#"leaf_decider": "{}",\n'.format(leaf_decider))
+        fid.write('#"node_name": "{}"\n'.format(node_name))
+        fid.write('region_id|seconds|pkg_energy-0\n')
+        for row in range(num_trace_row):
+            fid.write('0x0000000000000000|{}|{}\n'.format(0.005 * row, 100.0 + row))
+
+
+class TestIO(unittest.TestCase):
+    def setUp(self):
+        if g_skip_io_test:
+            self.skipTest(g_skip_io_ex)
+        self._dir_name = tempfile.mkdtemp()
+        self._report_paths = []
+        self._trace_paths = []
+        for node_name in node_names:
+            report_path = '{}.report'.format(node_name)
+            write_report(os.path.join(self._dir_name, report_path), node_name)
+            self._report_paths.append(report_path)
+            trace_path = '{}.trace'.format(node_name)
+            write_trace(os.path.join(self._dir_name, trace_path), node_name)
+            self._trace_paths.append(trace_path)
+        self._get_df = geopmpy.io.Trace.get_df
+        self._get_df_count = 0
+
+        def get_df_counted(trace):
+            self._get_df_count += 1
+            return self._get_df(trace)
+
+        geopmpy.io.Trace.get_df = get_df_counted
+
+    def tearDown(self):
+        if not g_skip_io_test:
+            geopmpy.io.Trace.get_df = self._get_df
+            shutil.rmtree(self._dir_name)
+
+    def test_report_parallel(self):
+        app_output = geopmpy.io.AppOutput(reports=self._report_paths, dir_name=self._dir_name, num_proc=2)
+        self.assertEqual(sorted(node_names), sorted(app_output.get_node_names()))
+        report_df = app_output.get_report_df()
+        self.assertEqual(len(node_names), len(report_df))
+        self.assertEqual(sorted(node_names), sorted(report_df.index.get_level_values('node_name')))
+        self.assertTrue((report_df['runtime'] == 10.0).all())
+
+    def test_trace_lazy(self):
+        app_output = geopmpy.io.AppOutput(traces=self._trace_paths, dir_name=self._dir_name, num_proc=2)
+        self.assertEqual(0, self._get_df_count)
+        trace = app_output.get_trace(node_names[0])
+        self.assertEqual(node_names[0], trace.get_node_name())
+        self.assertEqual(0, self._get_df_count)
+        trace_df = app_output.get_trace_df()
+        self.assertLess(0, self._get_df_count)
+        self.assertEqual(len(node_names) * num_trace_row, len(trace_df))
+        self.assertEqual(sorted(node_names), sorted(set(trace_df.index.get_level_values('node_name'))))
+        self.assertTrue(trace_df is app_output.get_trace_df())
+        self.assertEqual(num_trace_row, len(trace['seconds']))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -71,6 +71,16 @@ namespace geopm
     const std::string IAgent::m_sample_prefix = "SAMPLE_";
     const std::string IAgent::m_policy_prefix = "POLICY_";
 
+    std::vector<std::function<double(const std::vector<double> &)> > IAgent::aggregate_function(void) const
+    {
+        return {};
+    }
+
+    std::vector<double> IAgent::sample_tolerance(void) const
+    {
+        return {};
+    }
+
     int IAgent::num_sample(const std::map<std::string, std::string> &dictionary)
     {
         auto it = dictionary.find(m_num_sample_string);
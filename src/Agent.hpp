@@ -36,9 +36,11 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <functional>
 
 #include "PluginFactory.hpp"
 #include "PlatformIO.hpp"
+#include "MessageMatrix.hpp"
 
 namespace geopm
 {
@@ -54,18 +56,40 @@ namespace geopm
             /// @brief Called by Kontroller to split policy for
             ///        children at next level down the tree.
             /// @param [in] in_policy Policy values from the parent.
-            /// @param [out] out_policy Vector of policies to be sent
-            ///        to each child.
+            /// @param [out] out_policy Matrix of policies to be sent
+            ///        with one row for each child.
             virtual bool descend(const std::vector<double> &in_policy,
-                                 std::vector<std::vector<double> >&out_policy) = 0;
+                                 MessageMatrix &out_policy) = 0;
             /// @brief Aggregate signals from children for the next
             ///        level up the tree.
-            /// @param [in] in_signal Vector of signal vectors, one
+            /// @param [in] in_signal Matrix of signals with one row
             ///        from each child.
             /// @param [out] out_signal Aggregated signal values to be
             ///        sent up to the parent.
-            virtual bool ascend(const std::vector<std::vector<double> > &in_signal,
+            virtual bool ascend(const MessageMatrix &in_signal,
                                 std::vector<double> &out_signal) = 0;
+            /// @brief Aggregation function applied across children
+            ///        for each value of the sample vector, e.g. one
+            ///        of the IPlatformIO::agg_*() functions.  If the
+            ///        returned vector is sized to the number of
+            ///        samples, the Kontroller has the ITreeComm reduce
+            ///        the samples from the children and ascend() is
+            ///        not called.  The default returns an empty
+            ///        vector so that ascend() is always used.
+            virtual std::vector<std::function<double(const std::vector<double> &)> > aggregate_function(void) const;
+            /// @brief Absolute tolerance for each value of the sample
+            ///        vector received by the agent at its level.  If
+            ///        the returned vector is sized to the number of
+            ///        samples, the ITreeComm only sends a sample
+            ///        value up within the level when it changes by
+            ///        more than its tolerance, and a parent only
+            ///        receives samples when a child sent a change.
+            ///        The tolerance may depend on the level passed
+            ///        to init(), but it must be the same for every
+            ///        agent at a level.  The
+            ///        default returns an empty vector so that every
+            ///        sample is sent.
+            virtual std::vector<double> sample_tolerance(void) const;
             /// @brief Adjust the platform settings based the policy
             ///        from above.
             /// @param [in] policy Settings for each control in the
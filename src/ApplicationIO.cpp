@@ -74,6 +74,11 @@ namespace geopm
         , m_rank_per_node(-1)
         , m_epoch_regulator(std::move(epoch_regulator))
         , m_start_energy(NAN)
+        , m_energy_pkg_idx(-1)
+        , m_energy_dram_idx(-1)
+        , m_time_idx(-1)
+        , m_time_ref_signal(NAN)
+        , m_is_batch_ready(false)
     {
     }
 
@@ -90,13 +95,22 @@ namespace geopm
             m_prof_sample.resize(m_sampler->capacity());
             std::vector<int> cpu_rank = m_sampler->cpu_rank();
             if (m_profile_io_sample == nullptr) {
-                m_epoch_regulator = geopm::make_unique<EpochRuntimeRegulator>(m_rank_per_node, m_platform_io, m_platform_topo);
+                m_epoch_regulator = geopm::make_unique<EpochRuntimeRegulator>(m_rank_per_node);
                 m_epoch_regulator->init_unmarked_region();
                 m_profile_io_sample = std::make_shared<KprofileIOSample>(cpu_rank, *m_epoch_regulator);
                 platform_io().register_iogroup(geopm::make_unique<KprofileIOGroup>(m_profile_io_sample, *m_epoch_regulator));
             }
             m_is_connected = true;
 
+            // Energy is sampled from the batch read by the controller
+            m_energy_pkg_idx = m_platform_io.push_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_BOARD, 0);
+            if (m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY)) {
+                m_energy_dram_idx = m_platform_io.push_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD, 0);
+            }
+            m_time_idx = m_platform_io.push_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
+            // Reference to convert the TIME signal into a geopm_time_s
+            geopm_time(&m_time_ref);
+            m_time_ref_signal = m_platform_io.read_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
             m_start_energy = current_energy();
         }
     }
@@ -106,6 +120,11 @@ namespace geopm
         m_sampler->controller_ready();
     }
 
+    size_t ApplicationIO::total_profile_drop(void) const
+    {
+        return m_sampler->num_drop();
+    }
+
     bool ApplicationIO::do_shutdown(void) const
     {
 #ifdef GEOPM_DEBUG
@@ -247,11 +266,20 @@ namespace geopm
         double energy = 0.0;
         int num_package = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE);
         for (int pkg = 0; pkg < num_package; ++pkg) {
-            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, pkg);
         }
         int num_dram = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY);
         for (int dram = 0; dram < num_dram; ++dram) {
-            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, 0);
+            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, dram);
+        }
+        return energy;
+    }
+
+    double ApplicationIO::batch_energy(void) const
+    {
+        double energy = m_platform_io.sample(m_energy_pkg_idx);
+        if (m_energy_dram_idx != -1) {
+            energy += m_platform_io.sample(m_energy_dram_idx);
         }
         return energy;
     }
@@ -265,7 +293,7 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        return current_energy() - m_start_energy;
+        return batch_energy() - m_start_energy;
     }
 
     double ApplicationIO::total_app_mpi_runtime(void) const
@@ -319,6 +347,14 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
+        // The controller calls update() before each read_batch(), so
+        // every call after the first follows a completed batch.
+        if (m_is_batch_ready) {
+            struct geopm_time_s batch_time;
+            geopm_time_add(&m_time_ref, m_platform_io.sample(m_time_idx) - m_time_ref_signal, &batch_time);
+            m_epoch_regulator->record_energy(batch_energy(), batch_time);
+        }
+        m_is_batch_ready = true;
         size_t length = 0;
         m_sampler->sample(m_prof_sample, length, comm);
         m_profile_io_sample->update(m_prof_sample.cbegin(), m_prof_sample.cbegin() + length);
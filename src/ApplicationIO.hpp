@@ -112,6 +112,10 @@ namespace geopm
             /// @brief Signal to the application that the Controller
             ///        is ready to begin receiving samples.
             virtual void controller_ready(void) = 0;
+            /// @brief Returns the number of profile messages from
+            ///        the application that were discarded because
+            ///        the controller did not read them in time.
+            virtual size_t total_profile_drop(void) const = 0;
     };
 
     class IProfileSampler;
@@ -150,10 +154,14 @@ namespace geopm
             std::list<geopm_region_info_s> region_info(void) const override;
             void clear_region_info(void) override;
             void controller_ready(void) override;
+            size_t total_profile_drop(void) const override;
         private:
             static constexpr size_t M_SHMEM_REGION_SIZE = 12288;
 
+            /// @brief Read the package and DRAM energy directly.
             double current_energy(void) const;
+            /// @brief Package and DRAM energy from the last batch.
+            double batch_energy(void) const;
 
             std::unique_ptr<IProfileSampler> m_sampler;
             std::shared_ptr<IKprofileIOSample> m_profile_io_sample;
@@ -169,6 +177,12 @@ namespace geopm
             int m_rank_per_node;
             std::unique_ptr<IEpochRuntimeRegulator> m_epoch_regulator;
             double m_start_energy;
+            int m_energy_pkg_idx;
+            int m_energy_dram_idx;
+            int m_time_idx;
+            struct geopm_time_s m_time_ref;
+            double m_time_ref_signal;
+            bool m_is_batch_ready;
     };
 }
 
@@ -42,8 +42,14 @@
 namespace geopm
 {
     BalancingAgent::BalancingAgent()
-        : m_platform_io(platform_io())
-        , m_platform_topo(platform_topo())
+        : BalancingAgent(platform_io(), platform_topo())
+    {
+
+    }
+
+    BalancingAgent::BalancingAgent(IPlatformIO &plat_io, IPlatformTopo &topo)
+        : m_platform_io(plat_io)
+        , m_platform_topo(topo)
         , m_convergence_guard_band(0.5)
         , m_level(-1)
         , m_num_children(0)
@@ -89,7 +95,7 @@ namespace geopm
         m_agg_fn_epoch_runtime = m_platform_io.agg_function("EPOCH_RUNTIME");
     }
 
-    bool BalancingAgent::descend(const std::vector<double> &in_message, std::vector<std::vector<double> >&out_message)
+    bool BalancingAgent::descend(const std::vector<double> &in_message, MessageMatrix &out_message)
     {
         if (m_is_converged) {
             double power_budget_in = 100;//m_platform_io.sample(m_power_budget_in_idx);
@@ -101,7 +107,7 @@ namespace geopm
         return false;
     }
 
-    bool BalancingAgent::ascend(const std::vector<std::vector<double> > &in_message, std::vector<double> &out_message)
+    bool BalancingAgent::ascend(const MessageMatrix &in_message, std::vector<double> &out_message)
     {
         // Read samples from children or from the platform.
         for (int child_idx = 0; child_idx < m_num_children; ++child_idx) {
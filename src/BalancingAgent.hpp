@@ -58,11 +58,12 @@ namespace geopm
             };
 
             BalancingAgent();
+            BalancingAgent(IPlatformIO &plat_io, IPlatformTopo &topo);
             virtual ~BalancingAgent();
             void init(int level) override;
             bool descend(const std::vector<double> &in_policy,
-                         std::vector<std::vector<double> >&out_policy) override;
-            bool ascend(const std::vector<std::vector<double> > &in_sample,
+                         MessageMatrix &out_policy) override;
+            bool ascend(const MessageMatrix &in_sample,
                         std::vector<double> &out_sample) override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
@@ -34,7 +34,11 @@
 #define CIRCULARBUFFER_HPP_INCLUDE
 
 #include <stdlib.h>
+#include <string.h>
+
+#include <array>
 #include <vector>
+#include <type_traits>
 
 #include "Exception.hpp"
 
@@ -222,6 +226,198 @@ namespace geopm
         }
         return m_buffer[(m_head + index) % m_max_size];
     }
+
+    /// @brief Circular buffer with a capacity fixed at compile time.
+    ///
+    /// Intended for trivially copyable telemetry on the control
+    /// path: the storage is held in the object, so there are no
+    /// allocations, and the methods are not virtual.  The capacity
+    /// must be a power of two so that indices wrap with a mask.
+    /// Once at capacity, any new insertions cause the oldest entry
+    /// to be dropped.
+    template <class type, size_t max_size>
+    class FixedCircularBuffer
+    {
+        static_assert(max_size && !(max_size & (max_size - 1)),
+                      "FixedCircularBuffer: capacity must be a power of two");
+        static_assert(std::is_trivially_copyable<type>::value,
+                      "FixedCircularBuffer: type must be trivially copyable");
+        public:
+            FixedCircularBuffer();
+            ~FixedCircularBuffer() = default;
+            /// @brief Clears all entries from the buffer.
+            void clear(void);
+            /// @brief Number of entries in the buffer.
+            int size(void) const;
+            /// @brief Maximum number of entries in the buffer.
+            int capacity(void) const;
+            /// @brief Insert a value, dropping the oldest entry if
+            ///        the buffer is full.
+            void insert(const type &value);
+            /// @brief Entry at the index counting from the oldest.
+            ///
+            /// The index must be less than size(); it is only
+            /// checked when built with --enable-debug.
+            const type &value(unsigned int index) const;
+        private:
+            std::array<type, max_size> m_buffer;
+            unsigned int m_head;
+            unsigned int m_count;
+    };
+
+    /// @brief Circular buffer of fixed length rows with a capacity
+    ///        fixed at compile time.
+    ///
+    /// The row length is set at construction and every row is held
+    /// in one contiguous block that is allocated once, e.g. a
+    /// history of domain by signal matrices.  The capacity must be a
+    /// power of two.  Once at capacity, any new insertions cause the
+    /// oldest row to be dropped.
+    template <class type, size_t max_size>
+    class FixedCircularBuffer2D
+    {
+        static_assert(max_size && !(max_size & (max_size - 1)),
+                      "FixedCircularBuffer2D: capacity must be a power of two");
+        static_assert(std::is_trivially_copyable<type>::value,
+                      "FixedCircularBuffer2D: type must be trivially copyable");
+        public:
+            /// @param [in] row_size Number of values in each row.
+            FixedCircularBuffer2D(size_t row_size);
+            ~FixedCircularBuffer2D() = default;
+            /// @brief Clears all rows from the buffer.
+            void clear(void);
+            /// @brief Number of rows in the buffer.
+            int size(void) const;
+            /// @brief Maximum number of rows in the buffer.
+            int capacity(void) const;
+            /// @brief Number of values in each row.
+            size_t row_size(void) const;
+            /// @brief Copy row_size() values into a new row,
+            ///        dropping the oldest row if the buffer is full.
+            void insert(const type *row);
+            /// @brief Row at the index counting from the oldest.
+            ///
+            /// The index must be less than size(); it is only
+            /// checked when built with --enable-debug.
+            ///
+            /// @return Pointer to the row_size() values of the row.
+            const type *value(unsigned int index) const;
+        private:
+            size_t m_row_size;
+            std::vector<type> m_buffer;
+            unsigned int m_head;
+            unsigned int m_count;
+    };
+
+    template <class type, size_t max_size>
+    FixedCircularBuffer<type, max_size>::FixedCircularBuffer()
+        : m_buffer()
+        , m_head(0)
+        , m_count(0)
+    {
+
+    }
+
+    template <class type, size_t max_size>
+    void FixedCircularBuffer<type, max_size>::clear(void)
+    {
+        m_head = 0;
+        m_count = 0;
+    }
+
+    template <class type, size_t max_size>
+    int FixedCircularBuffer<type, max_size>::size(void) const
+    {
+        return m_count;
+    }
+
+    template <class type, size_t max_size>
+    int FixedCircularBuffer<type, max_size>::capacity(void) const
+    {
+        return max_size;
+    }
+
+    template <class type, size_t max_size>
+    void FixedCircularBuffer<type, max_size>::insert(const type &value)
+    {
+        m_buffer[(m_head + m_count) & (max_size - 1)] = value;
+        if (m_count < max_size) {
+            ++m_count;
+        }
+        else {
+            m_head = (m_head + 1) & (max_size - 1);
+        }
+    }
+
+    template <class type, size_t max_size>
+    const type &FixedCircularBuffer<type, max_size>::value(unsigned int index) const
+    {
+#ifdef GEOPM_DEBUG
+        if (index >= m_count) {
+            throw Exception("FixedCircularBuffer::value(): index is out of bounds", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+#endif
+        return m_buffer[(m_head + index) & (max_size - 1)];
+    }
+
+    template <class type, size_t max_size>
+    FixedCircularBuffer2D<type, max_size>::FixedCircularBuffer2D(size_t row_size)
+        : m_row_size(row_size)
+        , m_buffer(max_size * row_size)
+        , m_head(0)
+        , m_count(0)
+    {
+
+    }
+
+    template <class type, size_t max_size>
+    void FixedCircularBuffer2D<type, max_size>::clear(void)
+    {
+        m_head = 0;
+        m_count = 0;
+    }
+
+    template <class type, size_t max_size>
+    int FixedCircularBuffer2D<type, max_size>::size(void) const
+    {
+        return m_count;
+    }
+
+    template <class type, size_t max_size>
+    int FixedCircularBuffer2D<type, max_size>::capacity(void) const
+    {
+        return max_size;
+    }
+
+    template <class type, size_t max_size>
+    size_t FixedCircularBuffer2D<type, max_size>::row_size(void) const
+    {
+        return m_row_size;
+    }
+
+    template <class type, size_t max_size>
+    void FixedCircularBuffer2D<type, max_size>::insert(const type *row)
+    {
+        size_t row_idx = (m_head + m_count) & (max_size - 1);
+        memcpy(m_buffer.data() + row_idx * m_row_size, row, m_row_size * sizeof(type));
+        if (m_count < max_size) {
+            ++m_count;
+        }
+        else {
+            m_head = (m_head + 1) & (max_size - 1);
+        }
+    }
+
+    template <class type, size_t max_size>
+    const type *FixedCircularBuffer2D<type, max_size>::value(unsigned int index) const
+    {
+#ifdef GEOPM_DEBUG
+        if (index >= m_count) {
+            throw Exception("FixedCircularBuffer2D::value(): index is out of bounds", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+#endif
+        return m_buffer.data() + ((m_head + index) & (max_size - 1)) * m_row_size;
+    }
 }
 
 #endif
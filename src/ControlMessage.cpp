@@ -30,6 +30,11 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
 #include "geopm_signal_handler.h"
 #include "ControlMessage.hpp"
 #include "string.h"
@@ -53,9 +58,11 @@ namespace geopm
     {
         if (m_is_ctl && m_ctl_msg.ctl_status != M_STATUS_SHUTDOWN) {
             m_ctl_msg.ctl_status++;
+            notify(m_ctl_msg.ctl_status);
         }
         else if (m_is_writer && m_ctl_msg.app_status != M_STATUS_SHUTDOWN) {
             m_ctl_msg.app_status++;
+            notify(m_ctl_msg.app_status);
         }
     }
 
@@ -64,22 +71,18 @@ namespace geopm
         if (m_last_status != M_STATUS_SHUTDOWN) {
             ++m_last_status;
         }
-        while (this_status() != m_last_status) {
-            geopm_signal_handler_check();
-            if (this_status() == M_STATUS_ABORT) {
-                throw Exception("ControlMessage::wait(): Abort sent through control message",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
-        }
+        wait_status(m_last_status, true);
     }
 
     void ControlMessage::abort(void)
     {
         if (m_is_ctl) {
             m_ctl_msg.ctl_status = M_STATUS_ABORT;
+            notify(m_ctl_msg.ctl_status);
         }
         else {
             m_ctl_msg.app_status = M_STATUS_ABORT;
+            notify(m_ctl_msg.app_status);
         }
     }
 
@@ -121,18 +124,46 @@ namespace geopm
     void ControlMessage::loop_begin()
     {
         if (m_is_ctl) {
-            while (m_ctl_msg.app_status != M_STATUS_NAME_LOOP_BEGIN) {
-                geopm_signal_handler_check();
-            }
+            wait_status(M_STATUS_NAME_LOOP_BEGIN, false);
             m_ctl_msg.ctl_status = M_STATUS_NAME_LOOP_BEGIN;
+            notify(m_ctl_msg.ctl_status);
         }
         else {
             m_ctl_msg.app_status = M_STATUS_NAME_LOOP_BEGIN;
-            while (m_ctl_msg.ctl_status != M_STATUS_NAME_LOOP_BEGIN) {
-                geopm_signal_handler_check();
-            }
+            notify(m_ctl_msg.app_status);
+            wait_status(M_STATUS_NAME_LOOP_BEGIN, false);
         }
         m_last_status = M_STATUS_NAME_LOOP_BEGIN;
     }
 
+    void ControlMessage::wait_status(int status, bool is_abort_checked)
+    {
+        // The peer wakes the futex each time it writes its status.
+        // The timeout bounds the latency of the signal handler check
+        // and protects against a peer that writes without waking.
+        struct timespec timeout = {0, M_WAIT_TIMEOUT_NSEC};
+        volatile uint32_t *peer_status = m_is_ctl ? &m_ctl_msg.app_status : &m_ctl_msg.ctl_status;
+        uint32_t curr_status = *peer_status;
+        while ((int)curr_status != status) {
+            geopm_signal_handler_check();
+            if (is_abort_checked && curr_status == M_STATUS_ABORT) {
+                throw Exception("ControlMessage::wait(): Abort sent through control message",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            // Returns immediately if the status has already changed;
+            // EINTR and ETIMEDOUT are handled by re-reading the status.
+            (void)syscall(SYS_futex, (uint32_t *)peer_status, FUTEX_WAIT,
+                          curr_status, &timeout, NULL, 0);
+            curr_status = *peer_status;
+        }
+    }
+
+    void ControlMessage::notify(volatile uint32_t &status)
+    {
+        // The message is shared between processes so the futex
+        // operations can not use FUTEX_PRIVATE_FLAG.
+        (void)syscall(SYS_futex, (uint32_t *)&status, FUTEX_WAKE,
+                      INT_MAX, NULL, NULL, 0);
+    }
+
 }
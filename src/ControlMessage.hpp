@@ -148,6 +148,20 @@ namespace geopm
             void loop_begin(void) override;
         protected:
             int this_status();
+            /// @brief Block until the status of the other side of
+            ///        the message is the given value.
+            ///
+            /// The wait sleeps on a futex on the shared status word
+            /// rather than spinning, and is woken by notify().
+            ///
+            /// @param [in] status Status value to wait for.
+            ///
+            /// @param [in] is_abort_checked If true, throw if the
+            ///        other side sends an abort.
+            void wait_status(int status, bool is_abort_checked);
+            /// @brief Wake all processes waiting on a status word
+            ///        after it has been written.
+            void notify(volatile uint32_t &status);
             /// @brief Enum encompassing application and
             /// GEOPM runtime state.
             enum m_status_e {
@@ -163,6 +177,11 @@ namespace geopm
                 M_STATUS_SHUTDOWN,
                 M_STATUS_ABORT = 9999,
             };
+            enum m_wait_e {
+                /// @brief Upper bound on each futex sleep in
+                ///        wait_status().
+                M_WAIT_TIMEOUT_NSEC = 5000000,
+            };
             struct geopm_ctl_message_s &m_ctl_msg;
             bool m_is_ctl;
             bool m_is_writer;
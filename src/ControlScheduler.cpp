@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "ControlScheduler.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    const double ControlScheduler::M_SMOOTH_FACTOR = 0.125;
+    const double ControlScheduler::M_MAX_PERIOD = 1.0;
+
+    ControlScheduler::ControlScheduler(double overhead_frac)
+        : ControlScheduler(overhead_frac, M_MAX_PERIOD, M_NUM_STEP_PER_EPOCH)
+    {
+
+    }
+
+    ControlScheduler::ControlScheduler(double overhead_frac, double max_period, int num_step_per_epoch)
+        : m_overhead_frac(overhead_frac)
+        , m_max_period(max_period)
+        , m_num_step_per_epoch(num_step_per_epoch)
+        , m_is_enabled(overhead_frac > 0.0)
+        , m_overhead_time(NAN)
+        , m_period(0.0)
+        , m_period_max_seen(0.0)
+        , m_waiter(0.0)
+        , m_num_step(0)
+        , m_num_step_unchanged(0)
+    {
+        if (!(overhead_frac >= 0.0 && overhead_frac < 1.0)) {
+            throw Exception("ControlScheduler::ControlScheduler(): overhead fraction must be in the range [0, 1)",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (!(max_period >= 0.0) || num_step_per_epoch < 1) {
+            throw Exception("ControlScheduler::ControlScheduler(): invalid maximum period or steps per epoch",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    bool ControlScheduler::is_enabled(void) const
+    {
+        return m_is_enabled;
+    }
+
+    void ControlScheduler::update(double overhead_time, double epoch_time)
+    {
+        if (!m_is_enabled || isnan(overhead_time)) {
+            return;
+        }
+        if (isnan(m_overhead_time)) {
+            m_overhead_time = overhead_time;
+        }
+        else {
+            m_overhead_time += M_SMOOTH_FACTOR * (overhead_time - m_overhead_time);
+        }
+        double ceiling = m_max_period;
+        if (epoch_time > 0.0) {
+            ceiling = std::min(ceiling, epoch_time / m_num_step_per_epoch);
+        }
+        m_period = std::min(m_overhead_time / m_overhead_frac, ceiling);
+        m_period_max_seen = std::max(m_period_max_seen, m_period);
+        m_waiter.period(m_period);
+    }
+
+    void ControlScheduler::record_policy(bool is_changed)
+    {
+        m_num_step_unchanged = is_changed ? 0 : m_num_step_unchanged + 1;
+    }
+
+    bool ControlScheduler::do_send_up(int level) const
+    {
+        bool result = true;
+        if (m_is_enabled && level > 0 && m_num_step_unchanged > 0) {
+            int stride = 1;
+            for (int idx = 0; idx < level && stride < M_MAX_TREE_STRIDE; ++idx) {
+                stride *= 2;
+            }
+            result = (m_num_step % stride) == 0;
+        }
+        return result;
+    }
+
+    void ControlScheduler::wait(void)
+    {
+        if (m_is_enabled) {
+            m_waiter.wait();
+        }
+        ++m_num_step;
+    }
+
+    double ControlScheduler::period(void) const
+    {
+        return m_period;
+    }
+
+    std::vector<std::pair<std::string, std::string> > ControlScheduler::report(void) const
+    {
+        std::vector<std::pair<std::string, std::string> > result;
+        if (m_is_enabled) {
+            std::ostringstream value;
+            value << "last=" << m_period << " max=" << m_period_max_seen
+                  << " overhead-fraction=" << m_overhead_frac;
+            result.emplace_back("Controller scheduled period (sec)", value.str());
+        }
+        return result;
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CONTROLSCHEDULER_HPP_INCLUDE
+#define CONTROLSCHEDULER_HPP_INCLUDE
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Waiter.hpp"
+
+namespace geopm
+{
+    /// @brief Chooses the period of the Kontroller control loop so
+    ///        that the time spent reading the platform and
+    ///        communicating through the tree stays within a fraction
+    ///        of the run time.
+    ///
+    /// After each step the Kontroller reports the overhead time of
+    /// the step and the duration of the last application epoch with
+    /// update().  The period is the smoothed overhead divided by the
+    /// overhead fraction, but no longer than a fraction of the epoch
+    /// so that each application phase is still sampled several
+    /// times, and no longer than the maximum period.  The wait()
+    /// method holds this period in addition to any wait done by the
+    /// Agent.  While the policy received by the controller is not
+    /// changing, samples sent from upper levels of the tree are
+    /// decimated by a stride that doubles with each level.
+    ///
+    /// An overhead fraction of zero disables the scheduler: the
+    /// period is zero, wait() returns immediately and every sample is
+    /// sent.
+    class ControlScheduler
+    {
+        public:
+            /// @brief Scheduler with a maximum period of one second
+            ///        and at least four steps per epoch.
+            /// @param [in] overhead_frac Target fraction of time
+            ///        spent in controller overhead, zero to disable.
+            ControlScheduler(double overhead_frac);
+            /// @param [in] overhead_frac Target fraction of time
+            ///        spent in controller overhead, zero to disable.
+            /// @param [in] max_period Upper bound on the period in
+            ///        seconds.
+            /// @param [in] num_step_per_epoch Minimum number of steps
+            ///        per application epoch when the epoch is known.
+            ControlScheduler(double overhead_frac, double max_period, int num_step_per_epoch);
+            virtual ~ControlScheduler() = default;
+            /// @brief Whether an overhead budget was given.
+            bool is_enabled(void) const;
+            /// @brief Record the cost of the last step and update the
+            ///        period.
+            /// @param [in] overhead_time Time spent reading the
+            ///        platform and in tree communication in seconds.
+            /// @param [in] epoch_time Duration of the last
+            ///        application epoch in seconds, or NAN if unknown.
+            void update(double overhead_time, double epoch_time);
+            /// @brief Record whether the policy changed during the
+            ///        last walk down the tree.
+            void record_policy(bool is_changed);
+            /// @brief Whether samples should be sent up from the
+            ///        given tree level during this step.
+            bool do_send_up(int level) const;
+            /// @brief Sleep until the end of the current period and
+            ///        start the next step.
+            void wait(void);
+            /// @brief Period chosen by the last call to update() in
+            ///        seconds.
+            double period(void) const;
+            /// @brief Overhead budget and chosen period formatted as
+            ///        key-value pairs for the report.  Empty if the
+            ///        scheduler is disabled.
+            std::vector<std::pair<std::string, std::string> > report(void) const;
+        private:
+            enum {
+                M_MAX_TREE_STRIDE = 16,
+                M_NUM_STEP_PER_EPOCH = 4,
+            };
+            static const double M_MAX_PERIOD;
+            /// @brief Weight of the newest step in the exponential
+            ///        moving average of the overhead time.
+            static const double M_SMOOTH_FACTOR;
+            const double m_overhead_frac;
+            const double m_max_period;
+            const int m_num_step_per_epoch;
+            const bool m_is_enabled;
+            double m_overhead_time;
+            double m_period;
+            double m_period_max_seen;
+            Waiter m_waiter;
+            int m_num_step;
+            int m_num_step_unchanged;
+    };
+}
+
+#endif
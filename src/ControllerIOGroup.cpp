@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+
+#include "ControllerIOGroup.hpp"
+#include "ControllerProfiler.hpp"
+#include "ControlScheduler.hpp"
+#include "PlatformTopo.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+#define GEOPM_CONTROLLER_IO_GROUP_PLUGIN_NAME "CONTROLLER"
+
+namespace geopm
+{
+    ControllerIOGroup::ControllerIOGroup(std::shared_ptr<const ControllerProfiler> profiler,
+                                         std::shared_ptr<const ControlScheduler> scheduler)
+        : m_profiler(profiler)
+        , m_scheduler(scheduler)
+        , m_is_batch_read(false)
+    {
+        static const std::vector<std::string> stat_suffix {"_LATENCY_P50",
+                                                           "_LATENCY_P99",
+                                                           "_LATENCY_MAX"};
+        for (int phase = 0; phase != ControllerProfiler::M_NUM_PHASE; ++phase) {
+            for (int stat = 0; stat != M_NUM_STAT; ++stat) {
+                m_signal_map[plugin_name() + "::" + ControllerProfiler::phase_name(phase) +
+                             stat_suffix[stat]] = {phase, stat};
+            }
+        }
+        m_signal_map[plugin_name() + "::SCHEDULED_PERIOD"] = {-1, M_STAT_SCHEDULED_PERIOD};
+    }
+
+    std::set<std::string> ControllerIOGroup::signal_names(void) const
+    {
+        std::set<std::string> result;
+        for (const auto &sig : m_signal_map) {
+            result.insert(sig.first);
+        }
+        return result;
+    }
+
+    std::set<std::string> ControllerIOGroup::control_names(void) const
+    {
+        return {};
+    }
+
+    bool ControllerIOGroup::is_valid_signal(const std::string &signal_name) const
+    {
+        return m_signal_map.find(signal_name) != m_signal_map.end();
+    }
+
+    bool ControllerIOGroup::is_valid_control(const std::string &control_name) const
+    {
+        return false;
+    }
+
+    int ControllerIOGroup::signal_domain_type(const std::string &signal_name) const
+    {
+        int result = PlatformTopo::M_DOMAIN_INVALID;
+        if (is_valid_signal(signal_name)) {
+            result = PlatformTopo::M_DOMAIN_BOARD;
+        }
+        return result;
+    }
+
+    int ControllerIOGroup::control_domain_type(const std::string &control_name) const
+    {
+        return PlatformTopo::M_DOMAIN_INVALID;
+    }
+
+    int ControllerIOGroup::push_signal(const std::string &signal_name, int domain_type, int domain_idx)
+    {
+        if (!is_valid_signal(signal_name)) {
+            throw Exception("ControllerIOGroup::push_signal(): signal_name " + signal_name +
+                            " not valid for ControllerIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (domain_type != PlatformTopo::M_DOMAIN_BOARD) {
+            throw Exception("ControllerIOGroup::push_signal(): signal_name " + signal_name +
+                            " not defined for domain " + std::to_string(domain_type),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_is_batch_read) {
+            throw Exception("ControllerIOGroup::push_signal(): cannot push signal after call to read_batch().",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int result = m_active_signal.size();
+        m_active_signal.push_back(m_signal_map.at(signal_name));
+        m_sample.push_back(NAN);
+        return result;
+    }
+
+    int ControllerIOGroup::push_control(const std::string &control_name, int domain_type, int domain_idx)
+    {
+        throw Exception("ControllerIOGroup::push_control(): there are no controls supported by the ControllerIOGroup",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    void ControllerIOGroup::read_batch(void)
+    {
+        for (size_t idx = 0; idx != m_active_signal.size(); ++idx) {
+            m_sample[idx] = read_stat(m_active_signal[idx]);
+        }
+        m_is_batch_read = true;
+    }
+
+    void ControllerIOGroup::write_batch(void)
+    {
+
+    }
+
+    double ControllerIOGroup::sample(int batch_idx)
+    {
+        if (batch_idx < 0 || batch_idx >= (int)m_active_signal.size()) {
+            throw Exception("ControllerIOGroup::sample(): batch_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (!m_is_batch_read) {
+            throw Exception("ControllerIOGroup::sample(): signal has not been read",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_sample[batch_idx];
+    }
+
+    void ControllerIOGroup::adjust(int batch_idx, double setting)
+    {
+        throw Exception("ControllerIOGroup::adjust(): there are no controls supported by the ControllerIOGroup",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    double ControllerIOGroup::read_signal(const std::string &signal_name, int domain_type, int domain_idx)
+    {
+        if (!is_valid_signal(signal_name)) {
+            throw Exception("ControllerIOGroup:read_signal(): " + signal_name +
+                            " not valid for ControllerIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (domain_type != PlatformTopo::M_DOMAIN_BOARD) {
+            throw Exception("ControllerIOGroup::read_signal(): signal_name " + signal_name +
+                            " not defined for domain " + std::to_string(domain_type),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return read_stat(m_signal_map.at(signal_name));
+    }
+
+    void ControllerIOGroup::write_control(const std::string &control_name, int domain_type, int domain_idx, double setting)
+    {
+        throw Exception("ControllerIOGroup::write_control(): there are no controls supported by the ControllerIOGroup",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    std::string ControllerIOGroup::plugin_name(void)
+    {
+        return GEOPM_CONTROLLER_IO_GROUP_PLUGIN_NAME;
+    }
+
+    double ControllerIOGroup::read_stat(const m_signal_s &signal) const
+    {
+        double result = NAN;
+        switch (signal.stat) {
+            case M_STAT_P50:
+                result = m_profiler->histogram(signal.phase).percentile(0.5);
+                break;
+            case M_STAT_P99:
+                result = m_profiler->histogram(signal.phase).percentile(0.99);
+                break;
+            case M_STAT_MAX:
+                if (m_profiler->histogram(signal.phase).count()) {
+                    result = m_profiler->histogram(signal.phase).max();
+                }
+                break;
+            case M_STAT_SCHEDULED_PERIOD:
+                result = m_scheduler->period();
+                break;
+            default:
+#ifdef GEOPM_DEBUG
+                throw Exception("ControllerIOGroup::read_stat(): invalid statistic",
+                                GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+#endif
+                break;
+        }
+        return result;
+    }
+}
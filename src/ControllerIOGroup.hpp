@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CONTROLLERIOGROUP_HPP_INCLUDE
+#define CONTROLLERIOGROUP_HPP_INCLUDE
+
+#include <map>
+#include <set>
+#include <memory>
+#include <vector>
+
+#include "IOGroup.hpp"
+
+namespace geopm
+{
+    class ControllerProfiler;
+    class ControlScheduler;
+
+    /// @brief IOGroup that provides signals for the latency of each
+    ///        phase of the controller loop measured by a
+    ///        ControllerProfiler.
+    ///
+    /// For each phase there are three board signals in seconds:
+    /// CONTROLLER::<PHASE>_LATENCY_P50, CONTROLLER::<PHASE>_LATENCY_P99
+    /// and CONTROLLER::<PHASE>_LATENCY_MAX, e.g.
+    /// CONTROLLER::STEP_LATENCY_P99.  The values summarize every
+    /// step since the controller started and are updated by
+    /// read_batch().  The board signal CONTROLLER::SCHEDULED_PERIOD
+    /// is the control loop period in seconds chosen by the
+    /// ControlScheduler.  This IOGroup is registered by the
+    /// Kontroller which owns the profiler and the scheduler.
+    class ControllerIOGroup : public IOGroup
+    {
+        public:
+            ControllerIOGroup(std::shared_ptr<const ControllerProfiler> profiler,
+                              std::shared_ptr<const ControlScheduler> scheduler);
+            virtual ~ControllerIOGroup() = default;
+            std::set<std::string> signal_names(void) const override;
+            std::set<std::string> control_names(void) const override;
+            bool is_valid_signal(const std::string &signal_name) const override;
+            bool is_valid_control(const std::string &control_name) const override;
+            int signal_domain_type(const std::string &signal_name) const override;
+            int control_domain_type(const std::string &control_name) const override;
+            int push_signal(const std::string &signal_name, int domain_type, int domain_idx)  override;
+            int push_control(const std::string &control_name, int domain_type, int domain_idx) override;
+            void read_batch(void) override;
+            void write_batch(void) override;
+            double sample(int batch_idx) override;
+            void adjust(int batch_idx, double setting) override;
+            double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override;
+            void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override;
+            static std::string plugin_name(void);
+        private:
+            enum m_stat_e {
+                M_STAT_P50,
+                M_STAT_P99,
+                M_STAT_MAX,
+                M_NUM_STAT,
+                /// @brief Not a latency statistic: the period from
+                ///        the ControlScheduler.
+                M_STAT_SCHEDULED_PERIOD = M_NUM_STAT,
+            };
+            struct m_signal_s {
+                int phase;
+                int stat;
+            };
+            double read_stat(const m_signal_s &signal) const;
+            std::shared_ptr<const ControllerProfiler> m_profiler;
+            std::shared_ptr<const ControlScheduler> m_scheduler;
+            std::map<std::string, m_signal_s> m_signal_map;
+            std::vector<m_signal_s> m_active_signal;
+            std::vector<double> m_sample;
+            bool m_is_batch_read;
+    };
+}
+
+#endif
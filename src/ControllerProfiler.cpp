@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <cctype>
+
+#include "ControllerProfiler.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    ControllerProfiler::ControllerProfiler()
+        : m_histogram(M_NUM_PHASE)
+        , m_enter_time(M_NUM_PHASE, {{0, 0}})
+        , m_step_time(M_NUM_PHASE, 0.0)
+        , m_is_step_entered(false)
+    {
+
+    }
+
+    void ControllerProfiler::enter(int phase)
+    {
+#ifdef GEOPM_DEBUG
+        check_phase(phase, "enter");
+#endif
+        struct geopm_time_s now;
+        geopm_time(&now);
+        if (phase == M_PHASE_STEP) {
+            if (m_is_step_entered) {
+                m_histogram[M_PHASE_PERIOD].insert(
+                    geopm_time_diff(&m_enter_time[M_PHASE_STEP], &now));
+            }
+            m_is_step_entered = true;
+            std::fill(m_step_time.begin(), m_step_time.end(), 0.0);
+        }
+        m_enter_time[phase] = now;
+    }
+
+    void ControllerProfiler::exit(int phase)
+    {
+#ifdef GEOPM_DEBUG
+        check_phase(phase, "exit");
+#endif
+        struct geopm_time_s now;
+        geopm_time(&now);
+        double latency = geopm_time_diff(&m_enter_time[phase], &now);
+        m_histogram[phase].insert(latency);
+        m_step_time[phase] += latency;
+    }
+
+    const LatencyHistogram &ControllerProfiler::histogram(int phase) const
+    {
+        check_phase(phase, "histogram");
+        return m_histogram[phase];
+    }
+
+    double ControllerProfiler::step_time(int phase) const
+    {
+        check_phase(phase, "step_time");
+        return m_step_time[phase];
+    }
+
+    std::string ControllerProfiler::phase_name(int phase)
+    {
+        static const std::vector<std::string> names {
+            "STEP",
+            "PERIOD",
+            "WALK_DOWN",
+            "WALK_UP",
+            "READ_BATCH",
+            "WRITE_BATCH",
+            "DESCEND",
+            "ASCEND",
+            "TRACER_UPDATE",
+            "TREE_SEND",
+            "TREE_RECEIVE",
+        };
+        if (phase < 0 || phase >= M_NUM_PHASE) {
+            throw Exception("ControllerProfiler::phase_name(): phase out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return names[phase];
+    }
+
+    std::vector<std::pair<std::string, std::string> > ControllerProfiler::report(void) const
+    {
+        std::vector<std::pair<std::string, std::string> > result;
+        for (int phase = 0; phase != M_NUM_PHASE; ++phase) {
+            const LatencyHistogram &hist = m_histogram[phase];
+            if (hist.count()) {
+                std::string name = phase_name(phase);
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                std::replace(name.begin(), name.end(), '_', '-');
+                std::ostringstream value;
+                value << "p50=" << hist.percentile(0.5)
+                      << " p99=" << hist.percentile(0.99)
+                      << " max=" << hist.max()
+                      << " count=" << hist.count();
+                result.emplace_back("Controller " + name + " latency (sec)", value.str());
+            }
+        }
+        return result;
+    }
+
+    void ControllerProfiler::check_phase(int phase, const std::string &func) const
+    {
+        if (phase < 0 || phase >= M_NUM_PHASE) {
+            throw Exception("ControllerProfiler::" + func + "(): phase out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CONTROLLERPROFILER_HPP_INCLUDE
+#define CONTROLLERPROFILER_HPP_INCLUDE
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "geopm_time.h"
+#include "LatencyHistogram.hpp"
+
+namespace geopm
+{
+    /// @brief Records the latency of each phase of the Kontroller
+    ///        control loop in a LatencyHistogram.
+    ///
+    /// The Kontroller brackets each phase with enter() and exit().
+    /// The results are added to the report and are available as
+    /// signals through the ControllerIOGroup so that an Agent or
+    /// the trace can check whether the control loop keeps up with
+    /// its period.
+    class ControllerProfiler
+    {
+        public:
+            enum m_phase_e {
+                /// @brief One call to Kontroller::step() excluding
+                ///        the Agent wait().
+                M_PHASE_STEP,
+                /// @brief Time between the start of consecutive
+                ///        steps, recorded on entry to M_PHASE_STEP.
+                M_PHASE_PERIOD,
+                M_PHASE_WALK_DOWN,
+                M_PHASE_WALK_UP,
+                M_PHASE_READ_BATCH,
+                M_PHASE_WRITE_BATCH,
+                M_PHASE_DESCEND,
+                M_PHASE_ASCEND,
+                M_PHASE_TRACER_UPDATE,
+                M_PHASE_TREE_SEND,
+                M_PHASE_TREE_RECEIVE,
+                M_NUM_PHASE,
+            };
+            ControllerProfiler();
+            virtual ~ControllerProfiler() = default;
+            /// @brief Mark the start of a phase.
+            void enter(int phase);
+            /// @brief Mark the end of a phase and record the time
+            ///        since the matching enter().
+            void exit(int phase);
+            /// @brief Histogram of the latencies recorded for a
+            ///        phase.
+            const LatencyHistogram &histogram(int phase) const;
+            /// @brief Total time spent in a phase since the last
+            ///        enter() of M_PHASE_STEP.
+            double step_time(int phase) const;
+            /// @brief Name of a phase as used in signal names,
+            ///        e.g. "STEP" or "WALK_DOWN".
+            static std::string phase_name(int phase);
+            /// @brief Summary of each phase that has been recorded
+            ///        formatted as key-value pairs for the report.
+            std::vector<std::pair<std::string, std::string> > report(void) const;
+        private:
+            void check_phase(int phase, const std::string &func) const;
+            std::vector<LatencyHistogram> m_histogram;
+            std::vector<struct geopm_time_s> m_enter_time;
+            std::vector<double> m_step_time;
+            bool m_is_step_entered;
+    };
+}
+
+#endif
@@ -116,7 +116,7 @@ extern "C"
     {
         int err = 0;
         try {
-            *region_id = geopm_default_prof().region(std::string(region_name), hint);
+            *region_id = geopm_default_prof().region(region_name, hint);
         }
         catch (...) {
             err = geopm::exception_handler(std::current_exception());
@@ -31,6 +31,7 @@
  */
 
 #include <sstream>
+#include <algorithm>
 
 #include "geopm.h"
 #include "geopm_hash.h"
@@ -58,9 +59,12 @@ namespace geopm
         , M_FREQ_MAX(cpu_freq_max())
         , M_FREQ_STEP(get_limit("CPUINFO::FREQ_STEP"))
         , M_SEND_PERIOD(10)
+        , M_WAIT_SEC(0.005)
+        , m_control_group(-1)
         , m_last_freq(NAN)
         , m_curr_adapt_freq(NAN)
-        , m_last_wait{{0, 0}}
+        , m_waiter(M_WAIT_SEC)
+        , m_sample_group(-1)
         , m_runtime_idx(-1)
         , m_pkg_energy_idx(-1)
         , m_dram_energy_idx(-1)
@@ -89,12 +93,12 @@ namespace geopm
     }
 
     bool EnergyEfficientAgent::descend(const std::vector<double> &in_policy,
-                                       std::vector<std::vector<double> >&out_policy)
+                                       MessageMatrix &out_policy)
     {
         return true;
     }
 
-    bool EnergyEfficientAgent::ascend(const std::vector<std::vector<double> > &in_sample,
+    bool EnergyEfficientAgent::ascend(const MessageMatrix &in_sample,
                                       std::vector<double> &out_sample)
     {
 #ifdef GEOPM_DEBUG
@@ -162,9 +166,8 @@ namespace geopm
         }
 
         if (freq != m_last_freq) {
-            for (auto ctl_idx : m_control_idx) {
-                m_platform_io.adjust(ctl_idx, freq);
-            }
+            std::fill(m_control_value.begin(), m_control_value.end(), freq);
+            m_platform_io.adjust_group(m_control_group, m_control_value);
             m_last_freq = freq;
             result = true;
         }
@@ -179,11 +182,11 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        for (size_t sample_idx = 0; sample_idx < m_num_sample; ++sample_idx) {
-            out_sample[sample_idx] = m_platform_io.sample(m_sample_idx[sample_idx]);
-        }
+        m_platform_io.sample_group(m_sample_group, m_sample_value);
+        std::copy(m_sample_value.begin(), m_sample_value.begin() + m_num_sample,
+                  out_sample.begin());
         int num_domain = m_platform_topo.num_domain(PlatformTopo::M_DOMAIN_CPU);
-        uint64_t current_region_id = geopm_signal_to_field(m_platform_io.sample(m_region_id_idx));
+        uint64_t current_region_id = geopm_signal_to_field(m_sample_value[m_num_sample]);
         if (m_is_adaptive) {
             if (current_region_id != GEOPM_REGION_ID_UNMARKED &&
                 current_region_id != GEOPM_REGION_ID_UNDEFINED) {
@@ -232,13 +235,7 @@ namespace geopm
 
     void EnergyEfficientAgent::wait(void)
     {
-        static double M_WAIT_SEC = 0.005;
-        geopm_time_s current_time;
-        geopm_time(&current_time);
-        while(geopm_time_diff(&m_last_wait, &current_time) < M_WAIT_SEC) {
-            geopm_time(&current_time);
-        }
-        geopm_time(&m_last_wait);
+        m_waiter.wait();
     }
 
     std::vector<std::string> EnergyEfficientAgent::policy_names(void)
@@ -352,7 +349,13 @@ namespace geopm
             }
             m_control_idx.push_back(control_idx);
         }
+        m_control_group = m_platform_io.push_control_group(m_control_idx);
+        m_control_value.resize(m_control_idx.size(), NAN);
         m_region_id_idx = m_platform_io.push_signal("REGION_ID#", IPlatformTopo::M_DOMAIN_BOARD, 0);
+        std::vector<int> group_idx(m_sample_idx);
+        group_idx.push_back(m_region_id_idx);
+        m_sample_group = m_platform_io.push_signal_group(group_idx);
+        m_sample_value.resize(group_idx.size(), NAN);
 
         if (m_is_adaptive) {
             m_runtime_idx = m_platform_io.push_signal("REGION_RUNTIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
@@ -39,7 +39,7 @@
 #include <memory>
 #include <functional>
 
-#include "geopm_time.h"
+#include "Waiter.hpp"
 
 #include "Agent.hpp"
 #include "EnergyEfficientRegion.hpp"
@@ -57,8 +57,8 @@ namespace geopm
             virtual ~EnergyEfficientAgent() = default;
             void init(int level) override;
             bool descend(const std::vector<double> &in_policy,
-                         std::vector<std::vector<double> >&out_policy) override;
-            bool ascend(const std::vector<std::vector<double> > &in_sample,
+                         MessageMatrix &out_policy) override;
+            bool ascend(const MessageMatrix &in_sample,
                         std::vector<double> &out_sample) override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
@@ -86,15 +86,21 @@ namespace geopm
             const double M_FREQ_MAX;
             const double M_FREQ_STEP;
             const size_t M_SEND_PERIOD;
+            const double M_WAIT_SEC;
             std::vector<int> m_control_idx;
+            int m_control_group;
+            std::vector<double> m_control_value;
             double m_last_freq;
             double m_curr_adapt_freq;
             std::map<uint64_t, double> m_rid_freq_map;
             // for online adaptive mode
             bool m_is_adaptive = false;
             std::map<uint64_t, std::unique_ptr<EnergyEfficientRegion> > m_region_map;
-            geopm_time_s m_last_wait;
+            Waiter m_waiter;
             std::vector<int> m_sample_idx;
+            // Group of the trace samples followed by REGION_ID#
+            int m_sample_group;
+            std::vector<double> m_sample_value;
             std::vector<std::function<double(const std::vector<double>&)> > m_agg_func;
             size_t m_num_sample;
             int m_level;
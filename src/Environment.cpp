@@ -64,8 +64,10 @@ namespace geopm
             const char *policy(void) const;
             const char *shmkey(void) const;
             const char *trace(void) const;
+            const char *trace_format(void) const;
             const char *plugin_path(void) const;
             const char *profile(void) const;
+            const char *profile_table(void) const;
             const char *agent(void) const;
             const char *trace_signal(int index) const;
             int num_trace_signal(void) const;
@@ -77,17 +79,23 @@ namespace geopm
             int profile_timeout(void) const;
             int debug_attach(void) const;
             int do_kontroller(void) const;
+            int do_msr_async(void) const;
+            int do_report_parallel(void) const;
+            double ctl_overhead(void) const;
         private:
             bool get_env(const char *name, std::string &env_string) const;
             bool get_env(const char *name, int &value) const;
+            bool get_env(const char *name, double &value) const;
             std::string m_report;
             std::string m_comm;
             std::string m_policy;
             std::string m_agent;
             std::string m_shmkey;
             std::string m_trace;
+            std::string m_trace_format;
             std::string m_plugin_path;
             std::string m_profile;
+            std::string m_profile_table;
             int m_report_verbosity;
             int m_pmpi_ctl;
             bool m_do_region_barrier;
@@ -96,6 +104,9 @@ namespace geopm
             int m_profile_timeout;
             int m_debug_attach;
             bool m_do_kontroller;
+            bool m_do_msr_async;
+            bool m_do_report_parallel;
+            double m_ctl_overhead;
             std::vector<std::string> m_trace_signal;
     };
 
@@ -123,8 +134,10 @@ namespace geopm
         m_agent = "monitor";
         m_shmkey = "/geopm-shm-" + std::to_string(geteuid());
         m_trace = "";
+        m_trace_format = "text";
         m_plugin_path = "";
         m_profile = "";
+        m_profile_table = "hash";
         m_report_verbosity = 0;
         m_pmpi_ctl = GEOPM_PMPI_CTL_NONE;
         m_do_region_barrier = false;
@@ -133,6 +146,9 @@ namespace geopm
         m_profile_timeout = 30;
         m_debug_attach = -1;
         m_do_kontroller = false;
+        m_do_msr_async = false;
+        m_do_report_parallel = false;
+        m_ctl_overhead = 0.0;
         m_trace_signal.clear();
 
         std::string tmp_str("");
@@ -146,12 +162,17 @@ namespace geopm
             m_shmkey = "/" + m_shmkey;
         }
         m_do_trace = get_env("GEOPM_TRACE", m_trace);
+        (void)get_env("GEOPM_TRACE_FORMAT", m_trace_format);
         (void)get_env("GEOPM_PLUGIN_PATH", m_plugin_path);
         if (!get_env("GEOPM_REPORT_VERBOSITY", m_report_verbosity) && m_report.size()) {
             m_report_verbosity = 1;
         }
         m_do_region_barrier = get_env("GEOPM_REGION_BARRIER", tmp_str);
+        m_do_msr_async = get_env("GEOPM_MSR_ASYNC", tmp_str);
+        m_do_report_parallel = get_env("GEOPM_REPORT_PARALLEL", tmp_str);
         (void)get_env("GEOPM_PROFILE_TIMEOUT", m_profile_timeout);
+        (void)get_env("GEOPM_PROFILE_TABLE", m_profile_table);
+        (void)get_env("GEOPM_CTL_OVERHEAD", m_ctl_overhead);
         if (get_env("GEOPM_PMPI_CTL", tmp_str)) {
             if (tmp_str == "process") {
                 m_pmpi_ctl = GEOPM_PMPI_CTL_PROCESS;
@@ -222,6 +243,23 @@ namespace geopm
         return result;
     }
 
+    bool Environment::get_env(const char *name, double &value) const
+    {
+        bool result = false;
+        std::string tmp_str("");
+        char *end_ptr = NULL;
+
+        if (get_env(name, tmp_str)) {
+            value = strtod(tmp_str.c_str(), &end_ptr);
+            if (tmp_str.c_str() == end_ptr) {
+                throw Exception("Environment::Environment(): Value could not be converted to a floating point number",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            result = true;
+        }
+        return result;
+    }
+
     const char *Environment::report(void) const
     {
         return m_report.c_str();
@@ -252,11 +290,21 @@ namespace geopm
         return m_trace.c_str();
     }
 
+    const char *Environment::trace_format(void) const
+    {
+        return m_trace_format.c_str();
+    }
+
     const char *Environment::profile(void) const
     {
         return m_profile.c_str();
     }
 
+    const char *Environment::profile_table(void) const
+    {
+        return m_profile_table.c_str();
+    }
+
     const char *Environment::plugin_path(void) const
     {
         return m_plugin_path.c_str();
@@ -316,6 +364,21 @@ namespace geopm
     {
         return m_do_kontroller;
     }
+
+    int Environment::do_msr_async(void) const
+    {
+        return m_do_msr_async;
+    }
+
+    int Environment::do_report_parallel(void) const
+    {
+        return m_do_report_parallel;
+    }
+
+    double Environment::ctl_overhead(void) const
+    {
+        return m_ctl_overhead;
+    }
 }
 
 extern "C"
@@ -345,6 +408,11 @@ extern "C"
         return geopm::environment().trace();
     }
 
+    const char *geopm_env_trace_format(void)
+    {
+        return geopm::environment().trace_format();
+    }
+
     const char *geopm_env_plugin_path(void)
     {
         return geopm::environment().plugin_path();
@@ -364,6 +432,11 @@ extern "C"
     {
         return geopm::environment().profile();
     }
+
+    const char *geopm_env_profile_table(void)
+    {
+        return geopm::environment().profile_table();
+    }
     const char *geopm_env_trace_signal(int index)
     {
         return geopm::environment().trace_signal(index);
@@ -413,4 +486,19 @@ extern "C"
     {
         return geopm::environment().do_kontroller();
     }
+
+    int geopm_env_do_msr_async(void)
+    {
+        return geopm::environment().do_msr_async();
+    }
+
+    int geopm_env_do_report_parallel(void)
+    {
+        return geopm::environment().do_report_parallel();
+    }
+
+    double geopm_env_ctl_overhead(void)
+    {
+        return geopm::environment().ctl_overhead();
+    }
 }
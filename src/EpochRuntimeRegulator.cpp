@@ -30,6 +30,7 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cmath>
 #include <algorithm>
 
 #include "geopm.h"
@@ -39,18 +40,13 @@
 #include "KruntimeRegulator.hpp"
 #include "EpochRuntimeRegulator.hpp"
 #include "PlatformIO.hpp"
-#include "PlatformTopo.hpp"
 
 #include "config.h"
 
 namespace geopm
 {
-    EpochRuntimeRegulator::EpochRuntimeRegulator(int rank_per_node,
-                                                 IPlatformIO &platform_io,
-                                                 IPlatformTopo &platform_topo)
+    EpochRuntimeRegulator::EpochRuntimeRegulator(int rank_per_node)
         : m_rank_per_node(rank_per_node)
-        , m_platform_io(platform_io)
-        , m_platform_topo(platform_topo)
         , m_seen_first_epoch(m_rank_per_node, false)
         , m_curr_ignore_runtime(m_rank_per_node, 0.0)
         , m_agg_epoch_ignore_runtime(m_rank_per_node, 0.0)
@@ -62,6 +58,8 @@ namespace geopm
         , m_pre_epoch_region(m_rank_per_node)
         , m_epoch_start_energy(NAN)
         , m_epoch_total_energy(NAN)
+        , m_is_start_energy_pending(false)
+        , m_num_energy_sample(0)
     {
         if (m_rank_per_node <= 0) {
             throw Exception("EpochRuntimeRegulator::EpochRuntimeRegulator(): invalid max rank count", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
@@ -88,32 +86,53 @@ namespace geopm
         }
     }
 
-    /// @todo temporarily repeated here and in ApplicationIO, until these classes are combined.
-    double EpochRuntimeRegulator::current_energy(void) const
+    double EpochRuntimeRegulator::current_energy(const struct geopm_time_s &time) const
     {
-        double energy = 0.0;
-        int num_package = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE);
-        for (int pkg = 0; pkg < num_package; ++pkg) {
-            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+        double result = NAN;
+        if (m_num_energy_sample != 0) {
+            const m_energy_sample_s &last = m_energy_sample[1];
+            result = last.energy;
+            if (m_num_energy_sample == 2) {
+                const m_energy_sample_s &prev = m_energy_sample[0];
+                double sample_period = geopm_time_diff(&prev.time, &last.time);
+                if (sample_period > 0.0) {
+                    result += (last.energy - prev.energy) *
+                              geopm_time_diff(&last.time, &time) / sample_period;
+                }
+            }
+        }
+        return result;
+    }
+
+    void EpochRuntimeRegulator::record_energy(double energy, struct geopm_time_s sample_time)
+    {
+        if (m_num_energy_sample == 0 ||
+            geopm_time_comp(&m_energy_sample[1].time, &sample_time)) {
+            m_energy_sample[0] = m_energy_sample[1];
+            m_energy_sample[1] = {sample_time, energy};
+            if (m_num_energy_sample != 2) {
+                ++m_num_energy_sample;
+            }
         }
-        int num_dram = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY);
-        for (int dram = 0; dram < num_dram; ++dram) {
-            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, 0);
+        if (m_is_start_energy_pending) {
+            m_epoch_start_energy = energy;
+            m_is_start_energy_pending = false;
         }
-        return energy;
     }
 
     void EpochRuntimeRegulator::epoch(int rank, struct geopm_time_s epoch_time)
     {
         if (m_seen_first_epoch[rank]) {
             record_exit(GEOPM_REGION_ID_EPOCH, rank, epoch_time);
-            m_epoch_total_energy = current_energy() - m_epoch_start_energy;
+            m_epoch_total_energy = current_energy(epoch_time) - m_epoch_start_energy;
         }
         else {
             std::fill(m_curr_mpi_runtime.begin(), m_curr_mpi_runtime.end(), 0.0);
             std::fill(m_curr_ignore_runtime.begin(), m_curr_ignore_runtime.end(), 0.0);
             m_seen_first_epoch[rank] = true;
-            m_epoch_start_energy = current_energy();
+            m_epoch_start_energy = current_energy(epoch_time);
+            // Before the first batch read, start from the first record
+            m_is_start_energy_pending = std::isnan(m_epoch_start_energy);
         }
         record_entry(GEOPM_REGION_ID_EPOCH, rank, epoch_time);
     }
@@ -71,6 +71,14 @@ namespace geopm
             /// @param [in] rank Rank that exited the region.
             /// @param [in] exit_time Time of exit.
             virtual void record_exit(uint64_t region_id, int rank, struct geopm_time_s exit_time) = 0;
+            /// @brief Record the node energy from the latest batch
+            ///        read of the platform.  The energy at each epoch
+            ///        is interpolated from the last two records, so
+            ///        no platform reads are made when ranks cross an
+            ///        epoch.
+            /// @param [in] energy Package and DRAM energy in joules.
+            /// @param [in] sample_time Time the energy was read.
+            virtual void record_energy(double energy, struct geopm_time_s sample_time) = 0;
             /// @brief Returns a reference to the RuntimeRegulator for
             ///        a given region.  This method is intended for
             ///        internal use by the ApplicationIO.
@@ -126,20 +134,17 @@ namespace geopm
             virtual void clear_region_info(void) = 0;
     };
 
-    class IPlatformIO;
-    class IPlatformTopo;
-
     class EpochRuntimeRegulator : public IEpochRuntimeRegulator
     {
         public:
             EpochRuntimeRegulator() = delete;
-            EpochRuntimeRegulator(int rank_per_node, IPlatformIO &platform_io,
-                                  IPlatformTopo &platform_topo);
+            EpochRuntimeRegulator(int rank_per_node);
             virtual ~EpochRuntimeRegulator();
             virtual void init_unmarked_region() override;
             void epoch(int rank, struct geopm_time_s epoch_time) override;
             void record_entry(uint64_t region_id, int rank, struct geopm_time_s entry_time) override;
             void record_exit(uint64_t region_id, int rank, struct geopm_time_s exit_time) override;
+            void record_energy(double energy, struct geopm_time_s sample_time) override;
             const IKruntimeRegulator &region_regulator(uint64_t region_id) const override;
             bool is_regulated(uint64_t region_id) const override;
             std::vector<double> last_epoch_time() const override;
@@ -156,10 +161,10 @@ namespace geopm
             void clear_region_info(void) override;
         private:
             std::vector<double> per_rank_last_runtime(uint64_t region_id) const;
-            double current_energy(void) const;
+            /// @brief Energy at the given time extrapolated from the
+            ///        last two calls to record_energy().
+            double current_energy(const struct geopm_time_s &time) const;
             int m_rank_per_node;
-            IPlatformIO &m_platform_io;
-            IPlatformTopo &m_platform_topo;
             std::map<uint64_t, std::unique_ptr<IKruntimeRegulator> > m_rid_regulator_map;
             std::vector<bool> m_seen_first_epoch;
             std::vector<double> m_curr_ignore_runtime;
@@ -173,6 +178,15 @@ namespace geopm
             std::list<geopm_region_info_s> m_region_info;
             double m_epoch_start_energy;
             double m_epoch_total_energy;
+            // Set if the first epoch came before any energy record
+            bool m_is_start_energy_pending;
+            struct m_energy_sample_s {
+                struct geopm_time_s time;
+                double energy;
+            };
+            // Last two energy records, oldest first
+            m_energy_sample_s m_energy_sample[2];
+            int m_num_energy_sample;
     };
 }
 
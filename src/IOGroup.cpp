@@ -53,6 +53,24 @@ namespace geopm
                                           CpuinfoIOGroup::make_plugin);
     }
 
+    void IOGroup::sample_bulk(const std::vector<int> &sample_idx,
+                              double *sample_value)
+    {
+        for (auto idx : sample_idx) {
+            *sample_value = sample(idx);
+            ++sample_value;
+        }
+    }
+
+    void IOGroup::adjust_bulk(const std::vector<int> &control_idx,
+                              const double *setting)
+    {
+        for (auto idx : control_idx) {
+            adjust(idx, *setting);
+            ++setting;
+        }
+    }
+
     PluginFactory<IOGroup> &iogroup_factory(void)
     {
         static PluginFactory<IOGroup> instance;
@@ -112,6 +112,18 @@ namespace geopm
             ///        call to push_signal().
             /// @return Value of signal in SI units.
             virtual double sample(int sample_idx) = 0;
+            /// @brief Retrieve the values of several signals from the
+            ///        data read by the last call to read_batch().
+            ///        The default implementation calls sample() for
+            ///        each index; IOGroups that decode all signals
+            ///        when the batch is read should override it.
+            /// @param [in] sample_idx The indices returned by
+            ///        previous calls to push_signal().
+            /// @param [out] sample_value Array with at least
+            ///        sample_idx.size() elements that is filled with
+            ///        the value of each signal in SI units.
+            virtual void sample_bulk(const std::vector<int> &sample_idx,
+                                     double *sample_value);
             /// @brief Adjust a setting for a particular control that
             ///        was previously pushed with push_control(). This
             ///        adjustment will be written to the platform on
@@ -121,6 +133,16 @@ namespace geopm
             /// @param [in] setting Value of the control in SI units.
             virtual void adjust(int control_idx,
                                 double setting) = 0;
+            /// @brief Adjust several controls that were previously
+            ///        pushed with push_control().  The default
+            ///        implementation calls adjust() for each index.
+            /// @param [in] control_idx The indices returned by
+            ///        previous calls to push_control().
+            /// @param [in] setting Array with at least
+            ///        control_idx.size() elements giving the value
+            ///        of each control in SI units.
+            virtual void adjust_bulk(const std::vector<int> &control_idx,
+                                     const double *setting);
             /// @brief Read from platform and interpret into SI units
             ///        a signal given its name and domain.  Does not
             ///        modify the values stored by calling
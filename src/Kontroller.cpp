@@ -30,6 +30,9 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <math.h>
+#include <algorithm>
+
 #include "geopm_env.h"
 #include "geopm_signal_handler.h"
 #include "geopm_message.h"
@@ -45,6 +48,10 @@
 #include "Agent.hpp"
 #include "TreeComm.hpp"
 #include "ManagerIO.hpp"
+#include "ControllerProfiler.hpp"
+#include "ControllerIOGroup.hpp"
+#include "ControlScheduler.hpp"
+#include "Helper.hpp"
 #include "config.h"
 
 extern "C"
@@ -116,17 +123,23 @@ namespace geopm
         , m_out_policy(m_num_level_ctl)
         , m_in_sample(m_num_level_ctl)
         , m_out_sample(m_num_send_up)
+        , m_agg_func(m_num_level_ctl)
         , m_manager_io_sampler(std::move(manager_io_sampler))
+        , m_profiler(std::make_shared<ControllerProfiler>())
+        , m_scheduler(std::make_shared<ControlScheduler>(geopm_env_ctl_overhead()))
+        , m_last_in_policy(m_num_send_down, NAN)
+        , m_epoch_runtime_idx(-1)
     {
-        // Three dimensional vector over levels, children, and message
-        // index.  These are used as temporary storage when passing
-        // messages up and down the tree.
+        // One matrix per level over children and message index.
+        // These are used as temporary storage when passing messages
+        // up and down the tree.
         for (int level = 0; level != m_num_level_ctl; ++level) {
             int num_children = m_tree_comm->level_size(level);
-            m_out_policy[level] = std::vector<std::vector<double> >(num_children,
-                                                                    std::vector<double>(m_num_send_down));
-            m_in_sample[level] = std::vector<std::vector<double> >(num_children,
-                                                                   std::vector<double>(m_num_send_up));
+            m_out_policy[level].resize(num_children, m_num_send_down);
+            m_in_sample[level].resize(num_children, m_num_send_up);
+        }
+        if (m_agent.size() != 0) {
+            init_aggregate();
         }
     }
 
@@ -157,12 +170,43 @@ namespace geopm
             throw Exception("Kontroller number of agents is incorrect",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        init_aggregate();
+    }
+
+    void Kontroller::init_aggregate(void)
+    {
+        // The samples sent within a level are received by the agent
+        // of that level, so its tolerance applies to them.  A rank
+        // that is not the root also sends at the level above the
+        // ones it controls, and the agent it holds for that level
+        // declares the same tolerance as the parent's agent.
+        for (int level = 0; level < m_max_level && level < (int)m_agent.size(); ++level) {
+            if (level < m_num_level_ctl) {
+                m_agg_func[level] = m_agent[level]->aggregate_function();
+                if (m_agg_func[level].size() != (size_t)m_num_send_up) {
+                    m_agg_func[level].clear();
+                }
+            }
+            if (level < m_root_level) {
+                std::vector<double> tolerance = m_agent[level]->sample_tolerance();
+                if (tolerance.size() == (size_t)m_num_send_up) {
+                    m_tree_comm->sample_tolerance(level, tolerance);
+                }
+            }
+        }
     }
 
     void Kontroller::run(void)
     {
         m_application_io->connect();
+        m_platform_io.register_iogroup(geopm::make_unique<ControllerIOGroup>(m_profiler, m_scheduler));
         init_agents();
+        if (m_scheduler->is_enabled()) {
+            auto signal_names = m_platform_io.signal_names();
+            if (signal_names.find("EPOCH_RUNTIME") != signal_names.end()) {
+                m_epoch_runtime_idx = m_platform_io.push_signal("EPOCH_RUNTIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
+            }
+        }
         m_reporter->init();
         setup_trace();
         m_application_io->controller_ready();
@@ -190,6 +234,12 @@ namespace geopm
         }
 
         auto agent_node_report = m_agent[0]->report_node();
+        auto profile_report = m_profiler->report();
+        agent_node_report.insert(agent_node_report.end(),
+                                 profile_report.begin(), profile_report.end());
+        auto schedule_report = m_scheduler->report();
+        agent_node_report.insert(agent_node_report.end(),
+                                 schedule_report.begin(), schedule_report.end());
 
         m_reporter->generate(m_agent_name,
                              agent_report_header,
@@ -203,17 +253,29 @@ namespace geopm
 
     void Kontroller::step(void)
     {
+        m_profiler->enter(ControllerProfiler::M_PHASE_STEP);
         walk_down();
         geopm_signal_handler_check();
 
         walk_up();
         geopm_signal_handler_check();
+        m_profiler->exit(ControllerProfiler::M_PHASE_STEP);
         m_agent[0]->wait();
+        if (m_scheduler->is_enabled()) {
+            double overhead_time = m_profiler->step_time(ControllerProfiler::M_PHASE_READ_BATCH) +
+                                   m_profiler->step_time(ControllerProfiler::M_PHASE_TREE_SEND) +
+                                   m_profiler->step_time(ControllerProfiler::M_PHASE_TREE_RECEIVE);
+            double epoch_time = m_epoch_runtime_idx != -1 ?
+                                m_platform_io.sample(m_epoch_runtime_idx) : NAN;
+            m_scheduler->update(overhead_time, epoch_time);
+        }
+        m_scheduler->wait();
         geopm_signal_handler_check();
     }
 
     void Kontroller::walk_down(void)
     {
+        m_profiler->enter(ControllerProfiler::M_PHASE_WALK_DOWN);
         bool do_send = false;
         if (m_is_root) {
             /// @todo Pass m_in_policy by reference into the sampler, and return an is_updated bool.
@@ -221,50 +283,92 @@ namespace geopm
             do_send = true;
         }
         else {
+            m_profiler->enter(ControllerProfiler::M_PHASE_TREE_RECEIVE);
             do_send = m_tree_comm->receive_down(m_num_level_ctl, m_in_policy);
+            m_profiler->exit(ControllerProfiler::M_PHASE_TREE_RECEIVE);
         }
         for (int level = m_num_level_ctl - 1; level != -1; --level) {
             if (do_send) {
+                m_profiler->enter(ControllerProfiler::M_PHASE_DESCEND);
                 do_send = m_agent[level]->descend(m_in_policy, m_out_policy[level]);
+                m_profiler->exit(ControllerProfiler::M_PHASE_DESCEND);
             }
             if (do_send) {
+                m_profiler->enter(ControllerProfiler::M_PHASE_TREE_SEND);
                 m_tree_comm->send_down(level, m_out_policy[level]);
+                m_profiler->exit(ControllerProfiler::M_PHASE_TREE_SEND);
             }
+            m_profiler->enter(ControllerProfiler::M_PHASE_TREE_RECEIVE);
             do_send = m_tree_comm->receive_down(level, m_in_policy);
+            m_profiler->exit(ControllerProfiler::M_PHASE_TREE_RECEIVE);
         }
         if (do_send &&
             m_agent[0]->adjust_platform(m_in_policy)) {
+            m_profiler->enter(ControllerProfiler::M_PHASE_WRITE_BATCH);
             m_platform_io.write_batch();
+            m_profiler->exit(ControllerProfiler::M_PHASE_WRITE_BATCH);
+        }
+        // NAN marks an unset policy value and compares equal to itself
+        bool is_policy_changed = m_in_policy.size() != m_last_in_policy.size() ||
+                                 !std::equal(m_in_policy.begin(), m_in_policy.end(),
+                                             m_last_in_policy.begin(),
+                                             [](double lhs, double rhs) {
+                                                 return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+                                             });
+        if (is_policy_changed) {
+            m_last_in_policy = m_in_policy;
         }
+        m_scheduler->record_policy(is_policy_changed);
+        m_profiler->exit(ControllerProfiler::M_PHASE_WALK_DOWN);
     }
 
     void Kontroller::walk_up(void)
     {
+        m_profiler->enter(ControllerProfiler::M_PHASE_WALK_UP);
         m_application_io->update(m_comm);
+        m_profiler->enter(ControllerProfiler::M_PHASE_READ_BATCH);
         m_platform_io.read_batch();
+        m_profiler->exit(ControllerProfiler::M_PHASE_READ_BATCH);
         bool do_send = m_agent[0]->sample_platform(m_out_sample);
         m_agent[0]->trace_values(m_trace_sample);
+        m_profiler->enter(ControllerProfiler::M_PHASE_TRACER_UPDATE);
         m_tracer->update(m_trace_sample, m_application_io->region_info());
+        m_profiler->exit(ControllerProfiler::M_PHASE_TRACER_UPDATE);
         m_application_io->clear_region_info();
 
         for (int level = 0; level != m_num_level_ctl; ++level) {
-            if (do_send) {
+            if (do_send && m_scheduler->do_send_up(level)) {
+                m_profiler->enter(ControllerProfiler::M_PHASE_TREE_SEND);
                 m_tree_comm->send_up(level, m_out_sample);
+                m_profiler->exit(ControllerProfiler::M_PHASE_TREE_SEND);
             }
-            do_send = m_tree_comm->receive_up(level, m_in_sample[level]);
-            if (do_send) {
-                do_send = m_agent[level]->ascend(m_in_sample[level], m_out_sample);
+            m_profiler->enter(ControllerProfiler::M_PHASE_TREE_RECEIVE);
+            if (m_agg_func[level].size() != 0) {
+                do_send = m_tree_comm->receive_up_aggregate(level, m_agg_func[level], m_out_sample);
+                m_profiler->exit(ControllerProfiler::M_PHASE_TREE_RECEIVE);
+            }
+            else {
+                do_send = m_tree_comm->receive_up(level, m_in_sample[level]);
+                m_profiler->exit(ControllerProfiler::M_PHASE_TREE_RECEIVE);
+                if (do_send) {
+                    m_profiler->enter(ControllerProfiler::M_PHASE_ASCEND);
+                    do_send = m_agent[level]->ascend(m_in_sample[level], m_out_sample);
+                    m_profiler->exit(ControllerProfiler::M_PHASE_ASCEND);
+                }
             }
         }
-        if (do_send) {
+        if (do_send && m_scheduler->do_send_up(m_num_level_ctl)) {
             if (!m_is_root) {
+                m_profiler->enter(ControllerProfiler::M_PHASE_TREE_SEND);
                 m_tree_comm->send_up(m_num_level_ctl, m_out_sample);
+                m_profiler->exit(ControllerProfiler::M_PHASE_TREE_SEND);
             }
             else {
                 /// @todo At the root of the tree, send signals up to the
                 /// resource manager.
             }
         }
+        m_profiler->exit(ControllerProfiler::M_PHASE_WALK_UP);
     }
 
     void Kontroller::pthread(const pthread_attr_t *attr, pthread_t *thread)
@@ -39,6 +39,9 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <functional>
+
+#include "MessageMatrix.hpp"
 
 namespace geopm
 {
@@ -53,6 +56,8 @@ namespace geopm
     class ITracer;
     class ITreeComm;
     class IAgent;
+    class ControllerProfiler;
+    class ControlScheduler;
 
     class Kontroller
     {
@@ -110,6 +115,9 @@ namespace geopm
             /// parents.
             void walk_up(void);
             /// @brief Write the report file and finalize the trace.
+            ///
+            /// The latency of each phase of the control loop is
+            /// added to the host section of the report.
             void generate(void);
             /// @brief Run control algorithm as a separate thread.
             ///
@@ -131,6 +139,11 @@ namespace geopm
             void setup_trace(void);
         private:
             void init_agents(void);
+            /// @brief Query the Agent at each controlled level for
+            ///        the functions used to aggregate samples within
+            ///        the ITreeComm, and pass the sample tolerance of
+            ///        the leaf Agent to the ITreeComm.
+            void init_aggregate(void);
 
             std::shared_ptr<IComm> m_comm;
             IPlatformTopo &m_platform_topo;
@@ -148,15 +161,29 @@ namespace geopm
             std::vector<std::unique_ptr<IAgent> > m_agent;
             const bool m_is_root;
             std::vector<double> m_in_policy;
-            std::vector<std::vector<std::vector<double> > > m_out_policy;
-            std::vector<std::vector<std::vector<double> > > m_in_sample;
+            std::vector<MessageMatrix> m_out_policy;
+            std::vector<MessageMatrix> m_in_sample;
             std::vector<double> m_out_sample;
+            /// Per level sample aggregation functions; empty for
+            /// levels where samples are combined by IAgent::ascend().
+            std::vector<std::vector<std::function<double(const std::vector<double> &)> > > m_agg_func;
             std::vector<double> m_trace_sample;
 
             std::unique_ptr<IManagerIOSampler> m_manager_io_sampler;
 
             std::vector<std::string> m_agent_policy_names;
             std::vector<std::string> m_agent_sample_names;
+            /// Latency of each phase of step(); shared with the
+            /// ControllerIOGroup registered in run().
+            std::shared_ptr<ControllerProfiler> m_profiler;
+            /// Chooses the period of step() and the tree levels
+            /// that send samples; shared with the ControllerIOGroup.
+            std::shared_ptr<ControlScheduler> m_scheduler;
+            /// Policy received in the previous walk_down().
+            std::vector<double> m_last_in_policy;
+            /// PlatformIO index of EPOCH_RUNTIME used by the
+            /// scheduler, or -1 if not pushed.
+            int m_epoch_runtime_idx;
     };
 }
 #endif
@@ -178,19 +178,9 @@ namespace geopm
             }
         }
         if (m_do_read[M_SIGNAL_RUNTIME]) {
-            std::map<uint64_t, std::vector<double> > cache;
-            for (auto rid : m_per_cpu_region_id) {
-                // add runtimes for each region if not already present
-                auto it = cache.find(rid);
-                if (it == cache.end()) {
-                    cache.emplace(std::piecewise_construct,
-                                  std::forward_as_tuple(rid),
-                                  std::forward_as_tuple(m_profile_sample->per_cpu_runtime(rid)));
-                }
-            }
-            for (size_t cpu = 0; cpu < m_per_cpu_runtime.size(); ++cpu) {
-                m_per_cpu_runtime[cpu] = cache.at(m_per_cpu_region_id[cpu])[cpu];
-            }
+            // Maintained incrementally by the sample object, so this
+            // is a copy into existing storage.
+            m_per_cpu_runtime = m_profile_sample->per_cpu_current_runtime();
         }
         m_is_batch_read = true;
     }
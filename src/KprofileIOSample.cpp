@@ -30,6 +30,8 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <math.h>
+
 #include <set>
 #include <algorithm>
 
@@ -42,6 +44,7 @@
 #include "KruntimeRegulator.hpp"
 #include "PlatformIO.hpp"
 #include "Helper.hpp"
+#include "Exception.hpp"
 #include "config.h"
 
 namespace geopm
@@ -52,13 +55,30 @@ namespace geopm
         // This object is created when app connects
         geopm_time(&m_app_start_time);
 
-        m_rank_idx_map = ProfileIO::rank_to_node_local_rank(cpu_rank);
+        std::map<int, int> rank_idx_map = ProfileIO::rank_to_node_local_rank(cpu_rank);
         m_cpu_rank = ProfileIO::rank_to_node_local_rank_per_cpu(cpu_rank);
-        m_num_rank = m_rank_idx_map.size();
+        m_num_rank = rank_idx_map.size();
+        m_rank_offset = m_num_rank ? rank_idx_map.begin()->first : 0;
+        if (m_num_rank) {
+            m_rank_idx.resize(rank_idx_map.rbegin()->first - m_rank_offset + 1, -1);
+        }
+        for (const auto &rank_idx : rank_idx_map) {
+            m_rank_idx[rank_idx.first - m_rank_offset] = rank_idx.second;
+        }
 
         // 2 samples for linear interpolation
-        m_rank_sample_buffer.resize(m_num_rank, CircularBuffer<struct m_rank_sample_s>(2));
+        m_rank_sample_buffer.resize(m_num_rank);
         m_region_id.resize(m_num_rank, GEOPM_REGION_ID_UNMARKED);
+        m_rank_cpu.resize(m_num_rank);
+        for (size_t cpu_idx = 0; cpu_idx != m_cpu_rank.size(); ++cpu_idx) {
+            int rank = m_cpu_rank[cpu_idx];
+            // CPUs that are not bound to a rank are marked with -1
+            if (rank >= 0 && rank < (int)m_num_rank) {
+                m_rank_cpu[rank].push_back(cpu_idx);
+            }
+        }
+        m_is_runtime_stale.resize(m_num_rank, false);
+        m_per_cpu_runtime.resize(m_cpu_rank.size(), 0.0);
     }
 
     KprofileIOSample::~KprofileIOSample()
@@ -76,21 +96,25 @@ namespace geopm
                 m_epoch_regulator.record_exit(GEOPM_REGION_ID_UNMARKED, rank, time);
             }
             m_epoch_regulator.epoch(rank, time);
+            m_is_runtime_stale[rank] = true;
         }
+        update_runtime();
     }
 
     void KprofileIOSample::update(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_begin,
                                   std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_end)
     {
         for (auto sample_it = prof_sample_begin; sample_it != prof_sample_end; ++sample_it) {
-            auto rank_idx_it = m_rank_idx_map.find(sample_it->second.rank);
+            // Negative offsets wrap to large values and fail the
+            // bounds check.
+            size_t rank_offset = (size_t)(sample_it->second.rank - m_rank_offset);
 #ifdef GEOPM_DEBUG
-            if (rank_idx_it == m_rank_idx_map.end()) {
+            if (rank_offset >= m_rank_idx.size() || m_rank_idx[rank_offset] == -1) {
                 throw Exception("KprofileIOSample::update(): invalid profile sample data",
                                 GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
             }
 #endif
-            size_t local_rank = rank_idx_it->second;
+            size_t local_rank = m_rank_idx[rank_offset];
             uint64_t region_id = sample_it->second.region_id;
             if (geopm_region_id_is_epoch(region_id)) {
                 m_epoch_regulator.epoch(local_rank, sample_it->second.timestamp);
@@ -124,6 +148,35 @@ namespace geopm
                     m_region_id[local_rank] = region_id;
                 }
                 m_rank_sample_buffer[local_rank].insert(rank_sample);
+                m_is_runtime_stale[local_rank] = true;
+            }
+        }
+        update_runtime();
+    }
+
+    void KprofileIOSample::update_runtime(void)
+    {
+        // Ranks are usually in the same region, so reuse the last
+        // region's runtimes rather than querying for each rank.
+        uint64_t cached_region_id = GEOPM_REGION_ID_UNDEFINED;
+        std::vector<double> cached_runtime;
+        for (size_t rank = 0; rank != m_num_rank; ++rank) {
+            if (!m_is_runtime_stale[rank]) {
+                continue;
+            }
+            m_is_runtime_stale[rank] = false;
+            if (m_region_id[rank] != cached_region_id) {
+                cached_region_id = m_region_id[rank];
+                try {
+                    cached_runtime = m_epoch_regulator.region_regulator(cached_region_id).per_rank_last_runtime();
+                }
+                catch (const Exception &ex) {
+                    // Region progress was reported without an entry.
+                    cached_runtime.assign(m_num_rank, NAN);
+                }
+            }
+            for (auto cpu_idx : m_rank_cpu[rank]) {
+                m_per_cpu_runtime[cpu_idx] = cached_runtime[rank];
             }
         }
     }
@@ -227,6 +280,11 @@ namespace geopm
         return result;
     }
 
+    const std::vector<double> &KprofileIOSample::per_cpu_current_runtime(void) const
+    {
+        return m_per_cpu_runtime;
+    }
+
     double KprofileIOSample::total_app_runtime(void) const
     {
         geopm_time_s curr_time{{0, 0}};
@@ -42,7 +42,7 @@
 
 namespace geopm
 {
-    template <typename T> class CircularBuffer;
+    template <class type, size_t max_size> class FixedCircularBuffer;
     class IEpochRuntimeRegulator;
 
     class IKprofileIOSample
@@ -69,6 +69,13 @@ namespace geopm
             ///        for the rank running on each CPU.
             /// @param [in] region_id Region ID for the region of interest.
             virtual std::vector<double> per_cpu_runtime(uint64_t region_id) const = 0;
+            /// @brief Return the last runtime of the region that
+            ///        the rank running on each CPU is currently in.
+            ///
+            /// The values are maintained by update() and are only
+            /// recomputed for ranks that reported new samples, so
+            /// reading them does not query the region regulators.
+            virtual const std::vector<double> &per_cpu_current_runtime(void) const = 0;
             /// @brief Return the total time from the start of the
             ///        application until now.
             virtual double total_app_runtime(void) const = 0;
@@ -87,6 +94,7 @@ namespace geopm
             std::vector<uint64_t> per_cpu_region_id(void) const override;
             std::vector<double> per_cpu_progress(const struct geopm_time_s &extrapolation_time) const override;
             std::vector<double> per_cpu_runtime(uint64_t region_id) const override;
+            const std::vector<double> &per_cpu_current_runtime(void) const override;
             double total_app_runtime(void) const override;
             std::vector<int> cpu_rank(void) const override;
         private:
@@ -100,12 +108,18 @@ namespace geopm
                 M_INTERP_TYPE_LINEAR = 2,
             };
             std::vector<double> per_rank_progress(const struct geopm_time_s &extrapolation_time) const;
+            /// @brief Refresh m_per_cpu_runtime for the ranks marked
+            ///        in m_is_runtime_stale.
+            void update_runtime(void);
 
             struct geopm_time_s m_app_start_time;
-            /// @brief A map from the MPI rank reported in the
-            ///        ProfileSampler data to the node local rank
-            ///        index.
-            std::map<int, int> m_rank_idx_map;
+            /// @brief Dense lookup from the MPI rank reported in the
+            ///        ProfileSampler data, less m_rank_offset, to the
+            ///        node local rank index.  Ranks that are not on
+            ///        the node map to -1.
+            std::vector<int> m_rank_idx;
+            /// @brief Lowest MPI rank running on the node.
+            int m_rank_offset;
             IEpochRuntimeRegulator &m_epoch_regulator;
             /// @brief The rank index of the rank running on each CPU.
             std::vector<int> m_cpu_rank;
@@ -113,11 +127,19 @@ namespace geopm
             size_t m_num_rank;
             /// @brief Per rank record of last profile samples in
             ///        m_region_id_prev
-            std::vector<CircularBuffer<struct m_rank_sample_s> > m_rank_sample_buffer;
+            std::vector<FixedCircularBuffer<struct m_rank_sample_s, 2> > m_rank_sample_buffer;
             /// @brief The region_id of each rank derived from the
             ///        stored ProfileSampler data used for
             ///        extrapolation.
             std::vector<uint64_t> m_region_id;
+            /// @brief The CPUs that each rank is running on.
+            std::vector<std::vector<int> > m_rank_cpu;
+            /// @brief Per rank flag set when a sample may have
+            ///        changed the rank's current region runtime.
+            std::vector<bool> m_is_runtime_stale;
+            /// @brief Last runtime of the current region of the rank
+            ///        running on each CPU.
+            std::vector<double> m_per_cpu_runtime;
     };
 }
 
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+
+#include <algorithm>
+
+#include "LatencyHistogram.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    LatencyHistogram::LatencyHistogram()
+        : m_bucket_count(M_NUM_BUCKET, 0)
+        , m_count(0)
+        , m_total_ns(0)
+        , m_max_ns(0)
+    {
+
+    }
+
+    int LatencyHistogram::bucket(uint64_t latency_ns)
+    {
+        int result = latency_ns;
+        if (latency_ns >= M_NUM_SUB_BUCKET) {
+            int msb = 63 - __builtin_clzll(latency_ns);
+            int shift = msb - M_SUB_BUCKET_BITS;
+            result = (shift + 1) * M_NUM_SUB_BUCKET +
+                     ((latency_ns >> shift) & (M_NUM_SUB_BUCKET - 1));
+        }
+        return result;
+    }
+
+    uint64_t LatencyHistogram::bucket_max(int bucket_idx)
+    {
+        uint64_t result = bucket_idx;
+        if (bucket_idx >= M_NUM_SUB_BUCKET) {
+            int shift = bucket_idx / M_NUM_SUB_BUCKET - 1;
+            uint64_t mantissa = M_NUM_SUB_BUCKET + bucket_idx % M_NUM_SUB_BUCKET;
+            // Written so that the last bucket does not overflow.
+            result = (mantissa << shift) + ((1ULL << shift) - 1);
+        }
+        return result;
+    }
+
+    void LatencyHistogram::insert(double latency)
+    {
+        double latency_ns_dbl = latency * 1E9 + 0.5;
+        uint64_t latency_ns = 0;
+        if (latency_ns_dbl >= (double)UINT64_MAX) {
+            latency_ns = UINT64_MAX;
+        }
+        else if (latency_ns_dbl >= 1.0) {
+            latency_ns = (uint64_t)latency_ns_dbl;
+        }
+        ++m_bucket_count[bucket(latency_ns)];
+        ++m_count;
+        m_total_ns += latency_ns;
+        if (latency_ns > m_max_ns) {
+            m_max_ns = latency_ns;
+        }
+    }
+
+    void LatencyHistogram::clear(void)
+    {
+        std::fill(m_bucket_count.begin(), m_bucket_count.end(), 0);
+        m_count = 0;
+        m_total_ns = 0;
+        m_max_ns = 0;
+    }
+
+    uint64_t LatencyHistogram::count(void) const
+    {
+        return m_count;
+    }
+
+    double LatencyHistogram::total(void) const
+    {
+        return m_total_ns * 1E-9;
+    }
+
+    double LatencyHistogram::max(void) const
+    {
+        return m_max_ns * 1E-9;
+    }
+
+    double LatencyHistogram::percentile(double fraction) const
+    {
+        if (fraction < 0.0 || fraction > 1.0) {
+            throw Exception("LatencyHistogram::percentile(): fraction must be between 0 and 1",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        double result = NAN;
+        if (m_count) {
+            uint64_t rank = (uint64_t)ceil(fraction * m_count);
+            if (rank == 0) {
+                rank = 1;
+            }
+            uint64_t cumulative = 0;
+            int bucket_idx = 0;
+            for (; bucket_idx != M_NUM_BUCKET; ++bucket_idx) {
+                cumulative += m_bucket_count[bucket_idx];
+                if (cumulative >= rank) {
+                    break;
+                }
+            }
+            uint64_t result_ns = bucket_max(bucket_idx);
+            if (result_ns > m_max_ns) {
+                result_ns = m_max_ns;
+            }
+            result = result_ns * 1E-9;
+        }
+        return result;
+    }
+}
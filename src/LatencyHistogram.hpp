@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LATENCYHISTOGRAM_HPP_INCLUDE
+#define LATENCYHISTOGRAM_HPP_INCLUDE
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Fixed size histogram of latencies with log-linear
+    ///        buckets.
+    ///
+    /// Latencies are recorded with nanosecond resolution.  Each
+    /// power of two range is split into 2^M_SUB_BUCKET_BITS equal
+    /// buckets, so a percentile is reported with a relative error
+    /// of at most 1 / 2^M_SUB_BUCKET_BITS over the full range of a
+    /// 64 bit integer.  Inserting a value is constant time and
+    /// never allocates, so the histogram can be updated on the
+    /// critical path of the controller or the application.
+    class LatencyHistogram
+    {
+        public:
+            LatencyHistogram();
+            virtual ~LatencyHistogram() = default;
+            /// @brief Record one latency.
+            /// @param [in] latency Latency in seconds; negative
+            ///        values are recorded as zero.
+            void insert(double latency);
+            /// @brief Remove all recorded latencies.
+            void clear(void);
+            /// @brief Number of latencies recorded.
+            uint64_t count(void) const;
+            /// @brief Sum of all latencies recorded in seconds.
+            double total(void) const;
+            /// @brief Largest latency recorded in seconds.
+            double max(void) const;
+            /// @brief Latency in seconds that is not exceeded by
+            ///        the given fraction of recorded values.
+            ///
+            /// The upper bound of the bucket holding the requested
+            /// rank is returned, limited to max().
+            ///
+            /// @param [in] fraction Value between 0 and 1, e.g.
+            ///        0.99 for the 99th percentile.
+            ///
+            /// @return Percentile in seconds or NAN if no values
+            ///         have been recorded.
+            double percentile(double fraction) const;
+        private:
+            enum m_bucket_e {
+                M_SUB_BUCKET_BITS = 4,
+                M_NUM_SUB_BUCKET = 1 << M_SUB_BUCKET_BITS,
+                M_NUM_BUCKET = (64 - M_SUB_BUCKET_BITS + 1) * M_NUM_SUB_BUCKET,
+            };
+            static int bucket(uint64_t latency_ns);
+            static uint64_t bucket_max(int bucket_idx);
+            std::vector<uint64_t> m_bucket_count;
+            uint64_t m_count;
+            uint64_t m_total_ns;
+            uint64_t m_max_ns;
+    };
+}
+
+#endif
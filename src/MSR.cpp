@@ -201,6 +201,7 @@ namespace geopm
         , m_offset(offset)
         , m_signal_encode(signal.size(), NULL)
         , m_control_encode(control.size())
+        , m_signal_field(signal.size())
         , m_domain_type(IPlatformTopo::M_DOMAIN_INVALID)
         , m_prog_msr(0)
         , m_prog_field_name(0)
@@ -228,6 +229,7 @@ namespace geopm
         for (auto it = signal.begin(); it != signal.end(); ++it, ++idx) {
             m_signal_map.insert(std::pair<std::string, int>(it->first, idx));
             m_signal_encode[idx] = new MSREncode(it->second);
+            m_signal_field[idx] = it->second;
         }
         idx = 0;
         for (auto it = control.begin(); it != control.end(); ++it, ++idx) {
@@ -352,6 +354,15 @@ namespace geopm
         return m_signal_encode[signal_idx]->decode_function();
     }
 
+    struct IMSR::m_encode_s MSR::signal_encode(int signal_idx) const
+    {
+        if (signal_idx < 0 || signal_idx >= num_signal()) {
+            throw Exception("MSR::signal_encode(): signal_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_signal_field[signal_idx];
+    }
+
     MSRSignal::MSRSignal(const IMSR &msr_obj,
                          int domain_type,
                          int cpu_idx,
@@ -428,6 +439,11 @@ namespace geopm
         m_is_field_mapped = true;
     }
 
+    struct IMSR::m_encode_s MSRSignal::encode(void) const
+    {
+        return m_msr_obj.signal_encode(m_signal_idx);
+    }
+
     MSRControl::MSRControl(const IMSR &msr_obj,
                            int domain_type,
                            int cpu_idx,
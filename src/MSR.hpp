@@ -141,6 +141,11 @@ namespace geopm
             /// @brief The function used to decode the MSR value as defined
             ///        in the m_function_e enum.
             virtual int decode_function(int signal_idx) const = 0;
+            /// @brief Query the encoding of a signal bit field.
+            /// @param [in] signal_idx Index of the signal bit field.
+            /// @return The structure that describes the bit field
+            ///         and how it is decoded.
+            virtual struct m_encode_s signal_encode(int signal_idx) const = 0;
     };
 
     class IMSRSignal
@@ -173,6 +178,11 @@ namespace geopm
             /// @param [in] Pointer to the memory containing the raw
             ///        MSR value.
             virtual void map_field(const uint64_t *field) = 0;
+            /// @brief Get the encoding of the bit field within the
+            ///        MSR that provides the signal.
+            /// @return The structure describing the bit field and
+            ///         the decode function.
+            virtual struct IMSR::m_encode_s encode(void) const = 0;
     };
 
     class IMSRControl
@@ -249,6 +259,7 @@ namespace geopm
                          uint64_t &mask) const override;
             int domain_type(void) const override;
             int decode_function(int signal_idx) const override;
+            struct m_encode_s signal_encode(int signal_idx) const override;
         private:
             void init(const std::vector<std::pair<std::string, struct IMSR::m_encode_s> > &signal,
                       const std::vector<std::pair<std::string, struct IMSR::m_encode_s> > &control);
@@ -256,6 +267,7 @@ namespace geopm
             uint64_t m_offset;
             std::vector<MSREncode *> m_signal_encode;
             std::vector<MSREncode *> m_control_encode;
+            std::vector<struct m_encode_s> m_signal_field;
             std::map<std::string, int> m_signal_map;
             std::map<std::string, int> m_control_map;
             int m_domain_type;
@@ -292,6 +304,7 @@ namespace geopm
             double sample(void) override;
             uint64_t offset(void) const override;
             void map_field(const uint64_t *field) override;
+            struct IMSR::m_encode_s encode(void) const override;
         private:
             const std::string m_name;
             const IMSR &m_msr_obj;
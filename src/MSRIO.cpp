@@ -38,6 +38,7 @@
 #include <string.h>
 #include <sstream>
 #include <map>
+#include <algorithm>
 
 #include "Exception.hpp"
 #include "MSRIO.hpp"
@@ -62,6 +63,7 @@ namespace geopm
         , m_write_batch({0, NULL})
         , m_read_batch_op(0)
         , m_write_batch_op(0)
+        , m_batch_time({{0, 0}})
     {
 
     }
@@ -184,9 +186,8 @@ namespace geopm
 
     void MSRIO::read_batch(std::vector<uint64_t> &raw_value)
     {
-        if (raw_value.size() < m_read_batch.numops) {
-            raw_value.resize(m_read_batch.numops);
-        }
+        raw_value.resize(m_read_batch.numops);
+        geopm_time(&m_batch_time);
         open_msr_batch();
         if (m_is_batch_enabled) {
             msr_ioctl(true);
@@ -240,6 +241,11 @@ namespace geopm
         }
     }
 
+    struct geopm_time_s MSRIO::batch_time(void) const
+    {
+        return m_batch_time;
+    }
+
     int MSRIO::msr_desc(int cpu_idx)
     {
         if (cpu_idx < 0 || cpu_idx > m_num_cpu) {
@@ -336,4 +342,222 @@ namespace geopm
             m_file_desc[m_num_cpu] = -1;
         }
     }
+
+    AsyncMSRIO::AsyncMSRIO(std::unique_ptr<IMSRIO> msrio)
+        : m_msrio(std::move(msrio))
+        , m_io_lock(PTHREAD_MUTEX_INITIALIZER)
+        , m_state_lock(PTHREAD_MUTEX_INITIALIZER)
+        , m_state_cond(PTHREAD_COND_INITIALIZER)
+        , m_is_thread_running(false)
+        , m_is_request(false)
+        , m_is_shutdown(false)
+        , m_is_primed(false)
+        , m_batch_buffer_time({{0, 0}})
+        , m_batch_time({{0, 0}})
+    {
+        if (!m_msrio) {
+            throw Exception("AsyncMSRIO: msrio pointer is NULL",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    AsyncMSRIO::~AsyncMSRIO()
+    {
+        if (m_is_thread_running) {
+            (void)pthread_mutex_lock(&m_state_lock);
+            m_is_shutdown = true;
+            (void)pthread_cond_broadcast(&m_state_cond);
+            (void)pthread_mutex_unlock(&m_state_lock);
+            (void)pthread_join(m_thread, NULL);
+        }
+        (void)pthread_cond_destroy(&m_state_cond);
+        (void)pthread_mutex_destroy(&m_state_lock);
+        (void)pthread_mutex_destroy(&m_io_lock);
+    }
+
+    uint64_t AsyncMSRIO::read_msr(int cpu_idx,
+                                  uint64_t offset)
+    {
+        lock(m_io_lock);
+        uint64_t result = 0;
+        try {
+            result = m_msrio->read_msr(cpu_idx, offset);
+        }
+        catch (...) {
+            unlock(m_io_lock);
+            throw;
+        }
+        unlock(m_io_lock);
+        return result;
+    }
+
+    void AsyncMSRIO::write_msr(int cpu_idx,
+                               uint64_t offset,
+                               uint64_t raw_value,
+                               uint64_t write_mask)
+    {
+        lock(m_io_lock);
+        try {
+            m_msrio->write_msr(cpu_idx, offset, raw_value, write_mask);
+        }
+        catch (...) {
+            unlock(m_io_lock);
+            throw;
+        }
+        unlock(m_io_lock);
+    }
+
+    void AsyncMSRIO::config_batch(const std::vector<int> &read_cpu_idx,
+                                  const std::vector<uint64_t> &read_offset,
+                                  const std::vector<int> &write_cpu_idx,
+                                  const std::vector<uint64_t> &write_offset,
+                                  const std::vector<uint64_t> &write_mask)
+    {
+        if (m_is_primed) {
+            // Discard the outstanding read of the old configuration.
+            try {
+                wait_batch();
+            }
+            catch (...) {
+
+            }
+            m_is_primed = false;
+        }
+        lock(m_io_lock);
+        try {
+            m_msrio->config_batch(read_cpu_idx, read_offset,
+                                  write_cpu_idx, write_offset, write_mask);
+        }
+        catch (...) {
+            unlock(m_io_lock);
+            throw;
+        }
+        unlock(m_io_lock);
+    }
+
+    void AsyncMSRIO::read_batch(std::vector<uint64_t> &raw_value)
+    {
+        if (m_is_primed) {
+            wait_batch();
+        }
+        else {
+            lock(m_io_lock);
+            try {
+                m_msrio->read_batch(m_batch_buffer);
+                m_batch_buffer_time = m_msrio->batch_time();
+            }
+            catch (...) {
+                unlock(m_io_lock);
+                throw;
+            }
+            unlock(m_io_lock);
+        }
+        raw_value.resize(m_batch_buffer.size());
+        std::copy(m_batch_buffer.begin(), m_batch_buffer.end(), raw_value.begin());
+        m_batch_time = m_batch_buffer_time;
+        start_batch();
+        m_is_primed = true;
+    }
+
+    void AsyncMSRIO::write_batch(const std::vector<uint64_t> &raw_value)
+    {
+        lock(m_io_lock);
+        try {
+            m_msrio->write_batch(raw_value);
+        }
+        catch (...) {
+            unlock(m_io_lock);
+            throw;
+        }
+        unlock(m_io_lock);
+    }
+
+    struct geopm_time_s AsyncMSRIO::batch_time(void) const
+    {
+        return m_batch_time;
+    }
+
+    void *AsyncMSRIO::run(void *self)
+    {
+        ((AsyncMSRIO *)self)->run();
+        return NULL;
+    }
+
+    void AsyncMSRIO::run(void)
+    {
+        pthread_mutex_lock(&m_state_lock);
+        while (true) {
+            while (!m_is_request && !m_is_shutdown) {
+                pthread_cond_wait(&m_state_cond, &m_state_lock);
+            }
+            if (m_is_shutdown) {
+                break;
+            }
+            pthread_mutex_unlock(&m_state_lock);
+
+            std::exception_ptr batch_error;
+            pthread_mutex_lock(&m_io_lock);
+            try {
+                m_msrio->read_batch(m_batch_buffer);
+                m_batch_buffer_time = m_msrio->batch_time();
+            }
+            catch (...) {
+                batch_error = std::current_exception();
+            }
+            pthread_mutex_unlock(&m_io_lock);
+
+            pthread_mutex_lock(&m_state_lock);
+            m_batch_error = batch_error;
+            m_is_request = false;
+            pthread_cond_broadcast(&m_state_cond);
+        }
+        pthread_mutex_unlock(&m_state_lock);
+    }
+
+    void AsyncMSRIO::start_batch(void)
+    {
+        if (!m_is_thread_running) {
+            int err = pthread_create(&m_thread, NULL, AsyncMSRIO::run, (void *)this);
+            if (err) {
+                throw Exception("AsyncMSRIO::start_batch(): pthread_create() failed",
+                                err, __FILE__, __LINE__);
+            }
+            m_is_thread_running = true;
+        }
+        lock(m_state_lock);
+        m_is_request = true;
+        (void)pthread_cond_broadcast(&m_state_cond);
+        unlock(m_state_lock);
+    }
+
+    void AsyncMSRIO::wait_batch(void)
+    {
+        lock(m_state_lock);
+        while (m_is_request) {
+            (void)pthread_cond_wait(&m_state_cond, &m_state_lock);
+        }
+        std::exception_ptr batch_error = m_batch_error;
+        m_batch_error = nullptr;
+        unlock(m_state_lock);
+        if (batch_error) {
+            m_is_primed = false;
+            std::rethrow_exception(batch_error);
+        }
+    }
+
+    void AsyncMSRIO::lock(pthread_mutex_t &mutex)
+    {
+        int err = pthread_mutex_lock(&mutex);
+        if (err) {
+            throw Exception("AsyncMSRIO: pthread_mutex_lock()", err, __FILE__, __LINE__);
+        }
+    }
+
+    void AsyncMSRIO::unlock(pthread_mutex_t &mutex)
+    {
+        int err = pthread_mutex_unlock(&mutex);
+        if (err) {
+            throw Exception("AsyncMSRIO: pthread_mutex_unlock()", err, __FILE__, __LINE__);
+        }
+    }
 }
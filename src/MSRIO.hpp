@@ -34,8 +34,13 @@
 #define MSRIO_HPP_INCLUDE
 
 #include <stdint.h>
+#include <pthread.h>
 #include <string>
 #include <vector>
+#include <memory>
+#include <exception>
+
+#include "geopm_time.h"
 
 namespace geopm
 {
@@ -98,6 +103,11 @@ namespace geopm
             /// @param [in] raw_value The raw encoded MSR values to be
             ///        written.
             virtual void write_batch(const std::vector<uint64_t> &raw_value) = 0;
+            /// @brief Time at which the values most recently returned
+            ///        by read_batch() were read from the MSRs.
+            /// @return Time stamp taken just before the batch read
+            ///         was issued.
+            virtual struct geopm_time_s batch_time(void) const = 0;
     };
 
     class MSRIO : public IMSRIO
@@ -119,6 +129,7 @@ namespace geopm
                               const std::vector<uint64_t> &write_mask) override;
             void read_batch(std::vector<uint64_t> &raw_value) override;
             void write_batch(const std::vector<uint64_t> &raw_value) override;
+            struct geopm_time_s batch_time(void) const override;
         private:
             struct m_msr_batch_op_s {
                 uint16_t cpu;      /// @brief In: CPU to execute {rd/wr}msr ins.
@@ -153,6 +164,73 @@ namespace geopm
             struct m_msr_batch_array_s m_write_batch;
             std::vector<struct m_msr_batch_op_s> m_read_batch_op;
             std::vector<struct m_msr_batch_op_s> m_write_batch_op;
+            struct geopm_time_s m_batch_time;
+    };
+
+    /// @brief IMSRIO decorator that pipelines batch reads on a
+    ///        helper thread.
+    ///
+    /// Each call to read_batch() returns the values gathered by the
+    /// batch read that was issued at the end of the previous call and
+    /// then immediately issues the next batch read on a helper
+    /// thread.  This overlaps the cost of the ioctl() or the per-MSR
+    /// pread() fallback with the work the caller does between
+    /// samples, at the cost of the returned values being one call
+    /// old.  The first call after config_batch() reads synchronously
+    /// so valid data is always returned.  The time at which each
+    /// returned batch was acquired is available from batch_time().
+    /// All other operations are forwarded to the wrapped object and
+    /// are serialized with the helper thread.
+    class AsyncMSRIO : public IMSRIO
+    {
+        public:
+            /// @brief Constructor for the AsyncMSRIO.
+            /// @param [in] msrio The object used to access the
+            ///        MSRs; ownership is transferred.
+            AsyncMSRIO(std::unique_ptr<IMSRIO> msrio);
+            /// @brief Waits for any outstanding batch read and
+            ///        stops the helper thread.
+            virtual ~AsyncMSRIO();
+            uint64_t read_msr(int cpu_idx,
+                              uint64_t offset) override;
+            void write_msr(int cpu_idx,
+                           uint64_t offset,
+                           uint64_t raw_value,
+                           uint64_t write_mask) override;
+            void config_batch(const std::vector<int> &read_cpu_idx,
+                              const std::vector<uint64_t> &read_offset,
+                              const std::vector<int> &write_cpu_idx,
+                              const std::vector<uint64_t> &write_offset,
+                              const std::vector<uint64_t> &write_mask) override;
+            void read_batch(std::vector<uint64_t> &raw_value) override;
+            void write_batch(const std::vector<uint64_t> &raw_value) override;
+            struct geopm_time_s batch_time(void) const override;
+        private:
+            static void *run(void *self);
+            void run(void);
+            void start_batch(void);
+            void wait_batch(void);
+            void lock(pthread_mutex_t &mutex);
+            void unlock(pthread_mutex_t &mutex);
+
+            std::unique_ptr<IMSRIO> m_msrio;
+            /// @brief Serializes access to m_msrio.
+            pthread_mutex_t m_io_lock;
+            /// @brief Protects the request state shared with the
+            ///        helper thread.
+            pthread_mutex_t m_state_lock;
+            pthread_cond_t m_state_cond;
+            pthread_t m_thread;
+            bool m_is_thread_running;
+            bool m_is_request;
+            bool m_is_shutdown;
+            /// @brief True when m_batch_buffer holds a completed
+            ///        read that has not been returned.
+            bool m_is_primed;
+            std::vector<uint64_t> m_batch_buffer;
+            struct geopm_time_s m_batch_buffer_time;
+            struct geopm_time_s m_batch_time;
+            std::exception_ptr m_batch_error;
     };
 }
 
@@ -37,10 +37,13 @@
 #include <sstream>
 #include <algorithm>
 #include <utility>
+#include <tuple>
 #include <iomanip>
 #include <sstream>
 
 #include "geopm_sched.h"
+#include "geopm_env.h"
+#include "geopm_time.h"
 #include "Exception.hpp"
 #include "MSR.hpp"
 #include "MSRIOGroup.hpp"
@@ -58,8 +61,17 @@ namespace geopm
     const MSR *msr_snb(size_t &num_msr);
     static const MSR *init_msr_arr(int cpu_id, size_t &arr_size);
 
+    static std::unique_ptr<IMSRIO> make_msrio(void)
+    {
+        std::unique_ptr<IMSRIO> result(new MSRIO);
+        if (geopm_env_do_msr_async()) {
+            result = std::unique_ptr<IMSRIO>(new AsyncMSRIO(std::move(result)));
+        }
+        return result;
+    }
+
     MSRIOGroup::MSRIOGroup()
-        : MSRIOGroup(platform_topo(), std::unique_ptr<IMSRIO>(new MSRIO), cpuid(), geopm_sched_num_cpu())
+        : MSRIOGroup(platform_topo(), make_msrio(), cpuid(), geopm_sched_num_cpu())
     {
 
     }
@@ -72,6 +84,9 @@ namespace geopm
         , m_msrio(std::move(msrio))
         , m_cpuid(cpuid)
         , m_name_prefix(plugin_name() + "::")
+        , m_sample_age_name(m_name_prefix + "SAMPLE_AGE")
+        , m_sample_age_idx(-1)
+        , m_sample_age(NAN)
     {
         size_t num_msr = 0;
         const MSR *msr_arr = init_msr_arr(cpuid, num_msr);
@@ -118,6 +133,7 @@ namespace geopm
         for (const auto &sv : m_name_cpu_signal_map) {
             result.insert(sv.first);
         }
+        result.insert(m_sample_age_name);
         return result;
     }
 
@@ -132,7 +148,8 @@ namespace geopm
 
     bool MSRIOGroup::is_valid_signal(const std::string &signal_name) const
     {
-        return m_name_cpu_signal_map.find(signal_name) != m_name_cpu_signal_map.end();
+        return signal_name == m_sample_age_name ||
+               m_name_cpu_signal_map.find(signal_name) != m_name_cpu_signal_map.end();
     }
 
     bool MSRIOGroup::is_valid_control(const std::string &control_name) const
@@ -147,6 +164,9 @@ namespace geopm
         if (it != m_name_cpu_signal_map.end()) {
             result = it->second[0]->domain_type();
         }
+        else if (signal_name == m_sample_age_name) {
+            result = IPlatformTopo::M_DOMAIN_BOARD;
+        }
         return result;
     }
 
@@ -166,6 +186,20 @@ namespace geopm
             throw Exception("MSRIOGroup::push_signal(): cannot push a signal after read_batch() or adjust() has been called.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        if (signal_name == m_sample_age_name) {
+            if (domain_type != IPlatformTopo::M_DOMAIN_BOARD) {
+                throw Exception("MSRIOGroup::push_signal(): domain_type does not match the domain of the signal.",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (domain_idx != 0) {
+                throw Exception("MSRIOGroup::push_signal(): domain_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (m_sample_age_idx == -1) {
+                m_sample_age_idx = num_signal_pushed();
+            }
+            return m_sample_age_idx;
+        }
         auto ncsm_it = m_name_cpu_signal_map.find(signal_name);
         if (ncsm_it == m_name_cpu_signal_map.end()) {
             throw Exception("MSRIOGroup::push_signal(): signal name \"" +
@@ -197,15 +231,15 @@ namespace geopm
             std::string registered_name = ncsm_it->second[*(cpu_idx.begin())]->name();
             if (m_active_signal[ii]->name() == registered_name &&
                 m_active_signal[ii]->cpu_idx() == *(cpu_idx.begin())) {
-                result = ii;
+                result = signal_idx(ii);
                 is_found = true;
             }
         }
 
         if (!is_found) {
-            result = m_active_signal.size();
+            result = num_signal_pushed();
             m_active_signal.push_back(ncsm_it->second[*(cpu_idx.begin())]);
-            MSRSignal *msr_sig = m_active_signal[result];
+            MSRSignal *msr_sig = m_active_signal.back();
 #ifdef GEOPM_DEBUG
             if (!msr_sig) {
                 throw Exception("MSRIOGroup::push_signal(): NULL MSRSignal pointer was saved in active signals",
@@ -294,7 +328,14 @@ namespace geopm
         }
         if (m_read_field.size()) {
             m_msrio->read_batch(m_read_field);
+            if (m_sample_age_idx != -1) {
+                struct geopm_time_s batch_time = m_msrio->batch_time();
+                struct geopm_time_s curr_time;
+                geopm_time(&curr_time);
+                m_sample_age = geopm_time_diff(&batch_time, &curr_time);
+            }
         }
+        decode();
         m_is_read = true;
     }
 
@@ -311,7 +352,7 @@ namespace geopm
 
     double MSRIOGroup::sample(int signal_idx)
     {
-        if (signal_idx < 0 || signal_idx >= (int)m_active_signal.size()) {
+        if (signal_idx < 0 || signal_idx >= num_signal_pushed()) {
             throw Exception("MSRIOGroup::sample(): signal_idx out of range",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
@@ -321,7 +362,30 @@ namespace geopm
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
 
-        return m_active_signal[signal_idx]->sample();
+        double result = m_sample_age;
+        if (signal_idx != m_sample_age_idx) {
+            result = m_signal_value[active_idx(signal_idx)];
+        }
+        return result;
+    }
+
+    void MSRIOGroup::sample_bulk(const std::vector<int> &sample_idx,
+                                 double *sample_value)
+    {
+        if (!m_is_read) {
+            throw Exception("MSRIOGroup::sample_bulk() called before signal was read.",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        const int num_signal = num_signal_pushed();
+        for (auto idx : sample_idx) {
+            if (idx < 0 || idx >= num_signal) {
+                throw Exception("MSRIOGroup::sample_bulk(): sample_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            *sample_value = idx == m_sample_age_idx ?
+                            m_sample_age : m_signal_value[active_idx(idx)];
+            ++sample_value;
+        }
     }
 
     void MSRIOGroup::adjust(int control_idx, double setting)
@@ -337,8 +401,35 @@ namespace geopm
         m_is_adjusted[control_idx] = true;
     }
 
+    void MSRIOGroup::adjust_bulk(const std::vector<int> &control_idx,
+                                 const double *setting)
+    {
+        for (auto idx : control_idx) {
+            if (idx < 0 || (unsigned)idx >= m_active_control.size()) {
+                throw Exception("MSRIOGroup::adjust_bulk(): control_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        if (!m_is_active) {
+            activate();
+        }
+        for (auto idx : control_idx) {
+            m_active_control[idx]->adjust(*setting);
+            m_is_adjusted[idx] = true;
+            ++setting;
+        }
+    }
+
     double MSRIOGroup::read_signal(const std::string &signal_name, int domain_type, int domain_idx)
     {
+        if (signal_name == m_sample_age_name) {
+            if (domain_type != IPlatformTopo::M_DOMAIN_BOARD) {
+                throw Exception("MSRIOGroup::read_signal(): domain_type requested does not match the domain of the signal.",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            // Values from read_signal() are read on demand.
+            return 0.0;
+        }
         auto ncsm_it = m_name_cpu_signal_map.find(signal_name);
         if (ncsm_it == m_name_cpu_signal_map.end()) {
             throw Exception("MSRIOGroup::read_signal(): signal name \"" +
@@ -368,6 +459,19 @@ namespace geopm
         // Alternative it to update last_value here, but that would mean
         // multiple calls to sample() could return different values if interleaved
         // with a call to read_signal().
+        if (m_is_read) {
+            auto active_it = std::find(m_active_signal.begin(), m_active_signal.end(),
+                                       ncsm_it->second[*(cpu_idx.begin())]);
+            if (active_it != m_active_signal.end()) {
+                // Decode with a copy of the last value tracked by read_batch()
+                int active_idx = active_it - m_active_signal.begin();
+                const struct m_decode_group_s &group = m_decode_group[m_signal_group[active_idx]];
+                uint64_t last_field = group.last_field[m_signal_group_pos[active_idx]];
+                double result = NAN;
+                decode_kernel(group, 1, &field, &last_field, false, &result);
+                return result;
+            }
+        }
         return signal.sample();
     }
 
@@ -491,9 +595,149 @@ namespace geopm
             msr_ctl->map_field(field_ptr, mask_ptr);
             ++msr_idx;
         }
+        // Group active signals that decode identically
+        std::map<std::tuple<int, int, int, double>, int> group_map;
+        m_signal_value.assign(m_active_signal.size(), NAN);
+        m_signal_group.resize(m_active_signal.size());
+        m_signal_group_pos.resize(m_active_signal.size());
+        m_decode_group.clear();
+        for (int signal_idx = 0; signal_idx < (int)m_active_signal.size(); ++signal_idx) {
+            struct IMSR::m_encode_s encode = m_active_signal[signal_idx]->encode();
+            auto key = std::make_tuple(encode.function, encode.begin_bit, encode.end_bit, encode.scalar);
+            auto group_it = group_map.find(key);
+            if (group_it == group_map.end()) {
+                struct m_decode_group_s group;
+                group.function = encode.function;
+                group.shift = encode.begin_bit;
+                group.num_bit = encode.end_bit - encode.begin_bit;
+                group.mask = group.num_bit == 64 ?
+                             ~0ULL : ((1ULL << group.num_bit) - 1) << group.shift;
+                group.scalar = encode.scalar;
+                group_it = group_map.emplace(key, m_decode_group.size()).first;
+                m_decode_group.push_back(group);
+            }
+            struct m_decode_group_s &group = m_decode_group[group_it->second];
+            m_signal_group[signal_idx] = group_it->second;
+            m_signal_group_pos[signal_idx] = group.signal_idx.size();
+            // Each active signal has its own entry in m_read_field
+            group.signal_idx.push_back(signal_idx);
+        }
+        for (auto &group : m_decode_group) {
+            group.field.resize(group.signal_idx.size());
+            group.last_field.resize(group.signal_idx.size(), 0);
+            group.value.resize(group.signal_idx.size());
+        }
         m_is_active = true;
     }
 
+    int MSRIOGroup::num_signal_pushed(void) const
+    {
+        return m_active_signal.size() + (m_sample_age_idx == -1 ? 0 : 1);
+    }
+
+    int MSRIOGroup::signal_idx(int active_idx) const
+    {
+        int result = active_idx;
+        if (m_sample_age_idx != -1 && active_idx >= m_sample_age_idx) {
+            ++result;
+        }
+        return result;
+    }
+
+    int MSRIOGroup::active_idx(int signal_idx) const
+    {
+        int result = signal_idx;
+        if (m_sample_age_idx != -1 && signal_idx > m_sample_age_idx) {
+            --result;
+        }
+        return result;
+    }
+
+    void MSRIOGroup::decode(void)
+    {
+        bool is_first = !m_is_read;
+        for (auto &group : m_decode_group) {
+            size_t num_field = group.signal_idx.size();
+            const int *signal_idx = group.signal_idx.data();
+            uint64_t *field = group.field.data();
+            double *value = group.value.data();
+            for (size_t ii = 0; ii < num_field; ++ii) {
+                field[ii] = m_read_field[signal_idx[ii]];
+            }
+            decode_kernel(group, num_field, field, group.last_field.data(), is_first, value);
+            for (size_t ii = 0; ii < num_field; ++ii) {
+                m_signal_value[signal_idx[ii]] = value[ii];
+            }
+        }
+    }
+
+    void MSRIOGroup::decode_kernel(const struct m_decode_group_s &group,
+                                   size_t num_field,
+                                   const uint64_t *field,
+                                   uint64_t *last_field,
+                                   bool is_first,
+                                   double *value)
+    {
+        // Same arithmetic as MSREncode::decode() with the switch
+        // hoisted out of the loop over fields.
+        const uint64_t mask = group.mask;
+        const int shift = group.shift;
+        const double scalar = group.scalar;
+        switch (group.function) {
+            case IMSR::M_FUNCTION_SCALE:
+                for (size_t ii = 0; ii < num_field; ++ii) {
+                    value[ii] = ((field[ii] & mask) >> shift) * scalar;
+                }
+                break;
+            case IMSR::M_FUNCTION_LOG_HALF:
+                // F = S * 2.0 ^ -X
+                for (size_t ii = 0; ii < num_field; ++ii) {
+                    value[ii] = (1.0 / (1ULL << ((field[ii] & mask) >> shift))) * scalar;
+                }
+                break;
+            case IMSR::M_FUNCTION_7_BIT_FLOAT:
+                // F = S * 2 ^ Y * (1.0 + Z / 4.0)
+                // Y in bits [0:5) and Z in bits [5:7)
+                for (size_t ii = 0; ii < num_field; ++ii) {
+                    uint64_t sub_field = (field[ii] & mask) >> shift;
+                    value[ii] = ((1ULL << (sub_field & 0x1F)) * (1.0 + (sub_field >> 5) / 4.0)) * scalar;
+                }
+                break;
+            case IMSR::M_FUNCTION_OVERFLOW:
+                {
+                    const uint64_t max = (1ULL << group.num_bit) - 1;
+                    for (size_t ii = 0; ii < num_field; ++ii) {
+                        int num_overflow = last_field[ii] / (max + 1);  // max + 1 in case last value is max
+                        uint64_t last_value = last_field[ii] - (max * num_overflow);
+                        double result = (field[ii] & mask) >> shift;
+                        if (result < last_value) {
+                            ++num_overflow;
+                            result = result + (max * num_overflow);
+                        }
+                        value[ii] = result * scalar;
+                        last_field[ii] = field[ii];
+                    }
+                }
+                break;
+            case IMSR::M_FUNCTION_NORMALIZE_64:
+                if (is_first) {
+                    for (size_t ii = 0; ii < num_field; ++ii) {
+                        last_field[ii] = field[ii];
+                        value[ii] = 0.0;
+                    }
+                }
+                else {
+                    for (size_t ii = 0; ii < num_field; ++ii) {
+                        value[ii] = (((field[ii] & mask) >> shift) - last_field[ii]) * scalar;
+                    }
+                }
+                break;
+            default:
+                std::fill(value, value + num_field, NAN);
+                break;
+        }
+    }
+
     void MSRIOGroup::register_msr_signal(const std::string &msr_name)
     {
         register_msr_signal(msr_name, msr_name);
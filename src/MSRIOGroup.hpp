@@ -78,8 +78,12 @@ namespace geopm
             void read_batch(void) override;
             void write_batch(void) override;
             double sample(int sample_idx) override;
+            void sample_bulk(const std::vector<int> &sample_idx,
+                             double *sample_value) override;
             void adjust(int control_idx,
                         double setting) override;
+            void adjust_bulk(const std::vector<int> &control_idx,
+                             const double *setting) override;
             double read_signal(const std::string &signal_name,
                                int domain_type,
                                int domain_idx) override;
@@ -121,8 +125,43 @@ namespace geopm
             void register_msr_signal(const std::string &signal_name, const std::string &msr_field_name);
             void register_msr_control(const std::string &control_name, const std::string &msr_field_name);
 
+            /// @brief Active signals that share a bit field layout
+            ///        and decode function stored as a structure of
+            ///        arrays so they can be decoded in one pass.
+            struct m_decode_group_s {
+                int function;
+                int shift;
+                int num_bit;
+                uint64_t mask;
+                double scalar;
+                // Vectors are over signals in the group
+                std::vector<int> signal_idx;
+                std::vector<uint64_t> field;
+                std::vector<uint64_t> last_field;
+                std::vector<double> value;
+            };
             /// @brief Configure memory for all pushed signals and controls.
             void activate(void);
+            /// @brief Number of signals pushed including the
+            ///        sample age signal.
+            int num_signal_pushed(void) const;
+            /// @brief Convert an index into m_active_signal into
+            ///        the index returned by push_signal().
+            int signal_idx(int active_idx) const;
+            /// @brief Convert an index returned by push_signal()
+            ///        into an index into m_active_signal.
+            int active_idx(int signal_idx) const;
+            /// @brief Decode all active signals from m_read_field
+            ///        into m_signal_value.
+            void decode(void);
+            /// @brief Decode num_field raw register values that
+            ///        share the bit field and function of a group.
+            static void decode_kernel(const struct m_decode_group_s &group,
+                                      size_t num_field,
+                                      const uint64_t *field,
+                                      uint64_t *last_field,
+                                      bool is_first,
+                                      double *value);
             IPlatformTopo &m_platform_topo;
             int m_num_cpu;
             bool m_is_active;
@@ -141,12 +180,25 @@ namespace geopm
             std::vector<uint64_t> m_read_field;
             std::vector<int> m_read_cpu_idx;
             std::vector<uint64_t> m_read_offset;
+            // Vectors are over active signals
+            std::vector<double> m_signal_value;
+            std::vector<int> m_signal_group;
+            std::vector<int> m_signal_group_pos;
+            std::vector<struct m_decode_group_s> m_decode_group;
             // Vectors are over MSRs for all active controls
             std::vector<uint64_t> m_write_field;
             std::vector<int> m_write_cpu_idx;
             std::vector<uint64_t> m_write_offset;
             std::vector<uint64_t> m_write_mask;
             const std::string m_name_prefix;
+            /// @brief Name of the board signal that reports the
+            ///        age of the MSR values returned by the last
+            ///        read_batch().
+            const std::string m_sample_age_name;
+            /// @brief Index returned by push_signal() for the sample
+            ///        age signal or -1 if it has not been pushed.
+            int m_sample_age_idx;
+            double m_sample_age;
     };
 }
 
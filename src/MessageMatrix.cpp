@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <utility>
+
+#include "MessageMatrix.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    MessageMatrix::MessageMatrix()
+        : MessageMatrix(0, 0)
+    {
+
+    }
+
+    MessageMatrix::MessageMatrix(size_t num_row, size_t num_col)
+        : m_num_row(num_row)
+        , m_num_col(num_col)
+        , m_stride(num_col)
+        , m_storage(num_row * num_col, 0.0)
+        , m_data(m_storage.data())
+    {
+
+    }
+
+    MessageMatrix::MessageMatrix(const std::vector<std::vector<double> > &rows)
+        : MessageMatrix(rows.size(), rows.size() ? rows[0].size() : 0)
+    {
+        for (size_t row_idx = 0; row_idx != m_num_row; ++row_idx) {
+            row(row_idx, rows[row_idx]);
+        }
+    }
+
+    MessageMatrix::MessageMatrix(double *data, size_t num_row, size_t num_col, size_t stride)
+        : m_num_row(num_row)
+        , m_num_col(num_col)
+        , m_stride(stride)
+        , m_data(data)
+    {
+        if (stride < num_col) {
+            throw Exception("MessageMatrix::MessageMatrix(): stride is less than number of columns",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    MessageMatrix::MessageMatrix(const MessageMatrix &other)
+        : MessageMatrix(other.m_num_row, other.m_num_col)
+    {
+        for (size_t row_idx = 0; row_idx != m_num_row; ++row_idx) {
+            std::copy(other[row_idx], other[row_idx] + m_num_col, (*this)[row_idx]);
+        }
+    }
+
+    MessageMatrix::MessageMatrix(MessageMatrix &&other)
+        : m_num_row(other.m_num_row)
+        , m_num_col(other.m_num_col)
+        , m_stride(other.m_stride)
+        , m_storage(std::move(other.m_storage))
+        , m_data(other.m_data)
+    {
+        other.resize(0, 0);
+    }
+
+    MessageMatrix &MessageMatrix::operator=(const MessageMatrix &other)
+    {
+        if (this != &other) {
+            if (m_num_row != other.m_num_row || m_num_col != other.m_num_col) {
+                resize(other.m_num_row, other.m_num_col);
+            }
+            for (size_t row_idx = 0; row_idx != m_num_row; ++row_idx) {
+                std::copy(other[row_idx], other[row_idx] + m_num_col, (*this)[row_idx]);
+            }
+        }
+        return *this;
+    }
+
+    MessageMatrix &MessageMatrix::operator=(MessageMatrix &&other)
+    {
+        if (this != &other) {
+            m_num_row = other.m_num_row;
+            m_num_col = other.m_num_col;
+            m_stride = other.m_stride;
+            m_storage = std::move(other.m_storage);
+            m_data = other.m_data;
+            other.resize(0, 0);
+        }
+        return *this;
+    }
+
+    size_t MessageMatrix::num_row(void) const
+    {
+        return m_num_row;
+    }
+
+    size_t MessageMatrix::num_col(void) const
+    {
+        return m_num_col;
+    }
+
+    size_t MessageMatrix::stride(void) const
+    {
+        return m_stride;
+    }
+
+    size_t MessageMatrix::size(void) const
+    {
+        return m_num_row;
+    }
+
+    double *MessageMatrix::operator[](size_t row)
+    {
+        return m_data + row * m_stride;
+    }
+
+    const double *MessageMatrix::operator[](size_t row) const
+    {
+        return m_data + row * m_stride;
+    }
+
+    std::vector<double> MessageMatrix::row(size_t row) const
+    {
+        if (row >= m_num_row) {
+            throw Exception("MessageMatrix::row(): row out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return std::vector<double>((*this)[row], (*this)[row] + m_num_col);
+    }
+
+    void MessageMatrix::row(size_t row, const std::vector<double> &value)
+    {
+        if (row >= m_num_row || value.size() != m_num_col) {
+            throw Exception("MessageMatrix::row(): row out of range or value is not sized correctly",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::copy(value.begin(), value.end(), (*this)[row]);
+    }
+
+    bool MessageMatrix::row_equal(size_t row, const MessageMatrix &other, size_t other_row) const
+    {
+        return m_num_col == other.m_num_col &&
+               std::equal((*this)[row], (*this)[row] + m_num_col, other[other_row]);
+    }
+
+    void MessageMatrix::resize(size_t num_row, size_t num_col)
+    {
+        m_num_row = num_row;
+        m_num_col = num_col;
+        m_stride = num_col;
+        m_storage.assign(num_row * num_col, 0.0);
+        m_data = m_storage.data();
+    }
+
+    void MessageMatrix::fill(double value)
+    {
+        for (size_t row_idx = 0; row_idx != m_num_row; ++row_idx) {
+            std::fill((*this)[row_idx], (*this)[row_idx] + m_num_col, value);
+        }
+    }
+
+    bool MessageMatrix::operator==(const MessageMatrix &other) const
+    {
+        bool result = m_num_row == other.m_num_row && m_num_col == other.m_num_col;
+        for (size_t row_idx = 0; result && row_idx != m_num_row; ++row_idx) {
+            result = row_equal(row_idx, other, row_idx);
+        }
+        return result;
+    }
+
+    bool MessageMatrix::operator!=(const MessageMatrix &other) const
+    {
+        return !(*this == other);
+    }
+}
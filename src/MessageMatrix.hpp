@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MESSAGEMATRIX_HPP_INCLUDE
+#define MESSAGEMATRIX_HPP_INCLUDE
+
+#include <stddef.h>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Matrix of message values passed through the tree with
+    ///        one row per child and one column per policy or sample
+    ///        value.
+    ///
+    /// The values are stored in a single contiguous buffer in row
+    /// major order.  The distance between rows (the stride) may be
+    /// larger than the number of columns so that a matrix can also
+    /// view memory it does not own, e.g. a TreeCommLevel mailbox
+    /// where each row is preceded by a ready flag.  Copying a matrix
+    /// always creates an owned, densely packed matrix, while moving
+    /// a matrix preserves the view.
+    class MessageMatrix
+    {
+        public:
+            MessageMatrix();
+            /// @brief Create a matrix of zeros.
+            MessageMatrix(size_t num_row, size_t num_col);
+            /// @brief Create a matrix from one vector per row; all
+            ///        rows must be the same size.
+            MessageMatrix(const std::vector<std::vector<double> > &rows);
+            /// @brief Create a matrix that views external memory.
+            ///        The memory must outlive the matrix.
+            /// @param [in] data Address of the first element of the
+            ///        first row.
+            /// @param [in] stride Number of doubles between the
+            ///        start of consecutive rows.
+            MessageMatrix(double *data, size_t num_row, size_t num_col, size_t stride);
+            MessageMatrix(const MessageMatrix &other);
+            /// @brief Move a matrix; a matrix that views external
+            ///        memory continues to view the same memory.
+            MessageMatrix(MessageMatrix &&other);
+            MessageMatrix &operator=(const MessageMatrix &other);
+            MessageMatrix &operator=(MessageMatrix &&other);
+            virtual ~MessageMatrix() = default;
+            /// @brief Number of rows, i.e. children.
+            size_t num_row(void) const;
+            /// @brief Number of columns, i.e. values in each message.
+            size_t num_col(void) const;
+            /// @brief Number of doubles between the start of
+            ///        consecutive rows.
+            size_t stride(void) const;
+            /// @brief Number of rows; allows a matrix to be used
+            ///        where a vector of rows was used previously.
+            size_t size(void) const;
+            /// @brief Address of the first value of a row.
+            double *operator[](size_t row);
+            const double *operator[](size_t row) const;
+            /// @brief Returns a copy of one row.
+            std::vector<double> row(size_t row) const;
+            /// @brief Overwrite one row; value must have num_col()
+            ///        elements.
+            void row(size_t row, const std::vector<double> &value);
+            /// @brief Returns true if the row has the same values as
+            ///        the row of another matrix with the same number
+            ///        of columns.
+            bool row_equal(size_t row, const MessageMatrix &other, size_t other_row) const;
+            /// @brief Reshape the matrix into owned storage; values
+            ///        are set to zero.
+            void resize(size_t num_row, size_t num_col);
+            /// @brief Set every value in the matrix.
+            void fill(double value);
+            bool operator==(const MessageMatrix &other) const;
+            bool operator!=(const MessageMatrix &other) const;
+        private:
+            size_t m_num_row;
+            size_t m_num_col;
+            size_t m_stride;
+            std::vector<double> m_storage;
+            double *m_data;
+    };
+}
+
+#endif
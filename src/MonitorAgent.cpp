@@ -48,19 +48,18 @@ namespace geopm
     MonitorAgent::MonitorAgent(IPlatformIO &plat_io, IPlatformTopo &topo)
         : m_platform_io(plat_io)
         , m_platform_topo(topo)
-        , m_last_wait{{0, 0}}
         , m_num_ascend(0)
         , M_SEND_PERIOD(10)
         , M_WAIT_SEC(0.005)
+        , m_waiter(M_WAIT_SEC)
     {
-        geopm_time(&m_last_wait);
-
         for (auto name : sample_names()) {
             m_sample_idx.push_back(m_platform_io.push_signal(name,
                                                              IPlatformTopo::M_DOMAIN_BOARD,
                                                              0));
             m_agg_func.push_back(m_platform_io.agg_function(name));
         }
+        m_sample_group = m_platform_io.push_signal_group(m_sample_idx);
         m_num_sample = m_sample_idx.size();
     }
 
@@ -80,12 +79,12 @@ namespace geopm
     }
 
     bool MonitorAgent::descend(const std::vector<double> &in_policy,
-                               std::vector<std::vector<double> >&out_policy)
+                               MessageMatrix &out_policy)
     {
         return false;
     }
 
-    bool MonitorAgent::ascend(const std::vector<std::vector<double> > &in_sample,
+    bool MonitorAgent::ascend(const MessageMatrix &in_sample,
                               std::vector<double> &out_sample)
     {
 #ifdef GEOPM_DEBUG
@@ -104,6 +103,20 @@ namespace geopm
         return true;
     }
 
+    std::vector<std::function<double(const std::vector<double> &)> > MonitorAgent::aggregate_function(void) const
+    {
+        return m_agg_func;
+    }
+
+    std::vector<double> MonitorAgent::sample_tolerance(void) const
+    {
+        std::vector<double> result;
+        for (const auto &sample : sample_table()) {
+            result.push_back(sample.second);
+        }
+        return result;
+    }
+
     bool MonitorAgent::adjust_platform(const std::vector<double> &in_policy)
     {
         return false;
@@ -119,9 +132,7 @@ namespace geopm
 #endif
         bool result = false;
         if (m_num_ascend == 0) {
-            for (size_t sample_idx = 0; sample_idx < m_num_sample; ++sample_idx) {
-                out_sample[sample_idx] = m_platform_io.sample(m_sample_idx[sample_idx]);
-            }
+            m_platform_io.sample_group(m_sample_group, out_sample);
             result = true;
         }
         ++m_num_ascend;
@@ -133,12 +144,7 @@ namespace geopm
 
     void MonitorAgent::wait(void)
     {
-        geopm_time_s current_time;
-        do {
-            geopm_time(&current_time);
-        }
-        while(geopm_time_diff(&m_last_wait, &current_time) < M_WAIT_SEC);
-        geopm_time(&m_last_wait);
+        m_waiter.wait();
     }
 
     std::vector<std::string> MonitorAgent::policy_names(void)
@@ -148,7 +154,21 @@ namespace geopm
 
     std::vector<std::string> MonitorAgent::sample_names(void)
     {
-        return {"POWER_PACKAGE", "FREQUENCY"};;
+        std::vector<std::string> result;
+        for (const auto &sample : sample_table()) {
+            result.push_back(sample.first);
+        }
+        return result;
+    }
+
+    const std::vector<std::pair<std::string, double> > &MonitorAgent::sample_table(void)
+    {
+        // Half a watt of package power and 10 MHz of frequency
+        static const std::vector<std::pair<std::string, double> > result {
+            {"POWER_PACKAGE", 0.5},
+            {"FREQUENCY", 1e7},
+        };
+        return result;
     }
 
     std::vector<std::pair<std::string, std::string> > MonitorAgent::report_header(void)
@@ -40,7 +40,7 @@
 #include <functional>
 
 #include "Agent.hpp"
-#include "geopm_time.h"
+#include "Waiter.hpp"
 
 namespace geopm
 {
@@ -56,9 +56,11 @@ namespace geopm
             virtual ~MonitorAgent() = default;
             void init(int level) override;
             bool descend(const std::vector<double> &in_policy,
-                         std::vector<std::vector<double> >&out_policy) override;
-            bool ascend(const std::vector<std::vector<double> > &in_sample,
+                         MessageMatrix &out_policy) override;
+            bool ascend(const MessageMatrix &in_sample,
                         std::vector<double> &out_sample) override;
+            std::vector<std::function<double(const std::vector<double> &)> > aggregate_function(void) const override;
+            std::vector<double> sample_tolerance(void) const override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
             void wait(void) override;
@@ -74,17 +76,22 @@ namespace geopm
             static std::vector<std::string> sample_names(void);
         private:
             void load_trace_columns(void);
+            /// @brief Name of each sample with the absolute change
+            ///        that is sent up the tree; the source of both
+            ///        sample_names() and sample_tolerance().
+            static const std::vector<std::pair<std::string, double> > &sample_table(void);
 
             IPlatformIO &m_platform_io;
             IPlatformTopo &m_platform_topo;
-            geopm_time_s m_last_wait;
             std::vector<int> m_sample_idx;
+            int m_sample_group;
             std::vector<std::function<double(const std::vector<double>&)> > m_agg_func;
             size_t m_num_sample;
             int m_level;
             size_t m_num_ascend;
             const size_t M_SEND_PERIOD;
             const double M_WAIT_SEC;
+            Waiter m_waiter;
     };
 }
 
@@ -31,12 +31,13 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
 #include <string>
-#include <map>
+#include <vector>
 #include <iostream>
 #include <fstream>
 #include <sstream>
-#include <iomanip>
 #include <sys/wait.h>
 
 #include "geopm.h"
@@ -45,6 +46,7 @@
 #include "geopm_error.h"
 #include "Exception.hpp"
 #include "OMPT.hpp"
+#include "RegionIdCache.hpp"
 #include "config.h"
 
 #ifndef GEOPM_ENABLE_OMPT
@@ -70,16 +72,38 @@ namespace geopm
             OMPT();
             OMPT(const std::string &map_path);
             virtual ~OMPT() = default;
+            /// @brief Region ID for the parallel function.
+            ///
+            /// Safe to call concurrently from any thread without
+            /// locking.  The first caller for a function registers
+            /// the region with geopm_prof_region() and caches the
+            /// result; threads that race with the registration, or
+            /// follow a failed one, call geopm_prof_region()
+            /// directly.  Returns GEOPM_REGION_ID_UNDEFINED if the
+            /// registration fails.
             uint64_t region_id(void *parallel_function);
             void region_name(void *parallel_function, std::string &name);
             void region_name_pretty(std::string &name);
         private:
-            /// Map from <virtual_address, is_end> pair representing
-            /// half of a virtual address range to the object file
-            /// asigned to the address range.
-            std::map<std::pair<size_t, bool>, std::string> m_range_object_map;
-            /// Map from function address to geopm region ID
-            std::map<size_t, uint64_t> m_function_region_id_map;
+            enum {
+                /// Number of slots in the function to region ID
+                /// cache, must be a power of two.
+                M_CACHE_SIZE = 4096,
+                /// Number of slots searched before giving up on
+                /// caching a function.
+                M_CACHE_PROBE_MAX = 16,
+            };
+            /// Executable address range of an object file.
+            struct range_s {
+                size_t begin;
+                size_t end;
+                /// Region name prefix for the object, "[OMPT]<path>".
+                std::string name_prefix;
+            };
+            uint64_t region_id_resolve(void *parallel_function);
+            /// Executable address ranges sorted by begin address.
+            std::vector<struct range_s> m_range;
+            RegionIdCache m_cache;
     };
 
     static OMPT &ompt(void)
@@ -95,6 +119,7 @@ namespace geopm
     }
 
     OMPT::OMPT(const std::string &map_path)
+        : m_cache(M_CACHE_SIZE, M_CACHE_PROBE_MAX)
     {
         std::ifstream maps_stream(map_path);
         while (maps_stream.good()) {
@@ -118,14 +143,15 @@ namespace geopm
             if (line.find(" r-xp ") != line.find(' ')) {
                 continue;
             }
-            std::pair<size_t, bool> aa(addr_begin, false);
-            std::pair<size_t, bool> bb(addr_end, true);
-            std::pair<std::pair<size_t, bool>, std::string> cc(aa, object);
-            std::pair<std::pair<size_t, bool>, std::string> dd(bb, object);
-            auto it0 = m_range_object_map.insert(m_range_object_map.begin(), cc);
-            auto it1 = m_range_object_map.insert(it0, dd);
-            ++it0;
-            if (it0 != it1) {
+            m_range.push_back({addr_begin, addr_end, "[OMPT]" + object});
+        }
+        std::sort(m_range.begin(), m_range.end(),
+                  [](const struct range_s &aa, const struct range_s &bb)
+                  {
+                      return aa.begin < bb.begin;
+                  });
+        for (size_t idx = 1; idx < m_range.size(); ++idx) {
+            if (m_range[idx].begin < m_range[idx - 1].end) {
                 throw Exception("Error parsing /proc/self/maps, overlapping address ranges.",
                                 GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
             }
@@ -133,22 +159,26 @@ namespace geopm
     }
 
     uint64_t OMPT::region_id(void *parallel_function)
+    {
+        return m_cache.region_id((size_t)parallel_function,
+                                 [this, parallel_function](int slot_idx)
+                                 {
+                                     return region_id_resolve(parallel_function);
+                                 },
+                                 [](int slot_idx)
+                                 {
+                                     return true;
+                                 });
+    }
+
+    uint64_t OMPT::region_id_resolve(void *parallel_function)
     {
         uint64_t result = GEOPM_REGION_ID_UNDEFINED;
-        auto it = m_function_region_id_map.find((size_t)parallel_function);
-        if (m_function_region_id_map.end() != it) {
-            result = it->second;
-        }
-        else {
-            std::string rn;
-            region_name(parallel_function, rn);
-            int err = geopm_prof_region(rn.c_str(), GEOPM_REGION_HINT_UNKNOWN, &result);
-            if (err) {
-                result = GEOPM_REGION_ID_UNDEFINED;
-            }
-            else {
-                m_function_region_id_map.insert(std::pair<size_t, uint64_t>((size_t)parallel_function, result));
-            }
+        std::string rn;
+        region_name(parallel_function, rn);
+        int err = geopm_prof_region(rn.c_str(), GEOPM_REGION_HINT_UNKNOWN, &result);
+        if (err || !result) {
+            result = GEOPM_REGION_ID_UNDEFINED;
         }
         return result;
     }
@@ -156,17 +186,19 @@ namespace geopm
     void OMPT::region_name(void *parallel_function, std::string &name)
     {
         name.clear();
-        auto it_max = m_range_object_map.upper_bound(std::pair<size_t, bool>((size_t)parallel_function, false));
-        auto it_min = it_max;
-        --it_min;
-        if (it_max != m_range_object_map.end() &&
-            it_max != m_range_object_map.begin() &&
-            false == it_min->first.second &&
-            true == it_max->first.second) {
-            size_t offset = (size_t)parallel_function - (size_t)(it_min->first.first);
-            std::ostringstream name_stream;
-            name_stream << "[OMPT]" << it_min->second << ":0x" << std::setfill('0') << std::setw(16) << std::hex << offset;
-            name = name_stream.str();
+        size_t function = (size_t)parallel_function;
+        auto it = std::upper_bound(m_range.begin(), m_range.end(), function,
+                                   [](size_t addr, const struct range_s &range)
+                                   {
+                                       return addr < range.begin;
+                                   });
+        if (it != m_range.begin()) {
+            --it;
+            if (function < it->end) {
+                char offset_str[32];
+                snprintf(offset_str, sizeof(offset_str), ":0x%016zx", function - it->begin);
+                name = it->name_prefix + offset_str;
+            }
         }
     }
 
@@ -229,9 +261,11 @@ namespace geopm
 
 extern "C"
 {
-    static void *g_curr_parallel_function = NULL;
-    static ompt_parallel_id_t g_curr_parallel_id;
-    static uint64_t g_curr_region_id = GEOPM_REGION_ID_UNDEFINED;
+    // Parallel regions may begin on several threads at once when
+    // they are nested, so the current region is tracked per thread.
+    static thread_local void *g_curr_parallel_function = NULL;
+    static thread_local ompt_parallel_id_t g_curr_parallel_id;
+    static thread_local uint64_t g_curr_region_id = GEOPM_REGION_ID_UNDEFINED;
 
     static void on_ompt_event_parallel_begin(ompt_task_id_t parent_task_id,
                                              ompt_frame_t *parent_task_frame,
@@ -241,9 +275,12 @@ extern "C"
                                              ompt_invoker_t invoker)
     {
         if (g_curr_parallel_function != parallel_function) {
-            g_curr_parallel_function = parallel_function;
             g_curr_parallel_id = parallel_id;
             g_curr_region_id = geopm::ompt().region_id(parallel_function);
+            // Only remember the function once its region is known so
+            // that a failed or racing lookup is retried next time.
+            g_curr_parallel_function = g_curr_region_id != GEOPM_REGION_ID_UNDEFINED ?
+                                       parallel_function : NULL;
         }
         if (g_curr_region_id != GEOPM_REGION_ID_UNDEFINED) {
             geopm_prof_enter(g_curr_region_id);
@@ -250,8 +250,34 @@ namespace geopm
 
     void PlatformIO::push_region_signal_total(int signal_idx, int domain_type, int domain_idx)
     {
+        if (signal_idx < 0 || signal_idx >= num_signal()) {
+            throw Exception("PlatformIO::push_region_signal_total(): signal_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         int rid_idx = push_signal("REGION_ID#", domain_type, domain_idx);
-        m_region_id_idx[signal_idx] = rid_idx;
+        if ((size_t)signal_idx >= m_region_total_pos.size()) {
+            m_region_total_pos.resize(signal_idx + 1, -1);
+        }
+        if (m_region_total_pos[signal_idx] == -1) {
+            m_region_total_pos[signal_idx] = m_region_total.size();
+            m_region_total.push_back({signal_idx, rid_idx, false,
+                                      GEOPM_REGION_ID_UNDEFINED, -1});
+        }
+        else {
+            m_region_total[m_region_total_pos[signal_idx]].region_id_idx = rid_idx;
+        }
+    }
+
+    int PlatformIO::region_slot(uint64_t region_id)
+    {
+        auto it = m_region_slot.find(region_id);
+        if (it == m_region_slot.end()) {
+            it = m_region_slot.emplace(region_id, m_region_slot.size()).first;
+            size_t num_total = m_region_total.size();
+            m_region_sample_total.resize(m_region_sample_total.size() + num_total, 0.0);
+            m_region_last_entry.resize(m_region_last_entry.size() + num_total, NAN);
+        }
+        return it->second;
     }
 
     int PlatformIO::push_control(const std::string &control_name,
@@ -282,6 +308,72 @@ namespace geopm
         return result;
     }
 
+    int PlatformIO::push_signal_group(const std::vector<int> &signal_idx)
+    {
+        m_signal_group_s group;
+        group.num_signal = signal_idx.size();
+        int value_pos = 0;
+        for (auto idx : signal_idx) {
+            if (idx < 0 || idx >= num_signal()) {
+                throw Exception("PlatformIO::push_signal_group(): signal_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            IOGroup *iogroup = m_active_signal[idx].first;
+            if (iogroup) {
+                auto group_it = std::find(group.iogroup.begin(), group.iogroup.end(), iogroup);
+                size_t iogroup_pos = group_it - group.iogroup.begin();
+                if (group_it == group.iogroup.end()) {
+                    group.iogroup.push_back(iogroup);
+                    group.iogroup_signal_idx.emplace_back();
+                    group.iogroup_value_pos.emplace_back();
+                }
+                group.iogroup_signal_idx[iogroup_pos].push_back(m_active_signal[idx].second);
+                group.iogroup_value_pos[iogroup_pos].push_back(value_pos);
+            }
+            else {
+                group.combined_signal_idx.push_back(m_active_signal[idx].second);
+                group.combined_value_pos.push_back(value_pos);
+            }
+            ++value_pos;
+        }
+        for (const auto &iogroup_signal_idx : group.iogroup_signal_idx) {
+            group.iogroup_value.emplace_back(iogroup_signal_idx.size(), NAN);
+        }
+        int result = m_signal_group.size();
+        m_signal_group.push_back(std::move(group));
+        return result;
+    }
+
+    int PlatformIO::push_control_group(const std::vector<int> &control_idx)
+    {
+        m_control_group_s group;
+        group.num_control = control_idx.size();
+        int setting_pos = 0;
+        for (auto idx : control_idx) {
+            if (idx < 0 || idx >= num_control()) {
+                throw Exception("PlatformIO::push_control_group(): control_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            IOGroup *iogroup = m_active_control[idx].first;
+            auto group_it = std::find(group.iogroup.begin(), group.iogroup.end(), iogroup);
+            size_t iogroup_pos = group_it - group.iogroup.begin();
+            if (group_it == group.iogroup.end()) {
+                group.iogroup.push_back(iogroup);
+                group.iogroup_control_idx.emplace_back();
+                group.iogroup_setting_pos.emplace_back();
+            }
+            group.iogroup_control_idx[iogroup_pos].push_back(m_active_control[idx].second);
+            group.iogroup_setting_pos[iogroup_pos].push_back(setting_pos);
+            ++setting_pos;
+        }
+        for (const auto &iogroup_control_idx : group.iogroup_control_idx) {
+            group.iogroup_setting.emplace_back(iogroup_control_idx.size(), NAN);
+        }
+        int result = m_control_group.size();
+        m_control_group.push_back(std::move(group));
+        return result;
+    }
+
     int PlatformIO::num_signal(void) const
     {
         return m_active_signal.size();
@@ -313,19 +405,89 @@ namespace geopm
         return result;
     }
 
+    void PlatformIO::sample(const std::vector<int> &signal_idx,
+                            std::vector<double> &signal_value)
+    {
+        for (auto idx : signal_idx) {
+            if (idx < 0 || idx >= num_signal()) {
+                throw Exception("PlatformIO::sample(): signal_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        if (!m_is_active) {
+            throw Exception("PlatformIO::sample(): read_batch() not called prior to call to sample()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        size_t num_signal = signal_idx.size();
+        signal_value.resize(num_signal);
+        size_t ii = 0;
+        while (ii != num_signal) {
+            IOGroup *iogroup = m_active_signal[signal_idx[ii]].first;
+            if (iogroup) {
+                // Consecutive signals from one IOGroup are sampled
+                // with a single call.
+                size_t begin = ii;
+                m_bulk_idx.clear();
+                while (ii != num_signal &&
+                       m_active_signal[signal_idx[ii]].first == iogroup) {
+                    m_bulk_idx.push_back(m_active_signal[signal_idx[ii]].second);
+                    ++ii;
+                }
+                iogroup->sample_bulk(m_bulk_idx, signal_value.data() + begin);
+            }
+            else {
+                signal_value[ii] = sample_combined(m_active_signal[signal_idx[ii]].second);
+                ++ii;
+            }
+        }
+    }
+
+    void PlatformIO::sample_group(int group_idx,
+                                  std::vector<double> &signal_value)
+    {
+        if (group_idx < 0 || group_idx >= (int)m_signal_group.size()) {
+            throw Exception("PlatformIO::sample_group(): group_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (!m_is_active) {
+            throw Exception("PlatformIO::sample_group(): read_batch() not called prior to call to sample_group()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        m_signal_group_s &group = m_signal_group[group_idx];
+        signal_value.resize(group.num_signal);
+        for (size_t iogroup_pos = 0; iogroup_pos < group.iogroup.size(); ++iogroup_pos) {
+            std::vector<double> &iogroup_value = group.iogroup_value[iogroup_pos];
+            const std::vector<int> &value_pos = group.iogroup_value_pos[iogroup_pos];
+            group.iogroup[iogroup_pos]->sample_bulk(group.iogroup_signal_idx[iogroup_pos],
+                                                    iogroup_value.data());
+            for (size_t ii = 0; ii < value_pos.size(); ++ii) {
+                signal_value[value_pos[ii]] = iogroup_value[ii];
+            }
+        }
+        for (size_t ii = 0; ii < group.combined_signal_idx.size(); ++ii) {
+            signal_value[group.combined_value_pos[ii]] = sample_combined(group.combined_signal_idx[ii]);
+        }
+    }
+
     double PlatformIO::sample_region_total(int signal_idx, uint64_t region_id)
     {
+        if (signal_idx < 0 || (size_t)signal_idx >= m_region_total_pos.size() ||
+            m_region_total_pos[signal_idx] == -1) {
+            throw Exception("PlatformIO::sample_region_total(): signal_idx was not pushed with push_region_signal_total()",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         double current_value = 0.0;
-        uint64_t curr_rid = geopm_signal_to_field(sample(m_region_id_idx.at(signal_idx)));
+        int pos = m_region_total_pos[signal_idx];
+        uint64_t curr_rid = geopm_signal_to_field(sample(m_region_total[pos].region_id_idx));
         curr_rid = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, curr_rid);
-        auto idx = std::make_pair(signal_idx, region_id);
-        if (m_region_sample_data.find(idx) != m_region_sample_data.end()) {
-            const auto &data =  m_region_sample_data.at(idx);
-            current_value += data.total;
+        auto slot_it = m_region_slot.find(region_id);
+        if (slot_it != m_region_slot.end()) {
+            size_t data_idx = slot_it->second * m_region_total.size() + pos;
+            current_value += m_region_sample_total[data_idx];
             // if currently in this region, add current value to total
             if (region_id == curr_rid &&
-                !isnan(data.last_entry_value)) {
-                current_value += sample(signal_idx) - data.last_entry_value;
+                !isnan(m_region_last_entry[data_idx])) {
+                current_value += sample(signal_idx) - m_region_last_entry[data_idx];
             }
         }
         return current_value;
@@ -361,6 +523,69 @@ namespace geopm
         m_is_active = true;
     }
 
+    void PlatformIO::adjust(const std::vector<int> &control_idx,
+                            const std::vector<double> &setting)
+    {
+        if (control_idx.size() != setting.size()) {
+            throw Exception("PlatformIO::adjust(): control_idx and setting vectors are not the same length",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t ii = 0; ii < control_idx.size(); ++ii) {
+            if (control_idx[ii] < 0 || control_idx[ii] >= num_control()) {
+                throw Exception("PlatformIO::adjust(): control_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (isnan(setting[ii])) {
+                throw Exception("PlatformIO::adjust(): setting is NAN",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        size_t num_control = control_idx.size();
+        size_t ii = 0;
+        while (ii != num_control) {
+            // Consecutive controls from one IOGroup are adjusted
+            // with a single call.
+            IOGroup *iogroup = m_active_control[control_idx[ii]].first;
+            size_t begin = ii;
+            m_bulk_idx.clear();
+            while (ii != num_control &&
+                   m_active_control[control_idx[ii]].first == iogroup) {
+                m_bulk_idx.push_back(m_active_control[control_idx[ii]].second);
+                ++ii;
+            }
+            iogroup->adjust_bulk(m_bulk_idx, setting.data() + begin);
+        }
+        m_is_active = true;
+    }
+
+    void PlatformIO::adjust_group(int group_idx,
+                                  const std::vector<double> &setting)
+    {
+        if (group_idx < 0 || group_idx >= (int)m_control_group.size()) {
+            throw Exception("PlatformIO::adjust_group(): group_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_control_group_s &group = m_control_group[group_idx];
+        if (setting.size() != group.num_control) {
+            throw Exception("PlatformIO::adjust_group(): setting vector does not match the size of the group",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (std::any_of(setting.begin(), setting.end(), [](double it) {return isnan(it);})) {
+            throw Exception("PlatformIO::adjust_group(): setting is NAN",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t iogroup_pos = 0; iogroup_pos < group.iogroup.size(); ++iogroup_pos) {
+            std::vector<double> &iogroup_setting = group.iogroup_setting[iogroup_pos];
+            const std::vector<int> &setting_pos = group.iogroup_setting_pos[iogroup_pos];
+            for (size_t ii = 0; ii < setting_pos.size(); ++ii) {
+                iogroup_setting[ii] = setting[setting_pos[ii]];
+            }
+            group.iogroup[iogroup_pos]->adjust_bulk(group.iogroup_control_idx[iogroup_pos],
+                                                    iogroup_setting.data());
+        }
+        m_is_active = true;
+    }
+
     void PlatformIO::read_batch(void)
     {
         for (auto &it : m_iogroup_list) {
@@ -368,28 +593,32 @@ namespace geopm
         }
         m_is_active = true;
 
-        // aggregate region totals
-        for (const auto &it : m_region_id_idx) {
-            double value = sample(it.first);
-            uint64_t region_id = geopm_signal_to_field(sample(it.second));
+        // aggregate region totals; the slot lookup is only needed
+        // at a region boundary
+        size_t num_total = m_region_total.size();
+        for (size_t pos = 0; pos != num_total; ++pos) {
+            auto &region_total = m_region_total[pos];
+            double value = sample(region_total.signal_idx);
+            uint64_t region_id = geopm_signal_to_field(sample(region_total.region_id_idx));
             region_id = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, region_id);
             // first time sampling this signal
-            if (m_last_region_id.find(it.first) == m_last_region_id.end()) {
-                m_last_region_id[it.first] = region_id;
+            if (!region_total.is_sampled) {
+                region_total.is_sampled = true;
+                region_total.last_region_id = region_id;
+                region_total.last_slot = region_slot(region_id);
                 // set start value for first region to be recording this signal
-                m_region_sample_data[std::make_pair(it.first, region_id)].last_entry_value = value;
+                m_region_last_entry[region_total.last_slot * num_total + pos] = value;
             }
-            else {
-                uint64_t last_rid = m_last_region_id[it.first];
-                // region boundary
-                if (region_id != last_rid) {
-                    // add entry to new region
-                    m_region_sample_data[std::make_pair(it.first, region_id)].last_entry_value = value;
-                    // update total for previous region
-                    m_region_sample_data[std::make_pair(it.first, last_rid)].total +=
-                        value - m_region_sample_data.at(std::make_pair(it.first, last_rid)).last_entry_value;
-                    m_last_region_id[it.first] = region_id;
-                }
+            // region boundary
+            else if (region_id != region_total.last_region_id) {
+                int slot = region_slot(region_id);
+                size_t last_idx = region_total.last_slot * num_total + pos;
+                // add entry to new region
+                m_region_last_entry[slot * num_total + pos] = value;
+                // update total for previous region
+                m_region_sample_total[last_idx] += value - m_region_last_entry[last_idx];
+                region_total.last_region_id = region_id;
+                region_total.last_slot = slot;
             }
         }
     }
@@ -153,6 +153,27 @@ namespace geopm
             virtual int push_control(const std::string &control_name,
                                      int domain_type,
                                      int domain_idx) = 0;
+            /// @brief Create a handle for a set of previously pushed
+            ///        signals that are sampled together with
+            ///        sample_group().  The IOGroup that provides
+            ///        each signal is resolved once when the group is
+            ///        created rather than on every sample.
+            /// @param [in] signal_idx Vector of indices returned by
+            ///        previous calls to push_signal() or
+            ///        push_combined_signal().
+            /// @return Index of the group when sample_group() is
+            ///         called.
+            virtual int push_signal_group(const std::vector<int> &signal_idx) = 0;
+            /// @brief Create a handle for a set of previously pushed
+            ///        controls that are adjusted together with
+            ///        adjust_group().  The IOGroup that provides
+            ///        each control is resolved once when the group is
+            ///        created rather than on every adjustment.
+            /// @param [in] control_idx Vector of indices returned by
+            ///        previous calls to push_control().
+            /// @return Index of the group when adjust_group() is
+            ///         called.
+            virtual int push_control_group(const std::vector<int> &control_idx) = 0;
             /// @brief Return number of signals that have been pushed.
             virtual int num_signal(void) const = 0;
             /// @brief Return number of controls that have been pushed.
@@ -165,6 +186,27 @@ namespace geopm
             ///        to the push_signal() method.
             /// @return Signal value measured from the platform in SI units.
             virtual double sample(int signal_idx) = 0;
+            /// @brief Sample several signals that have been pushed
+            ///        on to the signal stack.  Must be called after a
+            ///        call to read_batch().
+            /// @param [in] signal_idx Indices returned by previous
+            ///        calls to the push_signal() method.
+            /// @param [out] signal_value Resized to the length of
+            ///        signal_idx and filled with the value of each
+            ///        signal in SI units.
+            virtual void sample(const std::vector<int> &signal_idx,
+                                std::vector<double> &signal_value) = 0;
+            /// @brief Sample all signals in a group created by
+            ///        push_signal_group().  Must be called after a
+            ///        call to read_batch().
+            /// @param [in] group_idx Index returned by a previous
+            ///        call to push_signal_group().
+            /// @param [out] signal_value Resized to the number of
+            ///        signals in the group and filled with their
+            ///        values in the order they were given to
+            ///        push_signal_group().
+            virtual void sample_group(int group_idx,
+                                      std::vector<double> &signal_value) = 0;
             /// @brief Sample a signal that has been pushed to
             ///        accumlate as per-region values.  Note that
             ///        unlike other signals this is a total
@@ -188,6 +230,29 @@ namespace geopm
             /// @param [in] setting Value of control parameter in SI units.
             virtual void adjust(int control_idx,
                                 double setting) = 0;
+            /// @brief Adjust several controls that have been pushed
+            ///        on to the control stack.  These controls will
+            ///        not take effect until the next call to
+            ///        write_batch().
+            /// @param [in] control_idx Indices of the controls to be
+            ///        adjusted returned by previous calls to the
+            ///        push_control() method.
+            /// @param [in] setting Value of each control parameter
+            ///        in SI units; must be the same length as
+            ///        control_idx.
+            virtual void adjust(const std::vector<int> &control_idx,
+                                const std::vector<double> &setting) = 0;
+            /// @brief Adjust all controls in a group created by
+            ///        push_control_group().  These controls will not
+            ///        take effect until the next call to
+            ///        write_batch().
+            /// @param [in] group_idx Index returned by a previous
+            ///        call to push_control_group().
+            /// @param [in] setting Value of each control parameter
+            ///        in SI units in the order they were given to
+            ///        push_control_group().
+            virtual void adjust_group(int group_idx,
+                                      const std::vector<double> &setting) = 0;
             /// @brief Read all pushed signals so that the next call
             ///        to sample() will reflect the updated data.
             virtual void read_batch(void) = 0;
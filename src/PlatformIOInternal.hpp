@@ -37,6 +37,7 @@
 #include <list>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <functional>
 
 #include "PlatformIO.hpp"
@@ -77,11 +78,21 @@ namespace geopm
             int push_control(const std::string &control_name,
                              int domain_type,
                              int domain_idx) override;
+            int push_signal_group(const std::vector<int> &signal_idx) override;
+            int push_control_group(const std::vector<int> &control_idx) override;
             int num_signal(void) const override;
             int num_control(void) const override;
             double sample(int signal_idx) override;
+            void sample(const std::vector<int> &signal_idx,
+                        std::vector<double> &signal_value) override;
+            void sample_group(int group_idx,
+                              std::vector<double> &signal_value) override;
             double sample_region_total(int signal_idx, uint64_t region_id) override;
             void adjust(int control_idx, double setting) override;
+            void adjust(const std::vector<int> &control_idx,
+                        const std::vector<double> &setting) override;
+            void adjust_group(int group_idx,
+                              const std::vector<double> &setting) override;
             void read_batch(void) override;
             void write_batch(void) override;
             double read_signal(const std::string &signal_name,
@@ -117,16 +128,60 @@ namespace geopm
             std::vector<std::pair<IOGroup *, int> > m_active_control;
             std::map<int, std::pair<std::vector<int>,
                                     std::unique_ptr<CombinedSignal> > > m_combined_signal;
-            std::map<int, int> m_region_id_idx;
-            struct m_region_data_s
+            // Signals sampled together by sample_group() split by
+            // the IOGroup that provides them
+            struct m_signal_group_s
             {
-                double total = 0.0;
-                double last_entry_value = NAN;
+                size_t num_signal;
+                std::vector<IOGroup *> iogroup;
+                // Vectors are over the IOGroups in the group
+                std::vector<std::vector<int> > iogroup_signal_idx;
+                std::vector<std::vector<int> > iogroup_value_pos;
+                std::vector<std::vector<double> > iogroup_value;
+                // Vectors are over the combined signals in the group
+                std::vector<int> combined_signal_idx;
+                std::vector<int> combined_value_pos;
             };
-            std::map<std::pair<int, uint64_t>, m_region_data_s> m_region_sample_data;
-            // map for last region id seen in each signal's domain
-            // only used for comparison, so can leave as a double
-            std::map<int, uint64_t> m_last_region_id;
+            std::vector<m_signal_group_s> m_signal_group;
+            // Controls adjusted together by adjust_group() split by
+            // the IOGroup that provides them
+            struct m_control_group_s
+            {
+                size_t num_control;
+                std::vector<IOGroup *> iogroup;
+                // Vectors are over the IOGroups in the group
+                std::vector<std::vector<int> > iogroup_control_idx;
+                std::vector<std::vector<int> > iogroup_setting_pos;
+                std::vector<std::vector<double> > iogroup_setting;
+            };
+            std::vector<m_control_group_s> m_control_group;
+            // IOGroup indices for one run of sample() or adjust()
+            // over a vector of indices
+            std::vector<int> m_bulk_idx;
+            /// @brief Return the dense slot for a region id,
+            ///        assigning the next free slot and growing the
+            ///        region total arrays the first time the region
+            ///        is seen.
+            int region_slot(uint64_t region_id);
+            // Signals with per-region totals, in push order
+            struct m_region_total_s
+            {
+                int signal_idx;
+                int region_id_idx;
+                bool is_sampled;
+                uint64_t last_region_id;
+                int last_slot;
+            };
+            std::vector<m_region_total_s> m_region_total;
+            // Vector over signal_idx giving the position in
+            // m_region_total or -1
+            std::vector<int> m_region_total_pos;
+            // Dense slot for each region id seen by any signal
+            std::unordered_map<uint64_t, int> m_region_slot;
+            // Flat arrays indexed by slot * m_region_total.size() +
+            // position so that a new region appends a row
+            std::vector<double> m_region_sample_total;
+            std::vector<double> m_region_last_entry;
     };
 }
 
@@ -30,18 +30,133 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <fstream>
 #include <map>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 #include "geopm_sched.h"
+#include "geopm_hash.h"
 #include "PlatformTopo.hpp"
 #include "Exception.hpp"
 
 #include "config.h"
 
+#define GEOPM_TOPO_CACHE_PREFIX "/dev/shm/geopm-topo-"
+
 namespace geopm
 {
+    static std::string read_sysfs(const std::string &path)
+    {
+        std::ifstream sysfs_file(path);
+        std::string result;
+        if (!sysfs_file.good() || !std::getline(sysfs_file, result)) {
+            throw Exception("PlatformTopo: unable to read " + path,
+                            GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    /// @brief Parse a Linux CPU list, e.g. "0-3,8,10-11".
+    static std::set<int> read_cpu_list(const std::string &path)
+    {
+        std::set<int> result;
+        std::istringstream list_stream(read_sysfs(path));
+        std::string range;
+        while (std::getline(list_stream, range, ',')) {
+            if (range.empty()) {
+                continue;
+            }
+            size_t dash_pos = range.find('-');
+            try {
+                int first = std::stoi(range.substr(0, dash_pos));
+                int last = dash_pos == std::string::npos ?
+                           first : std::stoi(range.substr(dash_pos + 1));
+                for (int cpu_idx = first; cpu_idx <= last; ++cpu_idx) {
+                    result.insert(cpu_idx);
+                }
+            }
+            catch (const std::logic_error &ex) {
+                throw Exception("PlatformTopo: invalid CPU list in " + path,
+                                GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Format a CPU set as a hex mask as printed by lscpu -x.
+    static std::string hex_mask(const std::set<int> &cpu_set)
+    {
+        std::string result;
+        int num_nibble = cpu_set.size() ? *cpu_set.rbegin() / 4 + 1 : 1;
+        for (int nibble_idx = num_nibble - 1; nibble_idx >= 0; --nibble_idx) {
+            int nibble = 0;
+            for (int bit_idx = 0; bit_idx != 4; ++bit_idx) {
+                if (cpu_set.find(nibble_idx * 4 + bit_idx) != cpu_set.end()) {
+                    nibble |= 1 << bit_idx;
+                }
+            }
+            result += "0123456789abcdef"[nibble];
+        }
+        return "0x" + result;
+    }
+
+    /// @brief Read the topology cache if it exists and can be
+    ///        trusted; returns an empty string otherwise.
+    static std::string read_topo_cache(const std::string &path)
+    {
+        std::string result;
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            return result;
+        }
+        struct stat stat_buf;
+        // Only trust a cache created by this user or root that
+        // nobody else can modify.
+        if (!fstat(fd, &stat_buf) &&
+            S_ISREG(stat_buf.st_mode) &&
+            (stat_buf.st_uid == getuid() || stat_buf.st_uid == 0) &&
+            !(stat_buf.st_mode & (S_IWGRP | S_IWOTH)) &&
+            stat_buf.st_size > 0) {
+            void *cache_ptr = mmap(NULL, stat_buf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (cache_ptr != MAP_FAILED) {
+                result.assign((const char *)cache_ptr, stat_buf.st_size);
+                (void)munmap(cache_ptr, stat_buf.st_size);
+            }
+        }
+        (void)close(fd);
+        return result;
+    }
+
+    /// @brief Create the topology cache.  The cache is written to a
+    ///        temporary file and renamed into place so that other
+    ///        processes never observe a partial cache.  Failure is
+    ///        not an error since the cache is only an optimization.
+    static void write_topo_cache(const std::string &path, const std::string &lscpu_str)
+    {
+        std::string tmp_path = path + ".XXXXXX";
+        int fd = mkstemp(&tmp_path[0]);
+        if (fd == -1) {
+            return;
+        }
+        bool is_written = !fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) &&
+                          write(fd, lscpu_str.data(), lscpu_str.size()) == (ssize_t)lscpu_str.size();
+        is_written = !close(fd) && is_written;
+        if (!is_written || rename(tmp_path.c_str(), path.c_str())) {
+            // Another process may own the cache; the caller keeps
+            // using the description it just created.
+            (void)unlink(tmp_path.c_str());
+        }
+    }
+
     IPlatformTopo &platform_topo(void)
     {
         static PlatformTopo instance;
@@ -49,13 +164,21 @@ namespace geopm
     }
 
     PlatformTopo::PlatformTopo()
-        : PlatformTopo("")
+        : PlatformTopo("", cache_path())
     {
 
     }
 
     PlatformTopo::PlatformTopo(const std::string &lscpu_file_name)
+        : PlatformTopo(lscpu_file_name, "")
+    {
+
+    }
+
+    PlatformTopo::PlatformTopo(const std::string &lscpu_file_name,
+                               const std::string &cache_path)
         : m_lscpu_file_name(lscpu_file_name)
+        , m_cache_path(cache_path)
     {
         std::map<std::string, std::string> lscpu_map;
         lscpu(lscpu_map);
@@ -393,34 +516,155 @@ namespace geopm
         }
     }
 
-    void PlatformTopo::lscpu(std::map<std::string, std::string> &lscpu_map)
+    std::string PlatformTopo::read_lscpu(void)
     {
         std::string result;
-
         FILE *fid = open_lscpu();
+        char buffer[1024];
+        size_t num_read = 0;
+        while ((num_read = fread(buffer, 1, sizeof(buffer), fid)) != 0) {
+            result.append(buffer, num_read);
+        }
+        close_lscpu(fid);
+        return result;
+    }
+
+    std::string PlatformTopo::cache_path(void)
+    {
+        std::string result;
+        std::ifstream boot_id_file("/proc/sys/kernel/random/boot_id");
+        std::string boot_id;
+        std::string online_cpu;
+        try {
+            online_cpu = read_sysfs("/sys/devices/system/cpu/online");
+        }
+        catch (const Exception &ex) {
+            // Without sysfs the cache can not be validated.
+        }
+        if (boot_id_file.good() && std::getline(boot_id_file, boot_id) &&
+            boot_id.size() &&
+            boot_id.find('/') == std::string::npos &&
+            online_cpu.size()) {
+            // The cache is per user: /dev/shm is sticky so a file
+            // created by another user can not be replaced.  The hash
+            // of the online CPU list is part of the name so that a
+            // CPU brought online or offline after boot creates a new
+            // cache.
+            std::ostringstream online_hash;
+            online_hash << std::hex << geopm_crc32_str(0, online_cpu.c_str());
+            result = GEOPM_TOPO_CACHE_PREFIX + std::to_string(getuid()) + "-" +
+                     boot_id + "-" + online_hash.str();
+        }
+        return result;
+    }
+
+    std::string PlatformTopo::cached_lscpu(void)
+    {
+        const std::string &path = m_cache_path;
+        std::string result;
+        if (path.size()) {
+            result = read_topo_cache(path);
+        }
+        if (result.empty()) {
+            try {
+                result = sysfs_lscpu("/sys/devices/system");
+                if (path.size()) {
+                    write_topo_cache(path, result);
+                }
+            }
+            catch (const Exception &ex) {
+                // sysfs is not available, e.g. in a restricted
+                // container; fall back to the lscpu command.
+                result = read_lscpu();
+            }
+        }
+        return result;
+    }
+
+    std::string PlatformTopo::sysfs_lscpu(const std::string &sysfs_path)
+    {
+        const std::string cpu_path = sysfs_path + "/cpu/";
+        // Every field is derived from this one read of the online
+        // CPUs so that the description is consistent.
+        std::set<int> online_cpu = read_cpu_list(cpu_path + "online");
+        if (online_cpu.empty()) {
+            throw Exception("PlatformTopo::sysfs_lscpu(): no online CPUs found",
+                            GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+        }
+        // A core is identified by the lowest CPU of its hyper-thread
+        // siblings, which is unique even on multi-die packages where
+        // core_id values repeat.
+        std::set<int> package_id;
+        std::set<int> core_id;
+        size_t thread_per_core = 0;
+        for (int cpu_idx : online_cpu) {
+            std::string topo_path = cpu_path + "cpu" + std::to_string(cpu_idx) + "/topology/";
+            std::string package_str = read_sysfs(topo_path + "physical_package_id");
+            try {
+                package_id.insert(std::stoi(package_str));
+            }
+            catch (const std::logic_error &ex) {
+                throw Exception("PlatformTopo::sysfs_lscpu(): invalid package id for CPU " +
+                                std::to_string(cpu_idx), GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+            }
+            std::set<int> sibling_cpu = read_cpu_list(topo_path + "thread_siblings_list");
+            if (sibling_cpu.empty()) {
+                throw Exception("PlatformTopo::sysfs_lscpu(): empty thread siblings list for CPU " +
+                                std::to_string(cpu_idx), GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+            }
+            core_id.insert(*sibling_cpu.begin());
+            thread_per_core = std::max(thread_per_core, sibling_cpu.size());
+        }
+        std::vector<std::set<int> > numa_cpu;
+        const std::string node_path = sysfs_path + "/node/";
+        std::set<int> online_node;
+        try {
+            online_node = read_cpu_list(node_path + "online");
+        }
+        catch (const Exception &ex) {
+            // Kernel without NUMA support: one node with every CPU.
+            numa_cpu.push_back(online_cpu);
+        }
+        for (int node_idx : online_node) {
+            numa_cpu.push_back(read_cpu_list(node_path + "node" + std::to_string(node_idx) + "/cpulist"));
+        }
 
+        std::ostringstream result;
+        result << "CPU(s):                " << online_cpu.size() << "\n"
+               << "On-line CPU(s) mask:   " << hex_mask(online_cpu) << "\n"
+               << "Thread(s) per core:    " << thread_per_core << "\n"
+               << "Core(s) per socket:    " << core_id.size() / package_id.size() << "\n"
+               << "Socket(s):             " << package_id.size() << "\n"
+               << "NUMA node(s):          " << numa_cpu.size() << "\n";
+        for (size_t node_idx = 0; node_idx != numa_cpu.size(); ++node_idx) {
+            result << "NUMA node" << node_idx << " CPU(s):     " << hex_mask(numa_cpu[node_idx]) << "\n";
+        }
+        return result.str();
+    }
+
+    void PlatformTopo::lscpu(std::map<std::string, std::string> &lscpu_map)
+    {
+        std::istringstream lscpu_stream(m_lscpu_file_name.size() ?
+                                        read_lscpu() : cached_lscpu());
         std::string line;
-        while (!feof(fid)) {
-            char cline[1024] = {};
-            if (fgets(cline, 1024, fid)) {
-                line = cline;
-                size_t colon_pos = line.find(":");
-                if (colon_pos != std::string::npos) {
-                    std::string key(line.substr(0, colon_pos));
-                    std::string value(line.substr(colon_pos + 1));
-                    size_t ws_pos = value.find_first_not_of(" \t");
-                    if (ws_pos &&
-                        ws_pos < value.size() - 1 &&
-                        ws_pos != std::string::npos) {
-                        // Trim leading white space and '\n' from end of line
-                        value = value.substr(ws_pos, value.size() - ws_pos - 1);
-                    }
-                    if (key.size()) {
-                        lscpu_map.emplace(key, value);
-                    }
+        while (std::getline(lscpu_stream, line)) {
+            size_t colon_pos = line.find(":");
+            if (colon_pos != std::string::npos) {
+                std::string key(line.substr(0, colon_pos));
+                std::string value(line.substr(colon_pos + 1));
+                // Trim white space from both ends of the value
+                size_t begin_pos = value.find_first_not_of(" \t");
+                size_t end_pos = value.find_last_not_of(" \t\r");
+                if (begin_pos == std::string::npos) {
+                    value.clear();
+                }
+                else {
+                    value = value.substr(begin_pos, end_pos - begin_pos + 1);
+                }
+                if (key.size()) {
+                    lscpu_map.emplace(key, value);
                 }
             }
         }
-        close_lscpu(fid);
     }
 }
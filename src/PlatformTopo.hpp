@@ -113,8 +113,28 @@ namespace geopm
     class PlatformTopo : public IPlatformTopo
     {
         public:
+            /// @brief Construct the topology of the running
+            ///        platform.
+            ///
+            /// The topology is parsed from sysfs and cached at
+            /// cache_path(), so only the first process of a user on
+            /// a node after boot parses sysfs and every later process
+            /// maps the cached copy.  If sysfs can not be parsed the
+            /// output of "lscpu -x" is used.
             PlatformTopo();
+            /// @brief Construct the topology from a file in the
+            ///        format of "lscpu -x" output.
             PlatformTopo(const std::string &lscpu_file_name);
+            /// @brief Construct the topology from a file in the
+            ///        format of "lscpu -x" output, or if
+            ///        lscpu_file_name is empty from the running
+            ///        platform using the cache at cache_path.
+            /// @param [in] lscpu_file_name Path to "lscpu -x" output
+            ///        or empty.
+            /// @param [in] cache_path Path of the topology cache;
+            ///        if empty no cache is used.
+            PlatformTopo(const std::string &lscpu_file_name,
+                         const std::string &cache_path);
             virtual ~PlatformTopo() = default;
             int num_domain(int domain_type) const override;
             void domain_cpus(int domain_type,
@@ -124,8 +144,29 @@ namespace geopm
                            int cpu_idx) const override;
             int define_cpu_group(const std::vector<int> &cpu_domain_idx) override;
             bool is_domain_within(int inner_domain, int outer_domain) override;
+            /// @brief Describe the platform topology in the format
+            ///        of "lscpu -x" output by parsing sysfs.
+            ///
+            /// Only the keys used by PlatformTopo are written.
+            ///
+            /// @param [in] sysfs_path Path to the system devices
+            ///        directory, normally "/sys/devices/system".
+            ///
+            /// @return Text that can be parsed by the PlatformTopo
+            ///         constructor.
+            static std::string sysfs_lscpu(const std::string &sysfs_path);
+            /// @brief Path of the topology cache for the running
+            ///        kernel, user and set of online CPUs; empty if
+            ///        the boot id or the online CPU list is not
+            ///        available.
+            static std::string cache_path(void);
         private:
             void lscpu(std::map<std::string, std::string> &lscpu_map);
+            /// @brief Read the whole output of open_lscpu().
+            std::string read_lscpu(void);
+            /// @brief Get the cached description of the running
+            ///        platform, creating the cache if required.
+            std::string cached_lscpu(void);
             void parse_lscpu(const std::map<std::string, std::string> &lscpu_map,
                              int &num_package,
                              int &core_per_package,
@@ -136,6 +177,7 @@ namespace geopm
             void close_lscpu(FILE *fid);
 
             const std::string m_lscpu_file_name;
+            const std::string m_cache_path;
             int m_num_package;
             int m_core_per_package;
             int m_thread_per_core;
@@ -53,15 +53,18 @@
 #include "geopm_signal_handler.h"
 #include "geopm_sched.h"
 #include "geopm_env.h"
+#include "geopm_hash.h"
 #include "PlatformTopo.hpp"
 #include "Profile.hpp"
 #include "ProfileTable.hpp"
+#include "ProfileNameArena.hpp"
 #include "ProfileThread.hpp"
 #include "SampleScheduler.hpp"
 #include "ControlMessage.hpp"
 #include "SharedMemory.hpp"
 #include "Exception.hpp"
 #include "Comm.hpp"
+#include "Helper.hpp"
 #include "config.h"
 
 namespace geopm
@@ -79,6 +82,7 @@ namespace geopm
         , m_ctl_msg(std::move(ctl_msg))
         , m_table_shmem(nullptr)
         , m_table(std::move(table))
+        , m_name_shmem(nullptr)
         , m_tprof_shmem(nullptr)
         , m_tprof_table(t_table)
         , m_scheduler(std::move(scheduler))
@@ -92,6 +96,9 @@ namespace geopm
         , m_overhead_time(0.0)
         , m_overhead_time_startup(0.0)
         , m_overhead_time_shutdown(0.0)
+        , m_overhead_time_rendezvous(0.0)
+        , m_region_cache(M_REGION_CACHE_SIZE, M_REGION_CACHE_PROBE_MAX)
+        , m_region_cache_name(M_REGION_CACHE_SIZE)
     {
 #ifdef GEOPM_OVERHEAD
         struct geopm_time_s overhead_entry;
@@ -149,7 +156,16 @@ namespace geopm
     void Profile::init_ctl_msg(const std::string &sample_key)
     {
         if (!m_ctl_msg) {
+#ifdef GEOPM_OVERHEAD
+            struct geopm_time_s overhead_entry;
+            geopm_time(&overhead_entry);
+#endif
             m_ctl_shmem = std::unique_ptr<ISharedMemoryUser>(new SharedMemoryUser(sample_key, geopm_env_profile_timeout())); // 5 second timeout
+#ifdef GEOPM_OVERHEAD
+            struct geopm_time_s overhead_exit;
+            geopm_time(&overhead_exit);
+            m_overhead_time_rendezvous = geopm_time_diff(&overhead_entry, &overhead_exit);
+#endif
             m_shm_comm->barrier();
             if (!m_shm_rank) {
                 m_ctl_shmem->unlink();
@@ -171,7 +187,7 @@ namespace geopm
         cpu_set_t *proc_cpuset = NULL;
 #ifdef POWERPC
         num_cpu = geopm_sched_cpu_conf();
-#else
+#endif
         proc_cpuset = CPU_ALLOC(num_cpu);
         if (!proc_cpuset) {
             throw Exception("Profile: unable to allocate process CPU mask",
@@ -248,7 +264,10 @@ namespace geopm
             table_shm_key += "-" + std::to_string(m_rank);
             m_table_shmem = std::unique_ptr<ISharedMemoryUser>(new SharedMemoryUser(table_shm_key, 3.0));
             m_table_shmem->unlink();
-            m_table = std::unique_ptr<IProfileTable>(new ProfileTable(m_table_shmem->size(), m_table_shmem->pointer()));
+            m_table = IProfileTable::make_table(m_table_shmem->size(), m_table_shmem->pointer(), true);
+            m_name_shmem = std::unique_ptr<ISharedMemoryUser>(new SharedMemoryUser(table_shm_key + "-name", 3.0));
+            m_name_shmem->unlink();
+            m_table->name_arena(geopm::make_unique<ProfileNameArena>(m_name_shmem->size(), m_name_shmem->pointer()));
         }
 
         m_shm_comm->barrier();
@@ -291,7 +310,12 @@ namespace geopm
         m_is_enabled = false;
     }
 
-    uint64_t Profile::region(const std::string region_name, long hint)
+    uint64_t Profile::region(const std::string &region_name, long hint)
+    {
+        return region(region_name.c_str(), hint);
+    }
+
+    uint64_t Profile::region(const char *region_name, long hint)
     {
         if (!m_is_enabled) {
             return 0;
@@ -302,7 +326,7 @@ namespace geopm
         geopm_time(&overhead_entry);
 #endif
 
-        uint64_t result = m_table->key(region_name);
+        uint64_t result = region_key(region_name);
         /// Record hint when registering a region.
         result = geopm_region_id_set_hint(hint, result);
 
@@ -315,6 +339,22 @@ namespace geopm
         return result;
     }
 
+    uint64_t Profile::region_key(const char *region_name)
+    {
+        return m_region_cache.region_id(geopm_crc32_str(0, region_name),
+                                        [this, region_name](int slot_idx)
+                                        {
+                                            if (slot_idx >= 0) {
+                                                m_region_cache_name[slot_idx] = region_name;
+                                            }
+                                            return m_table->key(region_name);
+                                        },
+                                        [this, region_name](int slot_idx)
+                                        {
+                                            return m_region_cache_name[slot_idx] == region_name;
+                                        });
+    }
+
     void Profile::enter(uint64_t region_id)
     {
         if (!m_is_enabled) {
@@ -362,7 +402,9 @@ namespace geopm
 #ifdef GEOPM_OVERHEAD
         struct geopm_time_s overhead_exit;
         geopm_time(&overhead_exit);
-        m_overhead_time += geopm_time_diff(&overhead_entry, &overhead_exit);
+        double overhead = geopm_time_diff(&overhead_entry, &overhead_exit);
+        m_overhead_time += overhead;
+        m_overhead_enter.insert(overhead);
 #endif
 
     }
@@ -414,7 +456,9 @@ namespace geopm
 #ifdef GEOPM_OVERHEAD
         struct geopm_time_s overhead_exit;
         geopm_time(&overhead_exit);
-        m_overhead_time += geopm_time_diff(&overhead_entry, &overhead_exit);
+        double overhead = geopm_time_diff(&overhead_entry, &overhead_exit);
+        m_overhead_time += overhead;
+        m_overhead_exit.insert(overhead);
 #endif
 
     }
@@ -530,10 +574,10 @@ namespace geopm
         m_ctl_msg->wait();  // M_STATUS_NAME_BEGIN
 
         size_t buffer_offset = 0;
-        size_t buffer_remain = m_table_shmem->size();
-        char *buffer_ptr = (char *)(m_table_shmem->pointer());
+        size_t buffer_remain = m_table_shmem->size() - m_table->name_offset();
+        char *buffer_ptr = (char *)(m_table_shmem->pointer()) + m_table->name_offset();
 
-        if (m_table_shmem->size() < file_name.length() + 1 + m_prof_name.length() + 1) {
+        if (buffer_remain < file_name.length() + 1 + m_prof_name.length() + 1) {
             throw Exception("Profile:print() profile file name and profile name are too long to fit in a table buffer", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
 
@@ -562,16 +606,46 @@ namespace geopm
         struct geopm_time_s overhead_exit;
         geopm_time(&overhead_exit);
         m_overhead_time += geopm_time_diff(&overhead_entry, &overhead_exit);
-        double overhead_buffer[3] = {m_overhead_time_startup,
+        // The enter and exit histograms are summarized on each rank
+        // and the worst rank is reported for each statistic.
+        auto rank_percentile = [] (const LatencyHistogram &hist, double fraction) {
+            return hist.count() ? hist.percentile(fraction) : 0.0;
+        };
+        double overhead_buffer[9] = {m_overhead_time_startup,
                                      m_overhead_time,
-                                     m_overhead_time_shutdown};
-        double max_overhead[3] = {};
-        MPI_Reduce(overhead_buffer, max_overhead, 3,
+                                     m_overhead_time_shutdown,
+                                     rank_percentile(m_overhead_enter, 0.5),
+                                     rank_percentile(m_overhead_enter, 0.99),
+                                     m_overhead_enter.max(),
+                                     rank_percentile(m_overhead_exit, 0.5),
+                                     rank_percentile(m_overhead_exit, 0.99),
+                                     m_overhead_exit.max()};
+        double max_overhead[9] = {};
+        MPI_Reduce(overhead_buffer, max_overhead, 9,
                    MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
         if (!m_rank) {
             std::cout << "GEOPM startup (seconds):  " << max_overhead[0] << std::endl;
             std::cout << "GEOPM runtime (seconds):  " << max_overhead[1] << std::endl;
             std::cout << "GEOPM shutdown (seconds): " << max_overhead[2] << std::endl;
+            std::cout << "GEOPM enter p50/p99/max (seconds): " << max_overhead[3] << " "
+                      << max_overhead[4] << " " << max_overhead[5] << std::endl;
+            std::cout << "GEOPM exit p50/p99/max (seconds):  " << max_overhead[6] << " "
+                      << max_overhead[7] << " " << max_overhead[8] << std::endl;
+        }
+        // Report the spread of controller rendezvous latency and the
+        // slowest rank to help find launch bottlenecks.
+        struct {
+            double time;
+            int rank;
+        } rendezvous = {m_overhead_time_rendezvous, m_rank}, rendezvous_max = {};
+        double rendezvous_min = 0.0;
+        MPI_Reduce(&rendezvous, &rendezvous_max, 1,
+                   MPI_DOUBLE_INT, MPI_MAXLOC, 0, MPI_COMM_WORLD);
+        MPI_Reduce(&m_overhead_time_rendezvous, &rendezvous_min, 1,
+                   MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+        if (!m_rank) {
+            std::cout << "GEOPM rendezvous min/max (seconds): " << rendezvous_min << " "
+                      << rendezvous_max.time << " (rank " << rendezvous_max.rank << ")" << std::endl;
         }
 #endif
 
@@ -39,6 +39,9 @@
 #include <list>
 #include <memory>
 
+#include "LatencyHistogram.hpp"
+#include "RegionIdCache.hpp"
+
 namespace geopm
 {
     class IComm;
@@ -115,7 +118,7 @@ namespace geopm
             ///         Profile::exit(), Profile::progress and
             ///         Profile::sample() to associate these calls with
             ///         the registered region.
-            virtual uint64_t region(const std::string region_name, long hint) = 0;
+            virtual uint64_t region(const std::string &region_name, long hint) = 0;
             /// @brief Mark a region entry point.
             ///
             /// Called to denote the beginning of region of code that
@@ -225,7 +228,14 @@ namespace geopm
                     std::shared_ptr<IProfileThreadTable> t_table, std::unique_ptr<ISampleScheduler> scheduler);
             /// @brief Profile destructor, virtual.
             virtual ~Profile();
-            uint64_t region(const std::string region_name, long hint) override;
+            uint64_t region(const std::string &region_name, long hint) override;
+            /// @brief Register a region by C string name.
+            ///
+            /// Equivalent to region(const std::string &, long), but
+            /// after the first call for a name the region ID is
+            /// found in a per-process cache with one hash probe and
+            /// without allocating a std::string.
+            uint64_t region(const char *region_name, long hint);
             void enter(uint64_t region_id) override;
             void exit(uint64_t region_id) override;
             void progress(uint64_t region_id, double fraction) override;
@@ -248,6 +258,12 @@ namespace geopm
         private:
             enum m_profile_const_e {
                 M_PROF_SAMPLE_PERIOD = 1,
+                /// Number of slots in the region name cache, must be
+                /// a power of two.
+                M_REGION_CACHE_SIZE = 1024,
+                /// Number of slots searched before falling back to
+                /// the ProfileTable key map.
+                M_REGION_CACHE_PROBE_MAX = 16,
             };
 
             /// @brief Post profile sample.
@@ -256,6 +272,13 @@ namespace geopm
             /// information collected.  This sample is posted to the
             /// geopm::Controller through shared memory.
             void sample(void);
+            /// @brief Region ID without hint for the region name.
+            ///
+            /// Safe to call concurrently from any thread.  The first
+            /// caller for a name resolves it with the ProfileTable
+            /// and interns it; threads that race with the
+            /// registration use the ProfileTable directly.
+            uint64_t region_key(const char *region_name);
             /// @brief Print profile report to a file.
             ///
             /// Writes a profile report to a file with the given
@@ -301,6 +324,9 @@ namespace geopm
             /// @brief Hash table for sample messages contained in
             ///        shared memory.
             std::unique_ptr<IProfileTable> m_table;
+            /// @brief Attaches to the shared memory region where
+            ///        region names are interned for the geopm runtime.
+            std::unique_ptr<ISharedMemoryUser> m_name_shmem;
             std::unique_ptr<ISharedMemoryUser> m_tprof_shmem;
             std::shared_ptr<IProfileThreadTable> m_tprof_table;
             std::unique_ptr<ISampleScheduler> m_scheduler;
@@ -322,6 +348,19 @@ namespace geopm
             double m_overhead_time;
             double m_overhead_time_startup;
             double m_overhead_time_shutdown;
+            /// @brief Time spent waiting for the controller to create
+            ///        the control shared memory region.
+            double m_overhead_time_rendezvous;
+            /// @brief Per call overhead of enter() and exit(); only
+            ///        recorded when built with --enable-overhead.
+            LatencyHistogram m_overhead_enter;
+            LatencyHistogram m_overhead_exit;
+            /// @brief Cache of region name hashes registered by this
+            ///        process.
+            RegionIdCache m_region_cache;
+            /// @brief Region name interned in each slot of
+            ///        m_region_cache, used to reject hash collisions.
+            std::vector<std::string> m_region_cache_name;
     };
 }
 
@@ -40,7 +40,7 @@
 
 namespace geopm
 {
-    template <typename T> class CircularBuffer;
+    template <class type, size_t max_size> class FixedCircularBuffer;
 
     class IProfileIOSample
     {
@@ -87,7 +87,7 @@ namespace geopm
             std::vector<uint64_t> m_region_id;
             /// @brief Per rank record of last profile samples in
             ///        m_region_id_prev
-            std::vector<CircularBuffer<struct m_rank_sample_s> > m_rank_sample_buffer;
+            std::vector<FixedCircularBuffer<struct m_rank_sample_s, 2> > m_rank_sample_buffer;
             /// @brief Vector to multiply with signal_domain_matrix to
             /// project into control domains
             std::vector<double> m_aligned_signal;
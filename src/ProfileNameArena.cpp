@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "ProfileNameArena.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    ProfileNameArena::ProfileNameArena(size_t size, void *buffer)
+        : m_buffer_size(size)
+        , m_header((struct arena_header_s *)buffer)
+        , m_data((char *)buffer + sizeof(struct arena_header_s))
+        , m_insert_lock(PTHREAD_MUTEX_INITIALIZER)
+    {
+        if (buffer == NULL) {
+            throw Exception("ProfileNameArena: Buffer pointer is NULL",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (size < sizeof(struct arena_header_s) + record_size(0)) {
+            throw Exception("ProfileNameArena: Buffer size too small",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_buffer_size -= sizeof(struct arena_header_s);
+    }
+
+    size_t ProfileNameArena::record_size(size_t length)
+    {
+        // Keep records aligned to the key for the next record.
+        size_t result = sizeof(struct arena_record_s) + length + 1;
+        return (result + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    }
+
+    bool ProfileNameArena::insert(uint64_t key, const std::string &name)
+    {
+        int err = pthread_mutex_lock(&m_insert_lock);
+        if (err) {
+            throw Exception("ProfileNameArena::insert(): pthread_mutex_lock()", err, __FILE__, __LINE__);
+        }
+        bool result = false;
+        uint64_t offset = m_header->size;
+        size_t rec_size = record_size(name.length());
+        if (!m_header->is_overflow &&
+            rec_size <= m_buffer_size - offset) {
+            struct arena_record_s *record = (struct arena_record_s *)(m_data + offset);
+            record->key = key;
+            record->length = name.length();
+            memcpy((char *)(record + 1), name.c_str(), name.length() + 1);
+            __atomic_store_n(&(m_header->num_name), m_header->num_name + 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&(m_header->size), offset + rec_size, __ATOMIC_RELEASE);
+            result = true;
+        }
+        else {
+            __atomic_store_n(&(m_header->is_overflow), 1, __ATOMIC_RELEASE);
+        }
+        err = pthread_mutex_unlock(&m_insert_lock);
+        if (err) {
+            throw Exception("ProfileNameArena::insert(): pthread_mutex_unlock()", err, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    void ProfileNameArena::name_set(std::set<std::string> &name) const
+    {
+        uint64_t size = __atomic_load_n(&(m_header->size), __ATOMIC_ACQUIRE);
+        if (size > m_buffer_size) {
+            throw Exception("ProfileNameArena::name_set(): arena size is corrupt",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        uint64_t offset = 0;
+        while (offset < size) {
+            if (size - offset < record_size(0)) {
+                throw Exception("ProfileNameArena::name_set(): record is truncated",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            const struct arena_record_s *record = (const struct arena_record_s *)(m_data + offset);
+            if (record->length >= size - offset ||
+                record_size(record->length) > size - offset) {
+                throw Exception("ProfileNameArena::name_set(): record is truncated",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            name.emplace((const char *)(record + 1), record->length);
+            offset += record_size(record->length);
+        }
+    }
+
+    size_t ProfileNameArena::num_name(void) const
+    {
+        return __atomic_load_n(&(m_header->num_name), __ATOMIC_ACQUIRE);
+    }
+
+    bool ProfileNameArena::is_overflow(void) const
+    {
+        return __atomic_load_n(&(m_header->is_overflow), __ATOMIC_ACQUIRE);
+    }
+}
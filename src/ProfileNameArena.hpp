@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef PROFILENAMEARENA_HPP_INCLUDE
+#define PROFILENAMEARENA_HPP_INCLUDE
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include <set>
+#include <string>
+
+namespace geopm
+{
+    /// @brief Append-only store of region names shared between an
+    ///        application rank and the controller.
+    ///
+    /// The application rank interns each region name along with its
+    /// hash the first time the name is registered.  Records are
+    /// written into the buffer before the used size in the header is
+    /// advanced with release semantics, so the controller can read
+    /// every published name at any time without a handshake.  The
+    /// buffer is expected to be zero filled when it is created, which
+    /// is a valid empty arena; neither side formats the buffer.  Once
+    /// a name does not fit the arena is marked as overflowed and the
+    /// producer must pass the remaining names by other means.
+    class ProfileNameArena
+    {
+        public:
+            /// @brief Wrap an arena around an existing buffer.
+            ///
+            /// @param [in] size The length of the buffer in bytes.
+            ///
+            /// @param [in] buffer Pointer to beginning of virtual
+            ///        address range used for storing the names.
+            ProfileNameArena(size_t size, void *buffer);
+            virtual ~ProfileNameArena() = default;
+            /// @brief Called by the producer to append a name.
+            ///
+            /// @param [in] key Hash of the name returned by
+            ///        IProfileTable::key().
+            ///
+            /// @param [in] name Region name.
+            ///
+            /// @return True if the name was published, false if the
+            ///         arena has overflowed.
+            bool insert(uint64_t key, const std::string &name);
+            /// @brief Called by the consumer to read all names
+            ///        published so far.
+            ///
+            /// @param [out] name Set that the names are inserted into.
+            void name_set(std::set<std::string> &name) const;
+            /// @brief Number of names published in the arena.
+            size_t num_name(void) const;
+            /// @brief True if a name failed to fit in the arena.
+            bool is_overflow(void) const;
+        private:
+            struct arena_header_s {
+                uint64_t size;
+                uint64_t num_name;
+                uint64_t is_overflow;
+            };
+            struct arena_record_s {
+                uint64_t key;
+                uint64_t length;
+            };
+            static size_t record_size(size_t length);
+            size_t m_buffer_size;
+            struct arena_header_s *m_header;
+            char *m_data;
+            pthread_mutex_t m_insert_lock;
+    };
+}
+
+#endif
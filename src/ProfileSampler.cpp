@@ -58,6 +58,7 @@
 #include "PlatformTopo.hpp"
 #include "ProfileSampler.hpp"
 #include "ProfileTable.hpp"
+#include "ProfileNameArena.hpp"
 #include "ProfileThread.hpp"
 #include "SampleScheduler.hpp"
 #include "Comm.hpp"
@@ -145,6 +146,15 @@ namespace geopm
         m_ctl_msg->step();  // M_STATUS_SAMPLE_BEGIN
     }
 
+    size_t ProfileSampler::num_drop(void)
+    {
+        size_t result = 0;
+        for (const auto &rank_sampler : m_rank_sampler) {
+            result += rank_sampler->num_drop();
+        }
+        return result;
+    }
+
     int ProfileSampler::rank_per_node(void)
     {
         return m_rank_per_node;
@@ -280,8 +290,14 @@ namespace geopm
         std::string key_path("/dev/shm/" + shm_key);
         (void)unlink(key_path.c_str());
         errno = 0; // Ignore errors from the unlink call.
-        m_table_shmem = geopm::make_unique<SharedMemory>(shm_key, table_size);
-        m_table = geopm::make_unique<ProfileTable>(m_table_shmem->size(), m_table_shmem->pointer());
+        m_table_shmem = geopm::make_unique<SharedMemory>(shm_key, IProfileTable::make_table_size(table_size));
+        m_table = IProfileTable::make_table(m_table_shmem->size(), m_table_shmem->pointer(), false);
+        std::string name_key(shm_key + "-name");
+        key_path = "/dev/shm/" + name_key;
+        (void)unlink(key_path.c_str());
+        errno = 0; // Ignore errors from the unlink call.
+        m_name_shmem = geopm::make_unique<SharedMemory>(name_key, M_NAME_ARENA_SIZE);
+        m_name_arena = geopm::make_unique<ProfileNameArena>(m_name_shmem->size(), m_name_shmem->pointer());
     }
 
     size_t ProfileRankSampler::capacity(void)
@@ -289,10 +305,19 @@ namespace geopm
         return m_table->capacity();
     }
 
+    size_t ProfileRankSampler::num_drop(void)
+    {
+        return m_table->num_drop();
+    }
+
     void ProfileRankSampler::sample(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content_begin, size_t &length)
     {
         m_table->dump(content_begin, length);
-        std::stable_sort(content_begin, content_begin + length, geopm_prof_compare);
+        // Tables that deliver values in insertion order, such as the
+        // ProfileRingTable, are already sorted by timestamp.
+        if (!std::is_sorted(content_begin, content_begin + length, geopm_prof_compare)) {
+            std::stable_sort(content_begin, content_begin + length, geopm_prof_compare);
+        }
     }
 
     bool ProfileRankSampler::name_fill(std::set<std::string> &name_set)
@@ -301,12 +326,18 @@ namespace geopm
 
         if (!m_is_name_finished) {
             if (name_set.empty()) {
-                m_report_name = (char *)m_table_shmem->pointer();
+                char *name_ptr = (char *)m_table_shmem->pointer() + m_table->name_offset();
+                m_report_name = name_ptr;
                 header_offset += m_report_name.length() + 1;
-                m_prof_name = (char *)m_table_shmem->pointer() + header_offset;
+                m_prof_name = name_ptr + header_offset;
                 header_offset += m_prof_name.length() + 1;
             }
             m_is_name_finished = m_table->name_set(header_offset, name_set);
+            if (m_is_name_finished) {
+                // Names interned by the application in the arena are
+                // not sent through the table buffer.
+                m_name_arena->name_set(name_set);
+            }
         }
 
         return m_is_name_finished;
@@ -46,6 +46,7 @@ namespace geopm
     class ISharedMemory;
     class IControlMessage;
     class IProfileTable;
+    class ProfileNameArena;
     class IProfileThreadTable;
 
     class IProfileRankSampler
@@ -84,6 +85,9 @@ namespace geopm
             virtual bool name_fill(std::set<std::string> &name_set) = 0;
             virtual void report_name(std::string &report_str) = 0;
             virtual void profile_name(std::string &prof_str) = 0;
+            /// @brief Number of messages from the rank discarded
+            ///        because the table was full.
+            virtual size_t num_drop(void) = 0;
     };
 
     class IProfileSampler
@@ -159,6 +163,9 @@ namespace geopm
             /// @brief Signal to the application that the controller
             ///        is ready to begin receiving samples.
             virtual void controller_ready(void) = 0;
+            /// @brief Total number of messages discarded by all
+            ///        per-rank tables because they were full.
+            virtual size_t num_drop(void) = 0;
     };
 
     /// @brief Retrieves sample data from a single application rank through
@@ -205,13 +212,23 @@ namespace geopm
             bool name_fill(std::set<std::string> &name_set) override;
             void report_name(std::string &report_str) override;
             void profile_name(std::string &prof_str) override;
+            size_t num_drop(void) override;
             std::shared_ptr<IProfileThreadTable> tprof_table(void);
         private:
+            enum {
+                /// Size of the region name arena for each rank.
+                /// Pages are only allocated as names are written.
+                M_NAME_ARENA_SIZE = 1048576,
+            };
             /// Holds the shared memory region used for sampling from the
             /// application process.
             std::unique_ptr<ISharedMemory> m_table_shmem;
             /// The hash table which stores application process samples.
             std::unique_ptr<IProfileTable> m_table;
+            /// Holds the shared memory region used for region names.
+            std::unique_ptr<ISharedMemory> m_name_shmem;
+            /// Region names interned by the application process.
+            std::unique_ptr<ProfileNameArena> m_name_arena;
             std::unique_ptr<ISharedMemory> m_tprof_shmem;
             std::shared_ptr<IProfileThreadTable> m_tprof_table;
             /// Holds the initial state of the last region entered.
@@ -280,6 +297,7 @@ namespace geopm
             std::string profile_name(void) override;
             std::shared_ptr<IProfileThreadTable> tprof_table(void) override;
             void controller_ready(void) override;
+            size_t num_drop(void) override;
         private:
             /// Holds the shared memory region used for application coordination
             /// and control.
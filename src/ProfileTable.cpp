@@ -40,7 +40,9 @@
 #include <string>
 
 #include "geopm_hash.h"
+#include "geopm_env.h"
 #include "Exception.hpp"
+#include "Helper.hpp"
 #include "ProfileTable.hpp"
 
 #include "config.h"
@@ -48,10 +50,42 @@
 
 namespace geopm
 {
+    std::unique_ptr<IProfileTable> IProfileTable::make_table(size_t size, void *buffer, bool is_producer)
+    {
+        std::unique_ptr<IProfileTable> result;
+        std::string table_type(geopm_env_profile_table());
+        if (table_type == "hash") {
+            result = geopm::make_unique<ProfileTable>(size, buffer);
+        }
+        else if (table_type == "ring") {
+            result = geopm::make_unique<ProfileRingTable>(size, buffer, is_producer);
+        }
+        else {
+            throw Exception("IProfileTable::make_table(): Unknown profile table type: " + table_type,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    size_t IProfileTable::make_table_size(size_t hash_size)
+    {
+        size_t result = hash_size;
+        if (std::string(geopm_env_profile_table()) == "ring") {
+            result = ProfileRingTable::buffer_size(ProfileRingTable::M_DEFAULT_RING_LENGTH);
+        }
+        return result;
+    }
+
     ProfileTable::ProfileTable(size_t size, void *buffer)
+        : ProfileTable(size, buffer, true)
+    {
+
+    }
+
+    ProfileTable::ProfileTable(size_t size, void *buffer, bool is_hash_table)
         : m_buffer_size(size)
-        , m_table_length(table_length(m_buffer_size))
-        , m_mask(m_table_length - GEOPM_NUM_REGION_ID_PRIVATE - 1)
+        , m_table_length(is_hash_table ? table_length(m_buffer_size) : 0)
+        , m_mask(is_hash_table ? m_table_length - GEOPM_NUM_REGION_ID_PRIVATE - 1 : 0)
         , m_table((struct table_entry_s *)buffer)
         , m_key_map_lock(PTHREAD_MUTEX_INITIALIZER)
         , m_is_pshared(true)
@@ -60,6 +94,9 @@ namespace geopm
         if (buffer == NULL) {
             throw Exception("ProfileTable: Buffer pointer is NULL", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        if (!is_hash_table) {
+            return;
+        }
         if (M_TABLE_DEPTH_MAX < 4) {
             throw Exception("ProfileTable: Table depth must be at least 4", GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
@@ -237,6 +274,9 @@ namespace geopm
             }
             m_key_set.insert(result);
             m_key_map.insert(std::pair<const std::string, uint64_t>(name, result));
+            if (m_name_arena && m_name_arena->insert(result, name)) {
+                m_arena_key_set.insert(result);
+            }
             m_key_map_last = m_key_map.begin();
             err = pthread_mutex_unlock(&(m_key_map_lock));
             if (err) {
@@ -297,13 +337,17 @@ namespace geopm
     bool ProfileTable::name_fill(size_t header_offset)
     {
         bool result = false;
-        size_t buffer_remain = m_buffer_size - header_offset - 1;
-        char *buffer_ptr = (char *)m_table + header_offset;
-        while (m_key_map_last != m_key_map.end() &&
-               buffer_remain > m_key_map_last->first.length()) {
-            strncpy(buffer_ptr, m_key_map_last->first.c_str(), buffer_remain);
-            buffer_remain -= m_key_map_last->first.length() + 1;
-            buffer_ptr += m_key_map_last->first.length() + 1;
+        size_t buffer_remain = m_buffer_size - name_offset() - header_offset - 1;
+        char *buffer_ptr = (char *)m_table + name_offset() + header_offset;
+        while (m_key_map_last != m_key_map.end()) {
+            if (m_arena_key_set.find(m_key_map_last->second) == m_arena_key_set.end()) {
+                if (buffer_remain <= m_key_map_last->first.length()) {
+                    break;
+                }
+                strncpy(buffer_ptr, m_key_map_last->first.c_str(), buffer_remain);
+                buffer_remain -= m_key_map_last->first.length() + 1;
+                buffer_ptr += m_key_map_last->first.length() + 1;
+            }
             ++m_key_map_last;
         }
         memset(buffer_ptr, 0, buffer_remain);
@@ -323,8 +367,8 @@ namespace geopm
     {
         char tmp_name[NAME_MAX];
         bool result = false;
-        size_t buffer_remain = m_buffer_size - header_offset - 1;
-        char *buffer_ptr = (char *)m_table + header_offset;
+        size_t buffer_remain = m_buffer_size - name_offset() - header_offset - 1;
+        char *buffer_ptr = (char *)m_table + name_offset() + header_offset;
 
         while (buffer_remain) {
             tmp_name[NAME_MAX - 1] = '\0';
@@ -355,4 +399,133 @@ namespace geopm
         }
         return result;
     }
+
+    size_t ProfileTable::name_offset(void) const
+    {
+        return 0;
+    }
+
+    size_t ProfileTable::num_drop(void) const
+    {
+        return 0;
+    }
+
+    void ProfileTable::name_arena(std::unique_ptr<ProfileNameArena> arena)
+    {
+        m_name_arena = std::move(arena);
+    }
+
+    ProfileRingTable::ProfileRingTable(size_t size, void *buffer)
+        : ProfileRingTable(size, buffer, true)
+    {
+
+    }
+
+    ProfileRingTable::ProfileRingTable(size_t size, void *buffer, bool is_producer)
+        : ProfileTable(size, buffer, false)
+        , m_header((struct ring_header_s *)buffer)
+        , m_ring((struct ring_entry_s *)((char *)buffer + sizeof(struct ring_header_s)))
+        , m_ring_length(ring_length(size))
+        , m_ring_mask(m_ring_length - 1)
+    {
+        // The consumer may attach after values have been inserted,
+        // so only the producer resets the indices and sequence
+        // numbers.
+        if (is_producer) {
+            memset((void *)m_header, 0, buffer_size(m_ring_length));
+        }
+    }
+
+    size_t ProfileRingTable::buffer_size(size_t num_entry)
+    {
+        return sizeof(struct ring_header_s) + num_entry * sizeof(struct ring_entry_s);
+    }
+
+    size_t ProfileRingTable::ring_length(size_t buffer_size) const
+    {
+        if (buffer_size < sizeof(struct ring_header_s) + sizeof(struct ring_entry_s)) {
+            throw Exception("ProfileRingTable: Buffer size too small",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t result = (buffer_size - sizeof(struct ring_header_s)) / sizeof(struct ring_entry_s);
+        // The largest power of two that fits in the buffer
+        size_t pow2 = 1;
+        while (pow2 <= result / 2) {
+            pow2 *= 2;
+        }
+        return pow2;
+    }
+
+    void ProfileRingTable::insert(uint64_t key, const struct geopm_prof_message_s &value)
+    {
+        if (key == 0) {
+            throw Exception("ProfileRingTable::insert(): zero is not a valid key", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Application threads may insert concurrently, e.g. from
+        // nested OpenMP regions, so each producer claims a position
+        // by advancing the head.  The acquire on the tail orders the
+        // entry write below after the consumer has finished reading
+        // the value previously stored in the entry.  The head read
+        // may be stale, so the fill level is compared as a signed
+        // value and a stale head fails the exchange and is retried.
+        uint64_t head = __atomic_load_n(&(m_header->head), __ATOMIC_RELAXED);
+        do {
+            uint64_t tail = __atomic_load_n(&(m_header->tail), __ATOMIC_ACQUIRE);
+            if ((int64_t)(head - tail) >= (int64_t)m_ring_length) {
+                __atomic_fetch_add(&(m_header->num_drop), 1, __ATOMIC_RELAXED);
+                return;
+            }
+        } while (!__atomic_compare_exchange_n(&(m_header->head), &head, head + 1, true,
+                                              __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+        struct ring_entry_s &entry = m_ring[head & m_ring_mask];
+        entry.key = key;
+        entry.value = value;
+        // Publish the entry to the consumer.
+        __atomic_store_n(&(entry.seq), head + 1, __ATOMIC_RELEASE);
+    }
+
+    size_t ProfileRingTable::capacity(void) const
+    {
+        return m_ring_length;
+    }
+
+    size_t ProfileRingTable::size(void) const
+    {
+        uint64_t tail = __atomic_load_n(&(m_header->tail), __ATOMIC_ACQUIRE);
+        uint64_t head = __atomic_load_n(&(m_header->head), __ATOMIC_ACQUIRE);
+        return head - tail;
+    }
+
+    void ProfileRingTable::dump(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content, size_t &length)
+    {
+        uint64_t tail = __atomic_load_n(&(m_header->tail), __ATOMIC_RELAXED);
+        uint64_t head = __atomic_load_n(&(m_header->head), __ATOMIC_ACQUIRE);
+        length = 0;
+        for (; tail != head; ++tail) {
+            const struct ring_entry_s &entry = m_ring[tail & m_ring_mask];
+            // Stop at the first entry that a producer has claimed
+            // but not yet published; it is read by the next dump().
+            if (__atomic_load_n(&(entry.seq), __ATOMIC_ACQUIRE) != tail + 1) {
+                break;
+            }
+            content->first = entry.key;
+            content->second = entry.value;
+            ++content;
+            ++length;
+        }
+        // Release the drained entries back to the producers.
+        __atomic_store_n(&(m_header->tail), tail, __ATOMIC_RELEASE);
+    }
+
+    size_t ProfileRingTable::name_offset(void) const
+    {
+        // Names are written after the ring indices so that the drop
+        // count and the ring remain valid after the names are passed.
+        return sizeof(struct ring_header_s);
+    }
+
+    size_t ProfileRingTable::num_drop(void) const
+    {
+        return __atomic_load_n(&(m_header->num_drop), __ATOMIC_RELAXED);
+    }
 }
@@ -36,8 +36,10 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <memory>
 
 #include "geopm_message.h"
+#include "ProfileNameArena.hpp"
 
 namespace geopm
 {
@@ -170,6 +172,67 @@ namespace geopm
             /// @param [out] name Set of names read from output of the
             ///        producer's call to name_fill().
             virtual bool name_set(size_t header_offset, std::set<std::string> &name) = 0;
+            /// @brief Offset in bytes from the beginning of the
+            ///        buffer to the region used for passing names.
+            ///
+            /// The header_offset given to name_fill() and name_set()
+            /// is relative to this offset, and callers that reserve
+            /// the beginning of the name region for other
+            /// information must write it at this offset.  The bytes
+            /// before it hold table state that is still read after
+            /// the names are passed.
+            ///
+            /// @return Offset in bytes of the name region.
+            virtual size_t name_offset(void) const = 0;
+            /// @brief Number of values discarded by insert() because
+            ///        the consumer had not drained the table.
+            ///
+            /// Tables that throw rather than discard values on
+            /// overflow always return zero.
+            ///
+            /// @return The number of values dropped since the table
+            ///         was created.
+            virtual size_t num_drop(void) const = 0;
+            /// @brief Attach an arena that new names are interned
+            ///        into when they are registered with key().
+            ///
+            /// Names that are published in the arena can be read by
+            /// the consumer at any time and are skipped by
+            /// name_fill().  Only names that do not fit in the arena
+            /// are passed through the table buffer.
+            ///
+            /// @param [in] arena Name arena shared with the consumer.
+            virtual void name_arena(std::unique_ptr<ProfileNameArena> arena) = 0;
+            /// @brief Factory method that creates a table of the type
+            ///        selected by the GEOPM_PROFILE_TABLE environment
+            ///        variable.
+            ///
+            /// The producer and consumer of a table must agree on the
+            /// type, so both sides construct their table through this
+            /// method.  A value of "hash" (the default) selects a
+            /// ProfileTable and "ring" selects a ProfileRingTable.
+            ///
+            /// @param size [in] The length of the buffer in bytes.
+            ///
+            /// @param buffer [in] Pointer to beginning of virtual
+            ///        address range used for storing the data.
+            ///
+            /// @param is_producer [in] True for the side that inserts
+            ///        values, false for the side that calls dump().
+            ///        Only the producer initializes the ring state of
+            ///        a ProfileRingTable.
+            static std::unique_ptr<IProfileTable> make_table(size_t size, void *buffer, bool is_producer);
+            /// @brief Size of the buffer to create for the table type
+            ///        selected by the GEOPM_PROFILE_TABLE environment
+            ///        variable.
+            ///
+            /// @param hash_size [in] The buffer size in bytes used
+            ///        for a hash table.
+            ///
+            /// @return The hash_size for a "hash" table, or the size
+            ///         required by a ProfileRingTable of the default
+            ///         length for a "ring" table.
+            static size_t make_table_size(size_t hash_size);
     };
 
     class ProfileTable : public IProfileTable
@@ -196,6 +259,25 @@ namespace geopm
             void dump(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content, size_t &length) override;
             bool name_fill(size_t header_offset) override;
             bool name_set(size_t header_offset, std::set<std::string> &name) override;
+            size_t name_offset(void) const override;
+            size_t num_drop(void) const override;
+            void name_arena(std::unique_ptr<ProfileNameArena> arena) override;
+        protected:
+            /// @brief Constructor used by derived classes that
+            ///        provide their own storage layout.
+            ///
+            /// Only the key registration and name passing state is
+            /// initialized; the hash table is not created in the
+            /// buffer.
+            ///
+            /// @param size [in] The length of the buffer in bytes.
+            ///
+            /// @param buffer [in] Pointer to beginning of virtual
+            ///        address range used for storing the data.
+            ///
+            /// @param is_hash_table [in] If false, the buffer is
+            ///        not formatted as a hash table.
+            ProfileTable(size_t size, void *buffer, bool is_hash_table);
         private:
             virtual bool sticky(const struct geopm_prof_message_s &value);
             enum {
@@ -218,6 +300,102 @@ namespace geopm
             std::set<uint64_t> m_key_set;
             bool m_is_pshared;
             std::map<const std::string, uint64_t>::iterator m_key_map_last;
+            std::unique_ptr<ProfileNameArena> m_name_arena;
+            /// @brief Keys whose names were published in the arena.
+            std::set<uint64_t> m_arena_key_set;
+    };
+
+    /// @brief Ring buffer variant of the ProfileTable.
+    ///
+    /// The ProfileRingTable formats the buffer as a ring of key value
+    /// pairs with a power of two number of entries.  Application
+    /// threads insert values and one controller thread drains them
+    /// with dump(), and neither side ever blocks on the other.
+    /// Producer threads claim an entry by atomically advancing the
+    /// head and publish it with a per entry sequence number, so
+    /// insert() never takes a lock.
+    /// Values are delivered in insertion order and are never
+    /// coalesced.  If the consumer falls behind and the ring fills,
+    /// new values are discarded and counted rather than raising a
+    /// GEOPM_ERROR_TOO_MANY_COLLISIONS exception; the count is
+    /// available from num_drop().  Key registration and name passing
+    /// are inherited from the ProfileTable.
+    class ProfileRingTable : public ProfileTable
+    {
+        public:
+            /// @brief Constructor for the producer side of the
+            ///        ProfileRingTable, which initializes the ring.
+            ///
+            /// @param size [in] The length of the buffer in bytes.
+            ///
+            /// @param buffer [in] Pointer to beginning of virtual
+            ///        address range used for storing the data.
+            ProfileRingTable(size_t size, void *buffer);
+            /// @brief Constructor for the ProfileRingTable.
+            ///
+            /// @param size [in] The length of the buffer in bytes.
+            ///
+            /// @param buffer [in] Pointer to beginning of virtual
+            ///        address range used for storing the data.
+            ///
+            /// @param is_producer [in] If true the ring is
+            ///        initialized, otherwise the table attaches to a
+            ///        ring without writing to the buffer.
+            ProfileRingTable(size_t size, void *buffer, bool is_producer);
+            /// ProfileRingTable destructor, virtual.
+            virtual ~ProfileRingTable() = default;
+            void insert(uint64_t key, const struct geopm_prof_message_s &value) override;
+            size_t capacity(void) const override;
+            size_t size(void) const override;
+            void dump(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content, size_t &length) override;
+            size_t name_offset(void) const override;
+            size_t num_drop(void) const override;
+            /// @brief Size of the buffer required for a ring with
+            ///        the given number of entries.
+            ///
+            /// @param num_entry [in] Number of ring entries, must be
+            ///        a power of two.
+            static size_t buffer_size(size_t num_entry);
+            enum {
+                /// @brief Number of entries in a ring created by
+                ///        IProfileTable::make_table_size().  At a
+                ///        5 ms control loop period this holds 800K
+                ///        messages per second.
+                M_DEFAULT_RING_LENGTH = 4096,
+            };
+        private:
+            enum {
+                M_CACHE_LINE_WORDS = 8,
+            };
+            /// @brief Ring indices, each on its own cache line so the
+            ///        producer and consumer do not share a line.
+            struct ring_header_s {
+                /// @brief Count of entries claimed, written only by
+                ///        producers.
+                uint64_t head;
+                uint64_t pad0[M_CACHE_LINE_WORDS - 1];
+                /// @brief Count of values consumed, written only by
+                ///        the consumer.
+                uint64_t tail;
+                uint64_t pad1[M_CACHE_LINE_WORDS - 1];
+                /// @brief Count of values dropped, written only by
+                ///        producers.
+                uint64_t num_drop;
+                uint64_t pad2[M_CACHE_LINE_WORDS - 1];
+            };
+            /// @brief structure to hold a single ring entry.
+            struct ring_entry_s {
+                /// @brief One more than the position of the value
+                ///        last published in the entry.
+                uint64_t seq;
+                uint64_t key;
+                struct geopm_prof_message_s value;
+            };
+            size_t ring_length(size_t buffer_size) const;
+            struct ring_header_s *m_header;
+            struct ring_entry_s *m_ring;
+            size_t m_ring_length;
+            uint64_t m_ring_mask;
     };
 }
 #endif
@@ -56,13 +56,13 @@ namespace geopm
         , m_entry_telemetry(m_num_domain, {GEOPM_REGION_ID_UNDEFINED, {{0, 0}}, {0}})
         , m_curr_sample({m_identifier, {0.0, 0.0, 0.0, 0.0}})
         , m_domain_sample(m_num_domain, m_curr_sample)
-        , m_domain_buffer(nullptr)
-        , m_time_buffer(nullptr)
+        , m_domain_buffer(m_num_signal * m_num_domain)
+        , m_time_buffer()
         , m_valid_entries(m_num_signal * m_num_domain, 0)
-        , m_min(m_num_signal * m_num_domain, DBL_MAX)
-        , m_max(m_num_signal * m_num_domain, -DBL_MAX)
-        , m_sum(m_num_signal * m_num_domain, 0.0)
-        , m_sum_squares(m_num_signal * m_num_domain, 0.0)
+        , m_stat_count(m_num_signal * m_num_domain, 0)
+        , m_stat_mean(m_num_signal * m_num_domain, 0.0)
+        , m_stat_m2(m_num_signal * m_num_domain, 0.0)
+        , m_stat_sorted(m_num_signal * m_num_domain * M_NUM_SAMPLE_HISTORY, 0.0)
         , m_derivative_last(m_num_signal * m_num_domain, NAN)
         , m_agg_stats({m_identifier, {0.0, 0.0, 0.0, 0.0}})
         , m_num_entry(0)
@@ -71,8 +71,7 @@ namespace geopm
         , m_mpi_time(0.0)
         , m_tprof_table(tprof_table)
     {
-        m_domain_buffer = geopm::make_unique<CircularBuffer<std::vector<double> > >(M_NUM_SAMPLE_HISTORY);
-        m_time_buffer = geopm::make_unique<CircularBuffer<struct geopm_time_s> >(M_NUM_SAMPLE_HISTORY);
+
     }
 
     Region::~Region() = default;
@@ -93,7 +92,7 @@ namespace geopm
             throw Exception("Region::insert(): telemetry not properly sized", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
-        m_time_buffer->insert(telemetry[0].timestamp);
+        m_time_buffer.insert(telemetry[0].timestamp);
         unsigned domain_idx = 0;
         for (auto it = telemetry.begin(); it != telemetry.end(); ++it, ++domain_idx) {
 #ifdef GEOPM_DEBUG
@@ -111,7 +110,7 @@ namespace geopm
             update_valid_entries(*it, domain_idx);
             update_stats(it->signal, domain_idx);
         }
-        m_domain_buffer->insert(m_signal_matrix);
+        m_domain_buffer.insert(m_signal_matrix.data());
         // If all ranks have exited the region update current sample
         for (domain_idx = 0;
              domain_idx != m_num_domain &&
@@ -142,8 +141,8 @@ namespace geopm
         std::copy(sample.begin(), sample.begin() + m_num_domain, m_domain_sample.begin());
         update_curr_sample();
         // Calculate the number of entries *after* we insert the new data: size() + 1 or capacity
-        int num_entries = m_domain_buffer->size() + 1 < m_domain_buffer->capacity() ?
-                          m_domain_buffer->size() + 1 : m_domain_buffer->capacity();
+        int num_entries = m_domain_buffer.size() + 1 < m_domain_buffer.capacity() ?
+                          m_domain_buffer.size() + 1 : m_domain_buffer.capacity();
         // This insert is called above leaf level, so all entries are valid
         std::fill(m_valid_entries.begin(), m_valid_entries.end(), num_entries);
 
@@ -152,18 +151,17 @@ namespace geopm
             update_signal_matrix(it->signal, domain_idx);
             update_stats(it->signal, domain_idx);
         }
-        m_domain_buffer->insert(m_signal_matrix);
+        m_domain_buffer.insert(m_signal_matrix.data());
     }
 
     void Region::clear(void)
     {
         m_derivative_num_fit = 0;
-        m_time_buffer->clear();
-        m_domain_buffer->clear();
-        std::fill(m_min.begin(), m_min.end(), DBL_MAX);
-        std::fill(m_max.begin(), m_max.end(), -DBL_MAX);
-        std::fill(m_sum.begin(), m_sum.end(), 0.0);
-        std::fill(m_sum_squares.begin(), m_sum_squares.end(), 0.0);
+        m_time_buffer.clear();
+        m_domain_buffer.clear();
+        std::fill(m_stat_count.begin(), m_stat_count.end(), 0);
+        std::fill(m_stat_mean.begin(), m_stat_mean.end(), 0.0);
+        std::fill(m_stat_m2.begin(), m_stat_m2.end(), 0.0);
         std::fill(m_valid_entries.begin(), m_valid_entries.end(), 0);
     }
 
@@ -194,7 +192,7 @@ namespace geopm
         if (!m_level &&
             (signal_type == GEOPM_TELEMETRY_TYPE_PROGRESS ||
              signal_type == GEOPM_TELEMETRY_TYPE_RUNTIME)) {
-            for (int i = 0; i < m_domain_buffer->size(); ++i) {
+            for (int i = 0; i < m_domain_buffer.size(); ++i) {
                 if (domain_buffer_value(i, domain_idx, GEOPM_TELEMETRY_TYPE_RUNTIME) != -1) {
                     result = domain_buffer_value(i, domain_idx, signal_type);
                 }
@@ -215,48 +213,43 @@ namespace geopm
     double Region::mean(int domain_idx, int signal_type) const
     {
         check_bounds(domain_idx, signal_type, __FILE__, __LINE__);
-        return  m_sum[domain_idx * m_num_signal + signal_type] /
-                num_sample(domain_idx, signal_type);
+        int stat_idx = domain_idx * m_num_signal + signal_type;
+        return m_stat_count[stat_idx] ? m_stat_mean[stat_idx] : NAN;
     }
 
     double Region::median(int domain_idx, int signal_type) const
     {
         check_bounds(domain_idx, signal_type, __FILE__, __LINE__);
-        std::vector<double> median_sort(num_sample(domain_idx, signal_type));
-        int idx = 0;
-        bool is_known_valid = true;
-        if (!m_level) {
-            is_known_valid = signal_type != GEOPM_TELEMETRY_TYPE_PROGRESS && signal_type != GEOPM_TELEMETRY_TYPE_RUNTIME;
-        }
-        for (int i = 0; i < m_domain_buffer->size(); ++i) {
-            if (is_known_valid ||
-                m_domain_buffer->value(i)[m_num_signal * domain_idx + GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0) {
-                median_sort[idx++] = m_domain_buffer->value(i)[m_num_signal * domain_idx + signal_type];
-            }
-        }
-        std::sort(median_sort.begin(), median_sort.begin() + num_sample(domain_idx, signal_type));
-        return median_sort[num_sample(domain_idx, signal_type) / 2];
+        int stat_idx = domain_idx * m_num_signal + signal_type;
+        int count = m_stat_count[stat_idx];
+        return count ? m_stat_sorted[stat_idx * M_NUM_SAMPLE_HISTORY + count / 2] : NAN;
     }
 
     double Region::std_deviation(int domain_idx, int signal_type) const
     {
         check_bounds(domain_idx, signal_type, __FILE__, __LINE__);
-        double ss = m_sum_squares[domain_idx * m_num_signal + signal_type];
-        double nn = num_sample(domain_idx, signal_type);
-        double mm = mean(domain_idx, signal_type);
-        return std::sqrt(ss / nn - mm * mm);
+        int stat_idx = domain_idx * m_num_signal + signal_type;
+        int count = m_stat_count[stat_idx];
+        // Removing samples from the window may leave a tiny negative
+        // residual in the sum of squared deviations.
+        double m2 = m_stat_m2[stat_idx] > 0.0 ? m_stat_m2[stat_idx] : 0.0;
+        return count ? std::sqrt(m2 / count) : NAN;
     }
 
     double Region::min(int domain_idx, int signal_type) const
     {
         check_bounds(domain_idx, signal_type, __FILE__, __LINE__);
-        return m_min[domain_idx * m_num_signal + signal_type];
+        int stat_idx = domain_idx * m_num_signal + signal_type;
+        return m_stat_count[stat_idx] ?
+               m_stat_sorted[stat_idx * M_NUM_SAMPLE_HISTORY] : DBL_MAX;
     }
 
     double Region::max(int domain_idx, int signal_type) const
     {
         check_bounds(domain_idx, signal_type, __FILE__, __LINE__);
-        return m_max[domain_idx * m_num_signal + signal_type];
+        int stat_idx = domain_idx * m_num_signal + signal_type;
+        int count = m_stat_count[stat_idx];
+        return count ? m_stat_sorted[stat_idx * M_NUM_SAMPLE_HISTORY + count - 1] : -DBL_MAX;
     }
 
     double Region::derivative(int domain_idx, int signal_type)
@@ -271,16 +264,16 @@ namespace geopm
         size_t sig_off = domain_idx * m_num_signal + signal_type;
         double result = m_derivative_last[sig_off];
         if (m_derivative_num_fit >= 2) {
-            size_t buf_size = m_time_buffer->size();
+            size_t buf_size = m_time_buffer.size();
             double A = 0.0, B = 0.0, C = 0.0, D = 0.0;
             double E = 1.0 / m_derivative_num_fit;
-            const struct geopm_time_s &time_0 = m_time_buffer->value(buf_size - m_derivative_num_fit);
-            const double sig_0 = m_domain_buffer->value(buf_size - m_derivative_num_fit)[sig_off];
+            const struct geopm_time_s &time_0 = m_time_buffer.value(buf_size - m_derivative_num_fit);
+            const double sig_0 = m_domain_buffer.value(buf_size - m_derivative_num_fit)[sig_off];
             for (size_t buf_off = buf_size - m_derivative_num_fit;
                  buf_off < buf_size; ++buf_off) {
-                const struct geopm_time_s &tt = m_time_buffer->value(buf_off);
+                const struct geopm_time_s &tt = m_time_buffer.value(buf_off);
                 double time = geopm_time_diff(&time_0, &tt);
-                double sig = m_domain_buffer->value(buf_off)[sig_off] - sig_0;
+                double sig = m_domain_buffer.value(buf_off)[sig_off] - sig_0;
                 A += time * sig;
                 B += time;
                 C += sig;
@@ -356,10 +349,10 @@ namespace geopm
 #endif
         // If buffer index is negative then wrap around
         if (buffer_idx < 0) {
-            buffer_idx += m_domain_buffer->size();
+            buffer_idx += m_domain_buffer.size();
         }
-        if (buffer_idx >= 0 && buffer_idx < m_domain_buffer->size()) {
-            result = m_domain_buffer->value(buffer_idx)[domain_idx * m_num_signal + signal_type];
+        if (buffer_idx >= 0 && buffer_idx < m_domain_buffer.size()) {
+            result = m_domain_buffer.value(buffer_idx)[domain_idx * m_num_signal + signal_type];
         }
         return result;
     }
@@ -369,10 +362,10 @@ namespace geopm
         struct geopm_time_s result{};
         // If buffer index is negative then wrap around
         if (buffer_idx < 0) {
-            buffer_idx += m_time_buffer->size();
+            buffer_idx += m_time_buffer.size();
         }
-        if (buffer_idx >= 0 && buffer_idx < m_time_buffer->size()) {
-            result = m_time_buffer->value(buffer_idx);
+        if (buffer_idx >= 0 && buffer_idx < m_time_buffer.size()) {
+            result = m_time_buffer.value(buffer_idx);
         }
         return result;
     }
@@ -433,16 +426,16 @@ namespace geopm
     {
         int offset = domain_idx * m_num_signal;
         // Calculate the number of entries *after* we insert the new data: size() + 1 or capacity
-        int num_entries = m_domain_buffer->size() + 1 < m_domain_buffer->capacity() ?
-                          m_domain_buffer->size() + 1 : m_domain_buffer->capacity();
+        int num_entries = m_domain_buffer.size() + 1 < m_domain_buffer.capacity() ?
+                          m_domain_buffer.size() + 1 : m_domain_buffer.capacity();
         // Fill in the number of valid entries for other signals which are always valid
         std::fill(m_valid_entries.begin() + offset, m_valid_entries.begin() + offset + GEOPM_TELEMETRY_TYPE_PROGRESS, num_entries);
 
         // Account for invalid progress or runtime being inserted or dropped off the end of the buffer
-        bool is_oldest_valid = m_domain_buffer->size() &&
-                               m_domain_buffer->value(0)[offset + GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
+        bool is_oldest_valid = m_domain_buffer.size() &&
+                               m_domain_buffer.value(0)[offset + GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
         bool is_signal_valid = telemetry.signal[GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
-        bool is_full = m_domain_buffer->size() == m_domain_buffer->capacity();
+        bool is_full = m_domain_buffer.size() == m_domain_buffer.capacity();
 
         if ((is_full && !is_oldest_valid && is_signal_valid) ||
             (!is_full && is_signal_valid)) {
@@ -458,60 +451,64 @@ namespace geopm
     void Region::update_stats(const double *signal, int domain_idx)
     {
         int offset = domain_idx * m_num_signal;
-        bool is_full = m_domain_buffer->size() == m_domain_buffer->capacity();
+        bool is_full = m_domain_buffer.size() == m_domain_buffer.capacity();
+        bool is_signal_valid = signal[GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
+        // The oldest sample drops out of the window when the buffer is full
+        const double *oldest = is_full ? m_domain_buffer.value(0) + offset : nullptr;
+        bool is_oldest_valid = oldest && oldest[GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
         for (int i = 0; i < m_num_signal; ++i) {
-            bool is_signal_valid = m_level ? true : signal[GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
-
-            // CALCULATE THE MIN
-            if (is_signal_valid && signal[i] < m_min[offset + i]) {
-                m_min[offset + i] = signal[i];
+            // At the leaf level only progress and runtime are invalid
+            // when the runtime is -1, matching update_valid_entries().
+            bool is_known_valid = m_level ||
+                                  (i != GEOPM_TELEMETRY_TYPE_PROGRESS &&
+                                   i != GEOPM_TELEMETRY_TYPE_RUNTIME);
+            if (oldest && (is_known_valid || is_oldest_valid)) {
+                stat_remove(offset + i, oldest[i]);
             }
-            else if (is_full && m_min[offset + i] == m_domain_buffer->value(0)[offset + i]) {
-                // We are about to throw out the current min
-                // Find the new one
-                m_min[offset + i] = is_signal_valid ? signal[i] : DBL_MAX;
-                for (int entry = 1; entry < m_domain_buffer->size(); ++entry) {
-                    bool is_old_value_valid = m_level ? true : m_domain_buffer->value(entry)[offset + GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
-                    if (is_old_value_valid &&
-                        m_domain_buffer->value(entry)[offset + i] < m_min[offset + i]) {
-                        m_min[offset + i] = m_domain_buffer->value(entry)[offset + i];
-                    }
-                }
-            }
-
-            // CALCULATE THE MAX
-            if (is_signal_valid && signal[i] > m_max[offset + i]) {
-                m_max[offset + i] = signal[i];
-            }
-            else if (is_full && m_max[offset + i] == m_domain_buffer->value(0)[offset + i]) {
-                // We are about to throw out the current max
-                // Find the new one
-                m_max[offset + i] = is_signal_valid ? signal[i] : -DBL_MAX;
-                for (int entry = 1; entry < m_domain_buffer->size(); ++entry) {
-                    bool is_old_value_valid = m_level ? true : m_domain_buffer->value(entry)[offset + GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0;
-                    if (is_old_value_valid &&
-                        m_domain_buffer->value(entry)[offset + i] > m_max[offset + i]) {
-                        m_max[offset +i] = m_domain_buffer->value(entry)[offset + i];
-                    }
-                }
+            if (is_known_valid || is_signal_valid) {
+                stat_insert(offset + i, signal[i]);
             }
+        }
+    }
 
-            // CALCULATE SUM AND SUM OF SQUARES
-            bool is_oldest_valid = m_level || (m_domain_buffer->size() &&
-                                               m_domain_buffer->value(0)[offset + GEOPM_TELEMETRY_TYPE_RUNTIME] != -1.0);
+    void Region::stat_insert(int stat_idx, double value)
+    {
+        int count = m_stat_count[stat_idx];
+        double *sorted = m_stat_sorted.data() + stat_idx * M_NUM_SAMPLE_HISTORY;
+        double *pos = std::upper_bound(sorted, sorted + count, value);
+        std::copy_backward(pos, sorted + count, sorted + count + 1);
+        *pos = value;
+        ++count;
+        // Welford update of the mean and sum of squared deviations
+        double delta = value - m_stat_mean[stat_idx];
+        m_stat_mean[stat_idx] += delta / count;
+        m_stat_m2[stat_idx] += delta * (value - m_stat_mean[stat_idx]);
+        m_stat_count[stat_idx] = count;
+    }
 
-            if (is_signal_valid) {
-                // sum the values
-                m_sum[offset + i] += signal[i];
-                // sum the square of the values
-                m_sum_squares[offset + i] += signal[i] * signal[i];
-            }
-            if (is_full && is_oldest_valid) {
-                // We need to subtract the value of the signal we are removing
-                m_sum[offset + i] -= m_domain_buffer->value(0)[offset + i];
-                m_sum_squares[offset + i] -= m_domain_buffer->value(0)[offset + i] * m_domain_buffer->value(0)[offset + i];
-            }
+    void Region::stat_remove(int stat_idx, double value)
+    {
+        int count = m_stat_count[stat_idx];
+        double *sorted = m_stat_sorted.data() + stat_idx * M_NUM_SAMPLE_HISTORY;
+        double *pos = std::find_if(sorted, sorted + count, [value](double sorted_value) {
+            return sorted_value == value || (std::isnan(sorted_value) && std::isnan(value));
+        });
+        if (pos == sorted + count) {
+            return;
+        }
+        std::copy(pos + 1, sorted + count, pos);
+        --count;
+        if (count) {
+            // Reverse Welford update
+            double delta = value - m_stat_mean[stat_idx];
+            m_stat_mean[stat_idx] -= delta / count;
+            m_stat_m2[stat_idx] -= delta * (value - m_stat_mean[stat_idx]);
+        }
+        else {
+            m_stat_mean[stat_idx] = 0.0;
+            m_stat_m2[stat_idx] = 0.0;
         }
+        m_stat_count[stat_idx] = count;
     }
 
     void Region::update_curr_sample(void)
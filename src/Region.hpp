@@ -40,12 +40,11 @@
 #include <memory>
 
 #include "geopm_message.h"
+#include "CircularBuffer.hpp"
 
 namespace geopm
 {
     class IProfileThreadTable;
-    template <class type>
-    class ICircularBuffer;
 
     /// @brief This class encapsulates all recorded data for a
     ///        specific application execution region.
@@ -296,6 +295,8 @@ namespace geopm
             void update_signal_matrix(const double *signal, int domain_idx);
             void update_valid_entries(const struct geopm_telemetry_message_s &telemetry, int domain_idx);
             void update_stats(const double *signal, int domain_idx);
+            void stat_insert(int stat_idx, double value);
+            void stat_remove(int stat_idx, double value);
             void update_curr_sample(void);
             /// @brief Holds a unique 64 bit region identifier.
             const uint64_t m_identifier;
@@ -313,20 +314,24 @@ namespace geopm
             struct geopm_sample_message_s m_curr_sample;
             /// @brief Holder for sample data calculated after a domain exits a region.
             std::vector<struct geopm_sample_message_s> m_domain_sample;
-            /// @brief Circular buffer is over time, vector is indexed over both domains and signals.
-            std::unique_ptr<ICircularBuffer<std::vector<double> > > m_domain_buffer;
+            /// @brief Circular buffer is over time, each row is indexed over both domains and signals.
+            FixedCircularBuffer2D<double, M_NUM_SAMPLE_HISTORY> m_domain_buffer;
             /// @brief time stamp for each entry in the m_domain_buffer.
-            std::unique_ptr<ICircularBuffer<struct geopm_time_s> > m_time_buffer;
+            FixedCircularBuffer<struct geopm_time_s, M_NUM_SAMPLE_HISTORY> m_time_buffer;
             /// @brief the number of valid samples per domain and signal type.
             std::vector<int> m_valid_entries;
-            /// @brief the current minimum signal value per domain and signal type.
-            std::vector<double> m_min;
-            /// @brief the current maximum signal value per domain and signal type.
-            std::vector<double> m_max;
-            /// @brief the current sum of signal values per domain and signal type.
-            std::vector<double> m_sum;
-            /// @brief the current sum of squares of signal values per domain and signal type.
-            std::vector<double> m_sum_squares;
+            /// @brief the number of samples contributing to the
+            ///        streaming statistics per domain and signal type.
+            std::vector<int> m_stat_count;
+            /// @brief the running (Welford) mean per domain and signal type.
+            std::vector<double> m_stat_mean;
+            /// @brief the running (Welford) sum of squared deviations
+            ///        from the mean per domain and signal type.
+            std::vector<double> m_stat_m2;
+            /// @brief the samples in the history window kept in
+            ///        sorted order, M_NUM_SAMPLE_HISTORY contiguous
+            ///        values per domain and signal type.
+            std::vector<double> m_stat_sorted;
             std::vector<double> m_derivative_last;
             struct geopm_sample_message_s m_agg_stats;
             uint64_t m_num_entry;
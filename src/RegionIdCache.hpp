@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef REGIONIDCACHE_HPP_INCLUDE
+#define REGIONIDCACHE_HPP_INCLUDE
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <vector>
+
+#include "geopm_message.h"
+
+namespace geopm
+{
+    /// @brief Lock-free open addressing cache that maps a key, e.g.
+    ///        a function address or a region name hash, to a
+    ///        region ID.
+    ///
+    /// Lookups are safe from any thread without locking.  A key of
+    /// zero marks an empty slot and a region ID of zero marks a slot
+    /// that has been claimed but has no published region ID.
+    class RegionIdCache
+    {
+        public:
+            /// @brief Constructor for RegionIdCache.
+            ///
+            /// @param [in] num_slot Number of slots in the cache,
+            ///        must be a power of two.
+            ///
+            /// @param [in] num_probe Number of slots searched before
+            ///        a key is resolved without caching.
+            RegionIdCache(size_t num_slot, int num_probe);
+            virtual ~RegionIdCache() = default;
+            /// @brief Region ID for a key.
+            ///
+            /// The first caller for a key claims a slot and calls
+            /// resolve(slot_idx).  The result is published for later
+            /// callers unless it is zero or GEOPM_REGION_ID_UNDEFINED.
+            /// If the resolution fails or throws, the slot is
+            /// released, so the next lookup claims a slot and
+            /// retries it.  Callers that find the key while the
+            /// registration is in progress, or that find no free
+            /// slot, call resolve(-1) and the result is not cached.
+            ///
+            /// @param [in] key Non-zero key; a key of zero is never
+            ///        cached.
+            ///
+            /// @param [in] resolve Callable taking the claimed slot
+            ///        index, or -1, and returning the region ID.
+            ///
+            /// @param [in] is_match Callable taking a slot index
+            ///        that holds key and returning false to reject a
+            ///        collision, e.g. two names with the same hash.
+            ///
+            /// @return The region ID for key.
+            template <typename resolve_type, typename match_type>
+            uint64_t region_id(uint64_t key, resolve_type resolve, match_type is_match);
+        private:
+            struct m_slot_s {
+                uint64_t key;
+                uint64_t region_id;
+            };
+            std::vector<struct m_slot_s> m_slot;
+            const int m_num_probe;
+    };
+
+    inline RegionIdCache::RegionIdCache(size_t num_slot, int num_probe)
+        : m_slot(num_slot)
+        , m_num_probe(num_probe)
+    {
+
+    }
+
+    template <typename resolve_type, typename match_type>
+    uint64_t RegionIdCache::region_id(uint64_t key, resolve_type resolve, match_type is_match)
+    {
+        uint64_t result = 0;
+        bool is_resolved = false;
+        bool is_cached = false;
+        size_t mask = m_slot.size() - 1;
+        // Multiplicative hash so that aligned addresses spread
+        // across the slots.
+        size_t slot_idx = ((key * 0x9e3779b97f4a7c15ULL) >> 32) & mask;
+        bool is_done = !key || m_slot.empty();
+        for (int probe = 0; !is_done && probe < m_num_probe; ++probe) {
+            struct m_slot_s &slot = m_slot[slot_idx];
+            uint64_t curr_key = __atomic_load_n(&(slot.key), __ATOMIC_ACQUIRE);
+            if (curr_key == 0) {
+                // Try to claim the empty slot.  If another thread
+                // wins the race, curr_key is updated to its key.
+                if (__atomic_compare_exchange_n(&(slot.key), &curr_key, key,
+                                                false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                    try {
+                        result = resolve((int)slot_idx);
+                    }
+                    catch (...) {
+                        __atomic_store_n(&(slot.key), 0, __ATOMIC_RELEASE);
+                        throw;
+                    }
+                    is_resolved = true;
+                    if (result && result != GEOPM_REGION_ID_UNDEFINED) {
+                        __atomic_store_n(&(slot.region_id), result, __ATOMIC_RELEASE);
+                        is_cached = true;
+                    }
+                    else {
+                        // Release the slot so that the next lookup
+                        // claims it and retries the resolution.
+                        __atomic_store_n(&(slot.key), 0, __ATOMIC_RELEASE);
+                    }
+                    is_done = true;
+                }
+            }
+            if (!is_done && curr_key == key) {
+                uint64_t region_id = __atomic_load_n(&(slot.region_id), __ATOMIC_ACQUIRE);
+                if (!region_id) {
+                    // Registration by another thread is in progress.
+                    is_done = true;
+                }
+                else if (is_match((int)slot_idx)) {
+                    result = region_id;
+                    is_cached = true;
+                    is_done = true;
+                }
+            }
+            slot_idx = (slot_idx + 1) & mask;
+        }
+        if (!is_cached && !is_resolved) {
+            result = resolve(-1);
+        }
+        return result;
+    }
+}
+
+#endif
@@ -33,6 +33,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <fcntl.h>
+#include <time.h>
 
 #include <sstream>
 #include <fstream>
@@ -49,6 +50,7 @@
 #include "TreeComm.hpp"
 #include "Exception.hpp"
 #include "geopm_hash.h"
+#include "geopm_env.h"
 #include "geopm_version.h"
 #include "config.h"
 
@@ -59,9 +61,17 @@
 namespace geopm
 {
     Reporter::Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank)
+        : Reporter(report_name, platform_io, rank, geopm_env_do_report_parallel())
+    {
+
+    }
+
+    Reporter::Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank,
+                       bool do_parallel_write)
         : m_report_name(report_name)
         , m_platform_io(platform_io)
         , m_rank(rank)
+        , m_do_parallel_write(do_parallel_write)
     {
 
     }
@@ -98,23 +108,21 @@ namespace geopm
                             std::shared_ptr<IComm> comm,
                             const ITreeComm &tree_comm)
     {
-        std::ofstream master_report(application_io.report_name());
-        if (!master_report.good()) {
-            throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
+        std::string report_name = application_io.report_name();
         int rank = comm->rank();
         // make header
+        std::ostringstream header;
         if (!rank) {
-            master_report << "##### geopm " << geopm_version() << " #####" << std::endl;
-            master_report << "Profile: " << application_io.profile_name() << std::endl;
-            master_report << "Agent: " << agent_name << std::endl;
+            header << "##### geopm " << geopm_version() << " #####" << std::endl;
+            header << "Profile: " << application_io.profile_name() << std::endl;
+            header << "Agent: " << agent_name << std::endl;
             for (const auto &kv : agent_report_header) {
-                master_report << kv.first << ": " << kv.second << std::endl;
+                header << kv.first << ": " << kv.second << std::endl;
             }
-            master_report << "Policy Mode: deprecated" << std::endl;
-            master_report << "Tree Decider: deprecated" << std::endl;
-            master_report << "Leaf Decider: deprecated" << std::endl;
-            master_report << "Power Budget: -1" << std::endl;
+            header << "Policy Mode: deprecated" << std::endl;
+            header << "Tree Decider: deprecated" << std::endl;
+            header << "Leaf Decider: deprecated" << std::endl;
+            header << "Power Budget: -1" << std::endl;
         }
         // per-node report
         std::ostringstream report;
@@ -215,19 +223,40 @@ namespace geopm
         std::string max_memory = get_max_memory();
         report << "    geopmctl memory HWM: " << max_memory << std::endl;
         report << "    geopmctl network BW (B/sec): " << tree_comm.overhead_send() / total_runtime << std::endl;
+        report << "    geopmctl CPU utilization (%): " << 100.0 * get_cpu_time() / total_runtime << std::endl;
+        report << "    geopmctl profile messages dropped: " << application_io.total_profile_drop() << std::endl;
 
+        if (m_do_parallel_write) {
+            write_parallel(header.str(), report.str(), report_name, rank, *comm);
+        }
+        else {
+            write_gather(header.str(), report.str(), report_name, rank, *comm);
+        }
+    }
+
+    void Reporter::write_gather(const std::string &header, const std::string &node_report,
+                                const std::string &report_name, int rank, IComm &comm)
+    {
+        // Only the root opens the report: write_parallel() falls back
+        // to this path when other nodes can not open the file.
+        std::ofstream master_report;
+        if (!rank) {
+            master_report.open(report_name);
+            if (!master_report.good()) {
+                throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            master_report << header;
+        }
         // aggregate reports from every node
-        report.seekp(0, std::ios::end);
-        size_t buffer_size = (size_t) report.tellp();
-        report.seekp(0, std::ios::beg);
+        size_t buffer_size = node_report.size();
         std::vector<char> report_buffer;
         std::vector<size_t> buffer_size_array;
         std::vector<off_t> buffer_displacement;
-        int num_ranks = comm->num_rank();
+        int num_ranks = comm.num_rank();
         buffer_size_array.resize(num_ranks);
         buffer_displacement.resize(num_ranks);
-        comm->gather(&buffer_size, sizeof(size_t), buffer_size_array.data(),
-                     sizeof(size_t), 0);
+        comm.gather(&buffer_size, sizeof(size_t), buffer_size_array.data(),
+                    sizeof(size_t), 0);
 
         if (!rank) {
             int full_report_size = std::accumulate(buffer_size_array.begin(), buffer_size_array.end(), 0) + 1;
@@ -238,8 +267,8 @@ namespace geopm
             }
         }
 
-        comm->gatherv((void *) (report.str().data()), sizeof(char) * buffer_size,
-                             (void *) report_buffer.data(), buffer_size_array, buffer_displacement, 0);
+        comm.gatherv((void *) (node_report.data()), sizeof(char) * buffer_size,
+                     (void *) report_buffer.data(), buffer_size_array, buffer_displacement, 0);
 
         if (!rank) {
             report_buffer.back() = '\0';
@@ -249,6 +278,104 @@ namespace geopm
         }
     }
 
+    void Reporter::write_parallel(const std::string &header, const std::string &node_report,
+                                  const std::string &report_name, int rank, IComm &comm)
+    {
+        int num_ranks = comm.num_rank();
+        size_t buffer_size = node_report.size();
+        std::vector<size_t> buffer_size_array(num_ranks);
+        // Offset of each node section in the file, only the sizes of
+        // the sections are sent to the root rather than their text.
+        std::vector<off_t> file_offset(num_ranks);
+        comm.gather(&buffer_size, sizeof(size_t), buffer_size_array.data(),
+                    sizeof(size_t), 0);
+        int err = 0;
+        if (!rank) {
+            file_offset[0] = header.size();
+            for (int i = 1; i < num_ranks; ++i) {
+                file_offset[i] = file_offset[i - 1] + buffer_size_array[i - 1];
+            }
+            off_t end_offset = file_offset[num_ranks - 1] + buffer_size_array[num_ranks - 1];
+            // Create the file with the header and the trailing
+            // newline before any node section is written.
+            std::ofstream master_report(report_name);
+            if (master_report.good()) {
+                master_report << header;
+                master_report.seekp(end_offset);
+                master_report << std::endl;
+                master_report.close();
+            }
+            if (!master_report.good()) {
+                err = GEOPM_ERROR_INVALID;
+            }
+        }
+        // The root completes the header before the broadcast, so all
+        // nodes write into an existing file.
+        comm.broadcast(&err, sizeof(err), 0);
+        if (err) {
+            throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        comm.broadcast(file_offset.data(), sizeof(off_t) * num_ranks, 0);
+
+        // Every node must be able to open the file, e.g. it is not
+        // on a shared file system, or the root writes the whole
+        // report from the gathered text instead.
+        int fd = open(report_name.c_str(), O_WRONLY);
+        if (!comm.test(fd != -1)) {
+            if (fd != -1) {
+                (void)close(fd);
+            }
+            write_gather(header, node_report, report_name, rank, comm);
+            return;
+        }
+        const char *buffer = node_report.data();
+        size_t num_written = 0;
+        while (!err && num_written < buffer_size) {
+            ssize_t num_write = pwrite(fd, buffer + num_written, buffer_size - num_written,
+                                       file_offset[rank] + num_written);
+            if (num_write == -1) {
+                err = errno ? errno : GEOPM_ERROR_RUNTIME;
+            }
+            else {
+                num_written += num_write;
+            }
+        }
+        if (fd != -1 && close(fd) && !err) {
+            err = errno ? errno : GEOPM_ERROR_RUNTIME;
+        }
+        // Agree on success before anyone throws so that no node is
+        // left waiting in a collective.  The report is complete when
+        // generate() returns on every node.
+        bool is_all_written = comm.test(!err);
+        if (err) {
+            throw Exception("Reporter::generate(): Unable to write report section to " + report_name,
+                            err, __FILE__, __LINE__);
+        }
+        if (!is_all_written) {
+            throw Exception("Reporter::generate(): Another node was unable to write its report section to " + report_name,
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    double Reporter::get_cpu_time(void)
+    {
+        // A controller with its own process (geopmctl or
+        // GEOPM_PMPI_CTL=process) is measured with the process CPU
+        // clock, which includes helper threads such as the AsyncMSRIO
+        // batch reader.  A controller running as a thread of an
+        // application rank can only measure the thread that calls
+        // generate(), since the process clock includes the
+        // application.
+        clockid_t clock_id = geopm_env_pmpi_ctl() == GEOPM_PMPI_CTL_PTHREAD ?
+                             CLOCK_THREAD_CPUTIME_ID : CLOCK_PROCESS_CPUTIME_ID;
+        struct timespec cpu_time;
+        if (clock_gettime(clock_id, &cpu_time)) {
+            throw Exception("Reporter::generate(): Unable to read controller CPU time",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        return cpu_time.tv_sec + cpu_time.tv_nsec * 1E-9;
+    }
+
     std::string Reporter::get_max_memory()
     {
         char status_buffer[8192];
@@ -99,6 +99,14 @@ namespace geopm
     {
         public:
             Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank);
+            /// @param [in] do_parallel_write If true, the root
+            ///        controller writes only the report header and
+            ///        each node writes its own section at its offset
+            ///        in the shared report file.  Otherwise the node
+            ///        sections are gathered to the root controller
+            ///        which writes the whole file.
+            Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank,
+                     bool do_parallel_write);
             virtual ~Reporter() = default;
             void init(void) override;
             void generate(const std::string &agent_name,
@@ -110,10 +118,28 @@ namespace geopm
                           const ITreeComm &tree_comm) override;
         private:
             std::string get_max_memory(void);
+            /// @brief CPU time in seconds consumed by the
+            ///        controller: every thread of the process when
+            ///        the controller runs as its own process, only
+            ///        the calling thread when it runs as a thread of
+            ///        an application rank.
+            double get_cpu_time(void);
+            /// @brief Gather the node report text to the root
+            ///        controller and append it to the report file.
+            void write_gather(const std::string &header, const std::string &node_report,
+                              const std::string &report_name, int rank, IComm &comm);
+            /// @brief Write the header from the root controller and
+            ///        the node report text from each controller into
+            ///        disjoint ranges of the shared report file.
+            ///        Falls back to write_gather() if any controller
+            ///        can not open the file.
+            void write_parallel(const std::string &header, const std::string &node_report,
+                                const std::string &report_name, int rank, IComm &comm);
 
             std::string m_report_name;
             IPlatformIO &m_platform_io;
             int m_rank;
+            bool m_do_parallel_write;
             int m_energy_pkg_idx;
             int m_energy_dram_idx;
             int m_clk_core_idx;
@@ -36,7 +36,11 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <errno.h>
 #include <string.h>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -48,6 +52,8 @@
 
 namespace geopm
 {
+    const char *SharedMemoryUser::M_SHM_DIR = "/dev/shm";
+
     SharedMemory::SharedMemory(const std::string &shm_key, size_t size)
         : m_shm_key(shm_key)
         , m_size(size)
@@ -151,27 +157,64 @@ namespace geopm
         else {
             struct geopm_time_s begin_time;
             struct geopm_time_s curr_time;
-
             geopm_time(&begin_time);
             curr_time = begin_time;
-            while (shm_id < 0 && geopm_time_diff(&begin_time, &curr_time) < (double)timeout) {
+
+            // Rather than spinning on shm_open() and fstat() until the
+            // creator has linked and sized the region, sleep on an
+            // inotify descriptor watching the shared memory file
+            // system.  Both the creation and the ftruncate() of the
+            // region generate an event that wakes every waiting
+            // process.  The watch is registered before the first
+            // check so no event can be missed between the check and
+            // the poll().
+            int notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (notify_fd >= 0 &&
+                inotify_add_watch(notify_fd, M_SHM_DIR, IN_CREATE | IN_MOVED_TO | IN_MODIFY | IN_ATTRIB) < 0) {
+                (void) close(notify_fd);
+                notify_fd = -1;
+            }
+            // If inotify is not available poll() with a negative
+            // descriptor degrades into a short sleep.
+            int poll_msec = notify_fd >= 0 ? M_NOTIFY_POLL_MSEC : M_FALLBACK_POLL_MSEC;
+            int open_errno = 0;
+            double elapsed = 0.0;
+            while (!m_size && elapsed < (double)timeout) {
                 geopm_signal_handler_check();
-                shm_id = shm_open(shm_key.c_str(), O_RDWR, 0);
+                if (shm_id < 0) {
+                    shm_id = shm_open(shm_key.c_str(), O_RDWR, 0);
+                    open_errno = errno;
+                    if (shm_id < 0 && open_errno != ENOENT) {
+                        break;
+                    }
+                }
+                if (shm_id >= 0) {
+                    err = fstat(shm_id, &stat_struct);
+                    if (!err) {
+                        m_size = stat_struct.st_size;
+                    }
+                }
+                if (!m_size) {
+                    int wait_msec = std::min((double)poll_msec, 1000.0 * ((double)timeout - elapsed));
+                    struct pollfd notify_poll = {notify_fd, POLLIN, 0};
+                    if (poll(&notify_poll, 1, wait_msec > 0 ? wait_msec : 0) > 0) {
+                        // Drain the queue; any event is a hint to re-check.
+                        char event_buffer[4096];
+                        while (read(notify_fd, event_buffer, sizeof(event_buffer)) > 0) {
+
+                        }
+                    }
+                }
                 geopm_time(&curr_time);
+                elapsed = geopm_time_diff(&begin_time, &curr_time);
+            }
+            if (notify_fd >= 0) {
+                (void) close(notify_fd);
             }
             if (shm_id < 0) {
                 std::ostringstream ex_str;
                 ex_str << "SharedMemoryUser: Could not open shared memory with key \"" << shm_key << "\"";
-                throw Exception(ex_str.str(), errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
-
-            while (!m_size && geopm_time_diff(&begin_time, &curr_time) < (double)timeout) {
-                geopm_signal_handler_check();
-                err = fstat(shm_id, &stat_struct);
-                if (!err) {
-                    m_size = stat_struct.st_size;
-                }
-                geopm_time(&curr_time);
+                throw Exception(ex_str.str(), open_errno ? open_errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
             }
             if (!m_size) {
                 (void) close(shm_id);
@@ -98,8 +98,10 @@ namespace geopm
         public:
             /// Constructor takes a key and attempts to attach to a
             /// inter-process shared memory region. This version of the
-            /// constructor tries to attach multiple times until a timeout
-            /// is reached.
+            /// constructor waits until the region has been created and
+            /// sized or until a timeout is reached.  The wait sleeps on
+            /// inotify events for the shared memory file system rather
+            /// than polling.
             /// @param [in] shm_key Shared memory key to attach to the region.
             /// @param [in] timeout Length in seconds to keep retrying the
             ///             attachment process to a shared memory region.
@@ -116,6 +118,15 @@ namespace geopm
             size_t size(void) override;
             void unlink(void) override;
         private:
+            /// Directory where POSIX shared memory keys are linked.
+            static const char *M_SHM_DIR;
+            enum {
+                /// Upper bound on each sleep while waiting on inotify
+                /// in case an event is not delivered.
+                M_NOTIFY_POLL_MSEC = 100,
+                /// Sleep between attempts if inotify is unavailable.
+                M_FALLBACK_POLL_MSEC = 1,
+            };
             /// Shared memory key for the region.
             std::string m_shm_key;
             /// Size of the region.
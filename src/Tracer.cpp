@@ -41,6 +41,7 @@
 
 #include <unistd.h>
 #include <limits.h>
+#include <endian.h>
 #include <string.h>
 #include <cctype>
 #include <iomanip>
@@ -71,6 +72,9 @@ namespace geopm
         , m_time_zero({{0, 0}})
         , m_policy({0, 0, 0, 0.0})
         , m_platform_io(platform_io())
+        , m_column_group(-1)
+        , m_is_binary(false)
+        , m_block_num_row(0)
     {
         geopm_time(&m_time_zero);
         if (geopm_env_do_trace()) {
@@ -106,7 +110,7 @@ namespace geopm
 
     Tracer::Tracer()
         : Tracer(geopm_env_trace(), hostname(), geopm_env_do_trace(), platform_io(),
-                 {}, 16)
+                 {}, 16, geopm_env_trace_format())
     {
 
     }
@@ -116,7 +120,8 @@ namespace geopm
                    bool do_trace,
                    IPlatformIO &platform_io,
                    const std::vector<std::string> &env_column,
-                   int precision)
+                   int precision,
+                   const std::string &format)
         : m_file_path(file_path)
         , m_hostname(hostname)
         , m_is_trace_enabled(do_trace)
@@ -127,7 +132,14 @@ namespace geopm
         , m_platform_io(platform_io)
         , m_env_column(env_column)
         , m_precision(precision)
+        , m_column_group(-1)
+        , m_is_binary(format == "binary")
+        , m_block_num_row(0)
     {
+        if (!m_is_binary && format != "text") {
+            throw Exception("Tracer::Tracer(): unknown trace format \"" + format + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         if (m_env_column.empty()) {
             auto num_extra_cols = geopm_env_num_trace_signal();
             for (int i = 0; i < num_extra_cols; ++i) {
@@ -138,7 +150,9 @@ namespace geopm
         if (m_is_trace_enabled) {
             std::ostringstream output_path;
             output_path << m_file_path << "-" << m_hostname;
-            m_stream.open(output_path.str());
+            m_stream.open(output_path.str(), m_is_binary ?
+                          std::ios_base::out | std::ios_base::binary :
+                          std::ios_base::out);
             if (!m_stream.good()) {
                 std::cerr << "Warning: unable to open trace file '" << output_path.str()
                           << "': " << strerror(errno) << std::endl;
@@ -158,6 +172,9 @@ namespace geopm
     Tracer::~Tracer()
     {
         if (m_stream.good() && m_is_trace_enabled) {
+            if (m_is_binary) {
+                write_block();
+            }
             m_stream << m_buffer.str();
             m_stream.close();
         }
@@ -239,27 +256,43 @@ namespace geopm
             }
 
             // set up columns to be sampled by Tracer
+            std::vector<std::string> column_name;
             for (const auto &col : base_columns) {
                 m_column_idx.push_back(m_platform_io.push_signal(col.name,
                                                                  col.domain_type,
                                                                  col.domain_idx));
+                column_name.push_back(pretty_name(col));
                 if (col.name.find("#") != std::string::npos) {
-                    m_hex_column.insert(m_column_idx.back());
-                }
-                if (first) {
-                    m_buffer << pretty_name(col);
-                    first = false;
+                    m_column_type.push_back(M_COLUMN_TYPE_UINT64);
                 }
                 else {
-                    m_buffer << "|" << pretty_name(col);
+                    m_column_type.push_back(M_COLUMN_TYPE_DOUBLE);
                 }
             }
 
+            m_column_group = m_platform_io.push_signal_group(m_column_idx);
+
             // columns from agent; will be sampled by agent
             for (const auto &name : agent_cols) {
-                m_buffer << "|" << name;
+                column_name.push_back(name);
+                m_column_type.push_back(M_COLUMN_TYPE_DOUBLE);
+            }
+
+            if (m_is_binary) {
+                write_header_binary(column_name);
+            }
+            else {
+                for (const auto &name : column_name) {
+                    if (first) {
+                        m_buffer << name;
+                        first = false;
+                    }
+                    else {
+                        m_buffer << "|" << name;
+                    }
+                }
+                m_buffer << "\n";
             }
-            m_buffer << "\n";
 
             m_last_telemetry.resize(base_columns.size() + agent_cols.size());
         }
@@ -267,12 +300,16 @@ namespace geopm
 
     void Tracer::write_line(void)
     {
+        if (m_is_binary) {
+            write_row_binary();
+            return;
+        }
         m_buffer << std::setprecision(m_precision) << std::scientific;
         for (size_t idx = 0; idx < m_last_telemetry.size(); ++idx) {
             if (idx != 0) {
                 m_buffer << "|";
             }
-            if (m_hex_column.find(m_column_idx[idx]) != m_hex_column.end()) {
+            if (m_column_type[idx] == M_COLUMN_TYPE_UINT64) {
                 m_buffer << "0x" << std::hex << std::setfill('0') << std::setw(16);
                 uint64_t value = geopm_signal_to_field(m_last_telemetry[idx]);
                 if ((int)idx == m_region_id_idx) {
@@ -294,6 +331,88 @@ namespace geopm
         m_buffer << "\n";
     }
 
+    // Binary trace layout, all integers little-endian:
+    //     char[8]  "GEOPMTRB"
+    //     uint32   format version
+    //     uint32   number of columns
+    //     uint32   length of text header, then the text header
+    //     for each column:
+    //         uint32   column type (m_column_type_e)
+    //         uint32   length of column name, then the name
+    //     zero padding to a multiple of 8 bytes
+    // followed by any number of blocks:
+    //     uint32   number of rows in the block
+    //     uint32   encoding of the block data, 0 for raw values
+    //     for each column, the 64-bit value of each row
+    void Tracer::write_header_binary(const std::vector<std::string> &column_name)
+    {
+        const uint32_t version = 1;
+        std::string text_header = m_buffer.str();
+        m_buffer.str("");
+        std::ostringstream header;
+        auto write_u32 = [&header](uint32_t value) {
+            value = htole32(value);
+            header.write((const char *)&value, sizeof(value));
+        };
+        header.write("GEOPMTRB", 8);
+        write_u32(version);
+        write_u32(column_name.size());
+        write_u32(text_header.size());
+        header << text_header;
+        for (size_t col_idx = 0; col_idx < column_name.size(); ++col_idx) {
+            write_u32(m_column_type[col_idx]);
+            write_u32(column_name[col_idx].size());
+            header << column_name[col_idx];
+        }
+        std::string result = header.str();
+        result.resize(8 * ((result.size() + 7) / 8), '\0');
+        m_buffer << result;
+        m_block.reserve(M_BLOCK_NUM_ROW * column_name.size());
+        m_block_column.resize(M_BLOCK_NUM_ROW * column_name.size());
+    }
+
+    void Tracer::write_row_binary(void)
+    {
+        for (size_t idx = 0; idx < m_last_telemetry.size(); ++idx) {
+            uint64_t value;
+            if (m_column_type[idx] == M_COLUMN_TYPE_UINT64) {
+                value = geopm_signal_to_field(m_last_telemetry[idx]);
+                if ((int)idx == m_region_id_idx) {
+                    // Remove hints from trace
+                    value = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, value);
+                }
+            }
+            else {
+                memcpy(&value, &m_last_telemetry[idx], sizeof(value));
+            }
+            m_block.push_back(value);
+        }
+        ++m_block_num_row;
+        if (m_block_num_row == M_BLOCK_NUM_ROW) {
+            write_block();
+        }
+    }
+
+    void Tracer::write_block(void)
+    {
+        if (m_block_num_row == 0) {
+            return;
+        }
+        size_t num_col = m_column_type.size();
+        // transpose rows into columns
+        for (size_t row = 0; row < m_block_num_row; ++row) {
+            for (size_t col = 0; col < num_col; ++col) {
+                m_block_column[col * m_block_num_row + row] = htole64(m_block[row * num_col + col]);
+            }
+        }
+        uint32_t block_header[2] = {htole32((uint32_t)m_block_num_row), htole32(0)};
+        m_buffer.write((const char *)block_header, sizeof(block_header));
+        m_buffer.write((const char *)m_block_column.data(),
+                       m_block_num_row * num_col * sizeof(uint64_t));
+        m_block.clear();
+        m_block_num_row = 0;
+    }
+
     void Tracer::update(const std::vector<double> &agent_values,
                         std::list<geopm_region_info_s> region_entry_exit)
     {
@@ -309,10 +428,9 @@ namespace geopm
             }
 #endif
             // save values to be reused for region entry/exit
-            size_t col_idx = 0;
-            for (; col_idx < m_column_idx.size(); ++col_idx) {
-                m_last_telemetry[col_idx] = m_platform_io.sample(m_column_idx[col_idx]);
-            }
+            m_platform_io.sample_group(m_column_group, m_column_value);
+            std::copy(m_column_value.begin(), m_column_value.end(), m_last_telemetry.begin());
+            size_t col_idx = m_column_idx.size();
             for (const auto &val : agent_values) {
                 m_last_telemetry[col_idx] = val;
                 ++col_idx;
@@ -354,6 +472,9 @@ namespace geopm
 
     void Tracer::flush(void)
     {
+        if (m_is_binary && m_is_trace_enabled) {
+            write_block();
+        }
         m_stream << m_buffer.str();
         m_buffer.str("");
         m_stream.close();
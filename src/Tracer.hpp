@@ -37,7 +37,6 @@
 #include <string>
 #include <vector>
 #include <sstream>
-#include <set>
 #include <list>
 
 #include "PlatformIO.hpp"
@@ -101,7 +100,8 @@ namespace geopm
                    bool do_trace,
                    IPlatformIO &platform_io,
                    const std::vector<std::string> &env_column,
-                   int precision);
+                   int precision,
+                   const std::string &format);
             /// @brief Tracer destructor, virtual.
             virtual ~Tracer();
             void update(const std::vector <struct geopm_telemetry_message_s> &telemetry) override;
@@ -115,6 +115,23 @@ namespace geopm
             static std::string hostname(void);
             /// @brief Format and write the values in m_last_telemetry to the trace.
             void write_line(void);
+            /// @brief Write the header of a binary trace: the text
+            ///        header lines followed by the name and type of
+            ///        each column.
+            void write_header_binary(const std::vector<std::string> &column_name);
+            /// @brief Add the values in m_last_telemetry as a row of
+            ///        the current binary block.
+            void write_row_binary(void);
+            /// @brief Write the rows held in m_block to the trace as
+            ///        one block of columns.
+            void write_block(void);
+            enum m_column_type_e {
+                M_COLUMN_TYPE_DOUBLE,
+                M_COLUMN_TYPE_UINT64,
+            };
+            enum {
+                M_BLOCK_NUM_ROW = 1024,
+            };
             std::string m_file_path;
             std::string m_header;
             std::string m_hostname;
@@ -130,11 +147,18 @@ namespace geopm
             std::vector<std::string> m_env_column; // extra columns from environment
             int m_precision;
             std::vector<int> m_column_idx; // columns sampled by Tracer
-            std::set<int> m_hex_column;
+            int m_column_group; // signal group of all columns sampled by Tracer
+            std::vector<double> m_column_value;
             std::vector<double> m_last_telemetry;
             int m_region_id_idx = -1;
             int m_region_progress_idx = -1;
             int m_region_runtime_idx = -1;
+            bool m_is_binary;
+            std::vector<int> m_column_type;
+            // Rows of raw 64-bit values not yet written
+            std::vector<uint64_t> m_block;
+            std::vector<uint64_t> m_block_column;
+            size_t m_block_num_row;
     };
 }
 
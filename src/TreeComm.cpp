@@ -35,7 +35,9 @@
 #include <algorithm>
 #include <memory>
 #include <cmath>
+#include <limits>
 
+#include "geopm_time.h"
 #include "TreeComm.hpp"
 #include "TreeCommLevel.hpp"
 #include "Comm.hpp"
@@ -157,7 +159,7 @@ namespace geopm
         m_level_ctl[level]->send_up(sample);
     }
 
-    void TreeComm::send_down(int level, const std::vector<std::vector<double> > &policy)
+    void TreeComm::send_down(int level, const MessageMatrix &policy)
     {
         if (level < 0 || level >= m_num_level_ctl) {
             throw Exception("TreeComm::send_down()",
@@ -166,7 +168,7 @@ namespace geopm
         m_level_ctl[level]->send_down(policy);
     }
 
-    bool TreeComm::receive_up(int level, std::vector<std::vector<double> > &sample)
+    bool TreeComm::receive_up(int level, MessageMatrix &sample)
     {
         if (level < 0 || level >= m_num_level_ctl) {
             throw Exception("TreeComm::receive_up()",
@@ -175,6 +177,17 @@ namespace geopm
         return m_level_ctl[level]->receive_up(sample);
     }
 
+    bool TreeComm::receive_up_aggregate(int level,
+                                        const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                        std::vector<double> &sample)
+    {
+        if (level < 0 || level >= m_num_level_ctl) {
+            throw Exception("TreeComm::receive_up_aggregate()",
+                            GEOPM_ERROR_LEVEL_RANGE, __FILE__, __LINE__);
+        }
+        return m_level_ctl[level]->receive_up_aggregate(agg_func, sample);
+    }
+
     bool TreeComm::receive_down(int level, std::vector<double> &policy)
     {
         if (level < 0 || (level != 0 && level >= m_num_level_ctl)) {
@@ -193,28 +206,161 @@ namespace geopm
         return result;
     }
 
+    void TreeComm::sample_tolerance(int level, const std::vector<double> &tolerance)
+    {
+        if (level < 0 || level >= (int)m_level_ctl.size()) {
+            throw Exception("TreeComm::sample_tolerance()",
+                            GEOPM_ERROR_LEVEL_RANGE, __FILE__, __LINE__);
+        }
+        m_level_ctl[level]->sample_tolerance(tolerance);
+    }
+
+    const double ITreeComm::M_MIN_CHILD_LATENCY = 1e-6;
+
     std::vector<int> ITreeComm::fan_out(const std::shared_ptr<IComm> &comm)
     {
-        std::vector<int> fan_out;
+        std::vector<int> result;
+        if (comm->num_rank() > 1) {
+            double level_latency = 0.0;
+            double child_latency = 0.0;
+            measure_latency(comm, level_latency, child_latency);
+            result = fan_out(comm, level_latency, child_latency);
+        }
+        return result;
+    }
+
+    std::vector<int> ITreeComm::fan_out(const std::shared_ptr<IComm> &comm,
+                                        double level_latency,
+                                        double child_latency)
+    {
+        std::vector<int> result;
         int num_nodes = comm->num_rank();
         if (num_nodes > 1) {
-            int num_fan_out = 1;
-            fan_out.resize(num_fan_out);
-            fan_out[0] = num_nodes;
-
-            while (fan_out[0] > M_MAX_FAN_OUT && fan_out[num_fan_out - 1] != 1) {
-                ++num_fan_out;
-                fan_out.resize(num_fan_out);
-                std::fill(fan_out.begin(), fan_out.end(), 0);
-                comm->dimension_create(num_nodes, fan_out);
+            // Trees with a level wider than M_MAX_FAN_OUT are only
+            // chosen when there is no narrower alternative; among
+            // trees of the same width the cheapest is chosen.
+            auto rank = [level_latency, child_latency](const std::vector<int> &candidate) {
+                int max_fan_out = *std::max_element(candidate.begin(), candidate.end());
+                return std::make_pair(std::max(max_fan_out - (int)M_MAX_FAN_OUT, 0),
+                                      fan_out_cost(candidate, level_latency, child_latency));
+            };
+            result = {num_nodes};
+            auto min_rank = rank(result);
+            // A tree deeper than log2(num_nodes) must have a level
+            // with a single child.
+            int max_depth = std::log2(num_nodes);
+            for (int depth = 2; depth <= max_depth; ++depth) {
+                std::vector<int> candidate(depth, 0);
+                comm->dimension_create(num_nodes, candidate);
+                if (std::find(candidate.begin(), candidate.end(), 1) != candidate.end()) {
+                    continue;
+                }
+                auto candidate_rank = rank(candidate);
+                if (candidate_rank < min_rank) {
+                    min_rank = candidate_rank;
+                    result = candidate;
+                }
             }
+            std::reverse(result.begin(), result.end());
+        }
+        return result;
+    }
 
-            if (num_fan_out > 1 && fan_out[num_fan_out - 1] == 1) {
-                --num_fan_out;
-                fan_out.resize(num_fan_out);
+    double ITreeComm::fan_out_cost(const std::vector<int> &fan_out,
+                                   double level_latency,
+                                   double child_latency)
+    {
+        double result = fan_out.size() * level_latency;
+        for (auto num_child : fan_out) {
+            result += num_child * child_latency;
+        }
+        return result;
+    }
+
+    void ITreeComm::measure_latency(const std::shared_ptr<IComm> &comm,
+                                    double &level_latency,
+                                    double &child_latency)
+    {
+        level_latency = 0.0;
+        child_latency = 0.0;
+        int num_rank = comm->num_rank();
+        if (num_rank < 2) {
+            return;
+        }
+        int rank = comm->rank();
+        double *mailbox = nullptr;
+        size_t window_id = 0;
+        if (!rank) {
+            size_t mem_size = sizeof(double) * num_rank;
+            comm->alloc_mem(mem_size, (void **)(&mailbox));
+            memset(mailbox, 0, mem_size);
+            window_id = comm->window_create(mem_size, (void *)mailbox);
+        }
+        else {
+            window_id = comm->window_create(0, NULL);
+        }
+        auto put_time = [&comm, rank, window_id] (void) {
+            double value = 1.0;
+            struct geopm_time_s begin;
+            struct geopm_time_s end;
+            geopm_time(&begin);
+            comm->window_lock(window_id, true, 0, 0);
+            comm->window_put(&value, sizeof(value), 0, rank * sizeof(double), window_id);
+            comm->window_unlock(window_id, 0);
+            geopm_time(&end);
+            return geopm_time_diff(&begin, &end);
+        };
+        // The median of the samples is used so that a few puts
+        // delayed by unrelated activity do not change the tree.
+        auto median = [](std::vector<double> &sample) {
+            auto mid_it = sample.begin() + sample.size() / 2;
+            std::nth_element(sample.begin(), mid_it, sample.end());
+            return *mid_it;
+        };
+        // latency[0]: put from rank 1 with no other sender
+        // latency[1]: put from each child when all children send at
+        //             once, the maximum is taken over the children
+        //             below
+        double latency[2] = {0.0, 0.0};
+        std::vector<double> sample(M_NUM_LATENCY_SAMPLE);
+        if (rank == 1) {
+            for (auto &sample_it : sample) {
+                sample_it = put_time();
+            }
+            latency[0] = median(sample);
+        }
+        for (auto &sample_it : sample) {
+            comm->barrier();
+            if (rank) {
+                sample_it = put_time();
             }
-            std::reverse(fan_out.begin(), fan_out.end());
         }
-        return fan_out;
+        if (rank) {
+            latency[1] = median(sample);
+        }
+        double max_latency[2] = {0.0, 0.0};
+        comm->reduce_max(latency, max_latency, 2, 0);
+        // result[0]: level latency, result[1]: child latency
+        double result[2] = {0.0, 0.0};
+        if (!rank) {
+            result[0] = max_latency[0];
+            // The slowest child waited for the puts of the other
+            // children to complete.
+            if (num_rank > 2) {
+                result[1] = (max_latency[1] - max_latency[0]) / (num_rank - 2);
+            }
+            // Contention that is too small to measure must not make
+            // children free in the cost model.
+            result[1] = std::max(result[1], M_MIN_CHILD_LATENCY);
+        }
+        // All ranks must agree on the tree shape, so the values
+        // derived by rank 0 are used everywhere.
+        comm->broadcast(result, sizeof(result), 0);
+        comm->window_destroy(window_id);
+        if (mailbox) {
+            comm->free_mem(mailbox);
+        }
+        level_latency = result[0];
+        child_latency = result[1];
     }
 }
@@ -34,6 +34,10 @@
 #define TREECOMM_HPP_INCLUDE
 
 #include <vector>
+#include <memory>
+#include <functional>
+
+#include "MessageMatrix.hpp"
 
 namespace geopm
 {
@@ -60,20 +64,90 @@ namespace geopm
             /// @brief Send samples up to the parent within a level.
             virtual void send_up(int level, const std::vector<double> &sample) = 0;
             /// @brief Send policies down to children within a level.
-            virtual void send_down(int level, const std::vector<std::vector<double> > &policy) = 0;
+            virtual void send_down(int level, const MessageMatrix &policy) = 0;
             /// @brief Receive samples from children within a level.
-            virtual bool receive_up(int level, std::vector<std::vector<double> > &sample) = 0;
+            virtual bool receive_up(int level, MessageMatrix &sample) = 0;
+            /// @brief Receive samples from children within a level
+            ///        and reduce them with one aggregation function
+            ///        per sample index.  Used in place of
+            ///        receive_up() when the Agent provides
+            ///        IAgent::aggregate_function().
+            virtual bool receive_up_aggregate(int level,
+                                              const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                              std::vector<double> &sample) = 0;
             /// @brief Receive policies from the parent within a level.
             virtual bool receive_down(int level, std::vector<double> &policy) = 0;
             /// @brief Returns the total number of bytes sent from the
             ///        entire tree.
             virtual size_t overhead_send(void) const = 0;
+            /// @brief Enable sparse sending of samples within a
+            ///        level: values are only sent up when they change
+            ///        by more than the tolerance, and receive_up()
+            ///        only returns true when a child sent a change.
+            /// @param [in] level Level of the tree; every rank of
+            ///        the level must set the same tolerance.
+            /// @param [in] tolerance Absolute tolerance for each
+            ///        sample index, e.g. from
+            ///        IAgent::sample_tolerance() of the agent that
+            ///        receives the samples at this level.
+            virtual void sample_tolerance(int level, const std::vector<double> &tolerance) = 0;
             /// @brief Returns the number of children at each level.
+            ///        The latencies of the cost model of
+            ///        fan_out_cost() are measured with
+            ///        measure_latency(), so this must be called by
+            ///        every rank of comm.
             static std::vector<int> fan_out(const std::shared_ptr<IComm> &comm);
+            /// @brief Returns the number of children at each level
+            ///        that minimizes fan_out_cost() for the given
+            ///        latencies among the balanced trees created by
+            ///        IComm::dimension_create().  A tree with more
+            ///        than 16 children at a level is only chosen when
+            ///        no narrower tree exists.
+            static std::vector<int> fan_out(const std::shared_ptr<IComm> &comm,
+                                            double level_latency,
+                                            double child_latency);
+            /// @brief Estimated time to pass a message from the
+            ///        leaves to the root of a tree.
+            /// @param [in] fan_out Number of children at each level.
+            /// @param [in] level_latency Time in seconds to send a
+            ///        message from one level to the next.
+            /// @param [in] child_latency Time in seconds for a parent
+            ///        to receive and process the message of one child.
+            static double fan_out_cost(const std::vector<int> &fan_out,
+                                       double level_latency,
+                                       double child_latency);
+            /// @brief Measures the latencies used by fan_out_cost().
+            ///
+            /// Rank 0 acts as the parent of all other ranks and the
+            /// children send it one value with a locked window put,
+            /// the same way that samples are sent up the tree.  The
+            /// level latency is the median put time from rank 1
+            /// while the other ranks are idle.  The child latency is
+            /// the additional median time taken by the slowest child
+            /// when all children send at once, divided by the number
+            /// of children that it waited for, and is at least 1 us.
+            /// Every rank of comm must call this method, and all
+            /// ranks return the values derived by rank 0.
+            ///
+            /// @param [in] comm Communicator the tree is created
+            ///        from.
+            /// @param [out] level_latency Time in seconds to send a
+            ///        message from one level to the next.
+            /// @param [out] child_latency Time in seconds for a
+            ///        parent to receive the message of one child.
+            static void measure_latency(const std::shared_ptr<IComm> &comm,
+                                        double &level_latency,
+                                        double &child_latency);
         private:
             enum m_tree_comm_const_e {
                 M_MAX_FAN_OUT = 16,
+                /// Number of messages timed by each rank in
+                /// measure_latency().
+                M_NUM_LATENCY_SAMPLE = 16,
             };
+            /// Lower bound on the measured time for a parent to
+            /// receive the message of one child.
+            static const double M_MIN_CHILD_LATENCY;
     };
 
     class TreeComm : public ITreeComm
@@ -93,11 +167,15 @@ namespace geopm
             int root_level(void) const override;
             int level_rank(int level) const override;
             int level_size(int level) const override;
-            void send_down(int level, const std::vector<std::vector<double> > &policy) override;
+            void send_down(int level, const MessageMatrix &policy) override;
             void send_up(int level, const std::vector<double> &sample) override;
             bool receive_down(int level, std::vector<double> &policy) override;
-            bool receive_up(int level, std::vector<std::vector<double> > &sample) override;
+            bool receive_up(int level, MessageMatrix &sample) override;
+            bool receive_up_aggregate(int level,
+                                      const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                      std::vector<double> &sample) override;
             size_t overhead_send(void) const override;
+            void sample_tolerance(int level, const std::vector<double> &tolerance) override;
         private:
             int num_level_controlled(std::vector<int> coords);
             std::vector<std::unique_ptr<ITreeCommLevel> > init_level(
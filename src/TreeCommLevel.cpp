@@ -52,9 +52,12 @@ namespace geopm
         , m_overhead_send(0)
         , m_num_send_up(num_send_up)
         , m_num_send_down(num_send_down)
+        , m_agg_operand(m_size)
+        , m_is_sample_changed(num_send_up)
+        , m_is_policy_changed(num_send_down)
     {
         if (!m_rank) {
-            m_policy_last.resize(m_size, std::vector<double>(num_send_down, 0.0));
+            m_policy_last.resize(m_size, num_send_down);
         }
         create_window();
     }
@@ -87,7 +90,10 @@ namespace geopm
         }
         size_t msg_size = m_num_send_up * sizeof(double);
         double is_ready = 1.0;
-        if (m_rank) {
+        if (m_sample_tolerance.size()) {
+            send_up_sparse(sample);
+        }
+        else if (m_rank) {
             size_t base_off = m_rank * (msg_size + sizeof(double));
             m_comm->window_lock(m_sample_window, true, 0, 0);
             m_comm->window_put(&is_ready, sizeof(double), 0, base_off, m_sample_window);
@@ -101,7 +107,7 @@ namespace geopm
         }
     }
 
-    void TreeCommLevel::send_down(const std::vector<std::vector<double> > &policy)
+    void TreeCommLevel::send_down(const MessageMatrix &policy)
     {
 #ifdef GEOPM_DEBUG
         if (m_rank != 0) {
@@ -109,11 +115,8 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        size_t num_down = m_num_send_down;
-        if (m_size != (int)policy.size() ||
-            std::any_of(policy.begin(), policy.end(),
-                        [num_down](std::vector<double> it)
-                        {return it.size() != num_down;})) {
+        if (m_size != (int)policy.num_row() ||
+            m_num_send_down != policy.num_col()) {
             throw Exception("TreeCommLevel::send_down(): policy vector is not sized correctly.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
@@ -121,21 +124,28 @@ namespace geopm
         double is_ready = 1.0;
         m_policy_mailbox[0] = is_ready;
         // Copy message to self for rank zero
-        memcpy(m_policy_mailbox + 1, policy[0].data(), msg_size);
+        memcpy(m_policy_mailbox + 1, policy[0], msg_size);
 
         for (int child_rank = 1; child_rank != m_size; ++child_rank) {
-            if (policy[child_rank] != m_policy_last[child_rank]) {
+            if (!policy.row_equal(child_rank, m_policy_last, child_rank)) {
+                // Only the values that changed are put; the rest of
+                // the child's mailbox still holds the last policy.
+                for (size_t policy_idx = 0; policy_idx != m_num_send_down; ++policy_idx) {
+                    m_is_policy_changed[policy_idx] = is_changed(policy[child_rank][policy_idx],
+                                                                 m_policy_last[child_rank][policy_idx], 0.0);
+                }
                 m_comm->window_lock(m_policy_window, true, child_rank, 0);
                 m_comm->window_put(&is_ready, sizeof(double), child_rank, 0, m_policy_window);
-                m_comm->window_put(policy[child_rank].data(), msg_size, child_rank, sizeof(double), m_policy_window);
+                m_overhead_send += sizeof(double) +
+                                   put_changed(m_is_policy_changed, policy[child_rank],
+                                               child_rank, sizeof(double), m_policy_window);
                 m_comm->window_unlock(m_policy_window, child_rank);
-                m_overhead_send += sizeof(double) + msg_size;
-                m_policy_last[child_rank] = policy[child_rank];
+                memcpy(m_policy_last[child_rank], policy[child_rank], msg_size);
             }
         }
     }
 
-    bool TreeCommLevel::receive_up(std::vector<std::vector<double> > &sample)
+    bool TreeCommLevel::receive_up(MessageMatrix &sample)
     {
 #ifdef GEOPM_DEBUG
         if (m_rank != 0) {
@@ -143,43 +153,161 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        size_t num_up = m_num_send_up;
-        if (m_size != (int)sample.size() ||
-            std::any_of(sample.begin(), sample.end(),
-                        [num_up](std::vector<double> it)
-                        {return it.size() != num_up;})) {
+        if (m_size != (int)sample.num_row() ||
+            m_num_send_up != sample.num_col()) {
             throw Exception("TreeCommLevel::send_down(): policy vector is not sized correctly.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
-        bool is_complete = true;
-        m_comm->window_lock(m_sample_window, false, 0, 0);
-        for (int child_rank = 0; is_complete && child_rank < m_size; ++child_rank) {
-            if (m_sample_mailbox[child_rank * (m_num_send_up + 1)] == 0.0) {
-                is_complete = false;
+        bool is_complete = is_sample_ready();
+        if (is_complete) {
+            m_comm->window_lock(m_sample_window, true, 0, 0);
+            // strided copy out of the mailbox
+            sample = m_sample_view;
+            for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+                m_sample_mailbox[child_rank * m_sample_view.stride()] = 0.0;
+            }
+            m_comm->window_unlock(m_sample_window, 0);
+            for (int child_rank = 0; is_complete && child_rank != m_size; ++child_rank) {
+                is_complete = std::none_of(sample[child_rank], sample[child_rank] + m_num_send_up,
+                                           [](double val) {return std::isnan(val);});
             }
         }
-        m_comm->window_unlock(m_sample_window, 0);
+        return is_complete;
+    }
+
+    bool TreeCommLevel::receive_up_aggregate(const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                             std::vector<double> &sample)
+    {
+#ifdef GEOPM_DEBUG
+        if (m_rank != 0) {
+            throw Exception("TreeCommLevel::receive_up_aggregate(): Only zero rank of the level can call receive_up_aggregate()",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        if (agg_func.size() != m_num_send_up || sample.size() != m_num_send_up) {
+            throw Exception("TreeCommLevel::receive_up_aggregate(): aggregation function or sample vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        bool is_complete = is_sample_ready();
         if (is_complete) {
             m_comm->window_lock(m_sample_window, true, 0, 0);
+            // reduce in place within the mailbox
+            for (size_t sample_idx = 0; is_complete && sample_idx != m_num_send_up; ++sample_idx) {
+                for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+                    m_agg_operand[child_rank] = m_sample_view[child_rank][sample_idx];
+                    if (std::isnan(m_agg_operand[child_rank])) {
+                        is_complete = false;
+                    }
+                }
+                sample[sample_idx] = agg_func[sample_idx](m_agg_operand);
+            }
             for (int child_rank = 0; child_rank != m_size; ++child_rank) {
-                memcpy(sample[child_rank].data(),
-                       m_sample_mailbox + child_rank * (m_num_send_up + 1) + 1,
-                       sizeof(double) * m_num_send_up);
-                m_sample_mailbox[child_rank * (m_num_send_up + 1)] = 0.0;
+                m_sample_mailbox[child_rank * m_sample_view.stride()] = 0.0;
             }
             m_comm->window_unlock(m_sample_window, 0);
         }
-
-        is_complete = is_complete &&
-                      !std::any_of(sample.begin(), sample.end(),
-                                   [](const std::vector<double> &vec)
-                                   {
-                                       return std::any_of(vec.begin(), vec.end(), isnan);
-                                   });
         return is_complete;
     }
 
+    bool TreeCommLevel::is_sample_ready(void)
+    {
+        bool result = true;
+        m_comm->window_lock(m_sample_window, false, 0, 0);
+        if (m_sample_tolerance.empty()) {
+            for (int child_rank = 0; result && child_rank < m_size; ++child_rank) {
+                if (m_sample_mailbox[child_rank * (m_num_send_up + 1)] == 0.0) {
+                    result = false;
+                }
+            }
+        }
+        else {
+            // Children only post changes, so the mailbox holds the
+            // latest value from every child once each has posted.
+            bool is_any_posted = false;
+            for (int child_rank = 0; child_rank < m_size; ++child_rank) {
+                if (m_sample_mailbox[child_rank * (m_num_send_up + 1)] != 0.0) {
+                    m_is_child_sent[child_rank] = true;
+                    is_any_posted = true;
+                }
+                else if (!m_is_child_sent[child_rank]) {
+                    result = false;
+                }
+            }
+            result = result && is_any_posted;
+        }
+        m_comm->window_unlock(m_sample_window, 0);
+        return result;
+    }
+
+    void TreeCommLevel::send_up_sparse(const std::vector<double> &sample)
+    {
+        bool is_any_changed = false;
+        for (size_t sample_idx = 0; sample_idx != m_num_send_up; ++sample_idx) {
+            m_is_sample_changed[sample_idx] = is_changed(sample[sample_idx], m_sample_last[sample_idx],
+                                                         m_sample_tolerance[sample_idx]);
+            if (m_is_sample_changed[sample_idx]) {
+                m_sample_last[sample_idx] = sample[sample_idx];
+                is_any_changed = true;
+            }
+        }
+        // If nothing changed the parent keeps the last values
+        if (is_any_changed) {
+            double is_ready = 1.0;
+            size_t msg_size = m_num_send_up * sizeof(double);
+            if (m_rank) {
+                size_t base_off = m_rank * (msg_size + sizeof(double));
+                m_comm->window_lock(m_sample_window, true, 0, 0);
+                m_comm->window_put(&is_ready, sizeof(double), 0, base_off, m_sample_window);
+                m_overhead_send += sizeof(double) +
+                                   put_changed(m_is_sample_changed, m_sample_last.data(),
+                                               0, base_off + sizeof(double), m_sample_window);
+                m_comm->window_unlock(m_sample_window, 0);
+            }
+            else {
+                m_sample_mailbox[0] = 1.0;
+                memcpy(m_sample_mailbox + 1, m_sample_last.data(), msg_size);
+            }
+        }
+    }
+
+    size_t TreeCommLevel::put_changed(const std::vector<bool> &is_changed, const double *value,
+                                      int rank, off_t disp, size_t window_id)
+    {
+        size_t result = 0;
+        size_t num_value = is_changed.size();
+        size_t begin = 0;
+        while (begin != num_value) {
+            if (is_changed[begin]) {
+                size_t end = begin + 1;
+                while (end != num_value && is_changed[end]) {
+                    ++end;
+                }
+                size_t put_size = (end - begin) * sizeof(double);
+                m_comm->window_put(value + begin, put_size, rank,
+                                   disp + begin * sizeof(double), window_id);
+                result += put_size;
+                begin = end;
+            }
+            else {
+                ++begin;
+            }
+        }
+        return result;
+    }
+
+    bool TreeCommLevel::is_changed(double value, double last, double tolerance)
+    {
+        bool result;
+        if (std::isnan(value) || std::isnan(last)) {
+            result = std::isnan(value) != std::isnan(last);
+        }
+        else {
+            result = std::fabs(value - last) > tolerance;
+        }
+        return result;
+    }
+
     bool TreeCommLevel::receive_down(std::vector<double> &policy)
     {
         bool is_complete = false;
@@ -195,7 +323,8 @@ namespace geopm
             m_comm->window_unlock(m_policy_window, m_rank);
         }
         is_complete = is_complete &&
-                      !std::any_of(policy.begin(), policy.end(), isnan);
+                      !std::any_of(policy.begin(), policy.end(),
+                                   [](double val) {return std::isnan(val);});
         return is_complete;
     }
 
@@ -204,6 +333,19 @@ namespace geopm
         return m_overhead_send;
     }
 
+    void TreeCommLevel::sample_tolerance(const std::vector<double> &tolerance)
+    {
+        if (tolerance.size() != m_num_send_up ||
+            std::any_of(tolerance.begin(), tolerance.end(),
+                        [](double tol) {return !(tol >= 0.0);})) {
+            throw Exception("TreeCommLevel::sample_tolerance(): tolerance vector is not sized correctly or has negative values.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_sample_tolerance = tolerance;
+        m_sample_last.assign(m_num_send_up, NAN);
+        m_is_child_sent.assign(m_size, false);
+    }
+
     void TreeCommLevel::create_window()
     {
         // Create policy window
@@ -221,6 +363,7 @@ namespace geopm
         mem_size = sizeof(double) * m_size * (m_num_send_up + 1);
         m_comm->alloc_mem(mem_size, (void **)(&m_sample_mailbox));
         memset(m_sample_mailbox, 0, mem_size);
+        m_sample_view = MessageMatrix(m_sample_mailbox + 1, m_size, m_num_send_up, m_num_send_up + 1);
         if (!m_rank) {
             m_sample_window = m_comm->window_create(mem_size, (void *)(m_sample_mailbox));
         }
@@ -33,8 +33,13 @@
 #ifndef TREECOMMLEVEL_HPP_INCLUDE
 #define TREECOMMLEVEL_HPP_INCLUDE
 
+#include <sys/types.h>
+
 #include <vector>
 #include <memory>
+#include <functional>
+
+#include "MessageMatrix.hpp"
 
 namespace geopm
 {
@@ -50,14 +55,30 @@ namespace geopm
             /// @brief Send samples up to the parent.
             virtual void send_up(const std::vector<double> &sample) = 0;
             /// @brief Send policies down to children.
-            virtual void send_down(const std::vector<std::vector<double> > &policy) = 0;
+            virtual void send_down(const MessageMatrix &policy) = 0;
             /// @brief Receive samples up from children.
-            virtual bool receive_up(std::vector<std::vector<double> > &sample) = 0;
+            virtual bool receive_up(MessageMatrix &sample) = 0;
+            /// @brief Receive samples up from children and reduce
+            ///        them directly from the mailbox.
+            /// @param [in] agg_func Aggregation function applied
+            ///        across the children for each sample index.
+            /// @param [out] sample Aggregated samples, one per
+            ///        element of agg_func.
+            virtual bool receive_up_aggregate(const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                              std::vector<double> &sample) = 0;
             /// @brief Receive policies down from the parent.
             virtual bool receive_down(std::vector<double> &policy) = 0;
             /// @brief Returns the total number of bytes sent at this
             ///        level.
             virtual size_t overhead_send(void) const = 0;
+            /// @brief Enable sparse sending of samples.  A sample
+            ///        value is only sent up when it differs from the
+            ///        value last sent by more than its tolerance, and
+            ///        the parent only reports a received sample when
+            ///        at least one child sent a change.
+            /// @param [in] tolerance Absolute tolerance for each
+            ///        sample index.
+            virtual void sample_tolerance(const std::vector<double> &tolerance) = 0;
     };
 
     class TreeCommLevel : public ITreeCommLevel
@@ -67,12 +88,27 @@ namespace geopm
             virtual ~TreeCommLevel();
             int level_rank(void) const override;
             void send_up(const std::vector<double> &sample) override;
-            void send_down(const std::vector<std::vector<double> > &policy) override;
-            bool receive_up(std::vector<std::vector<double> > &sample) override;
+            void send_down(const MessageMatrix &policy) override;
+            bool receive_up(MessageMatrix &sample) override;
+            bool receive_up_aggregate(const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                      std::vector<double> &sample) override;
             bool receive_down(std::vector<double> &policy) override;
             size_t overhead_send(void) const override;
+            void sample_tolerance(const std::vector<double> &tolerance) override;
         private:
             void create_window();
+            /// @brief Returns true if all children have posted a
+            ///        sample to the mailbox.  With sparse sampling,
+            ///        returns true if any child has posted a change
+            ///        and every child has posted at least once.
+            bool is_sample_ready(void);
+            void send_up_sparse(const std::vector<double> &sample);
+            /// @brief Put each contiguous run of changed values into
+            ///        the window with one window_put().
+            /// @return Number of bytes put.
+            size_t put_changed(const std::vector<bool> &is_changed, const double *value,
+                               int rank, off_t disp, size_t window_id);
+            static bool is_changed(double value, double last, double tolerance);
             std::shared_ptr<IComm> m_comm;
             int m_size;
             int m_rank;
@@ -81,9 +117,22 @@ namespace geopm
             size_t m_sample_window;
             size_t m_policy_window;
             size_t m_overhead_send;
-            std::vector<std::vector<double> > m_policy_last;
+            MessageMatrix m_policy_last;
+            /// View of the sample mailbox excluding the ready flags
+            MessageMatrix m_sample_view;
             size_t m_num_send_up;
             size_t m_num_send_down;
+            /// Values of one sample index across all children
+            std::vector<double> m_agg_operand;
+            /// Per sample index tolerance; empty unless sparse
+            /// sampling is enabled.
+            std::vector<double> m_sample_tolerance;
+            /// Sample values last sent to the parent.
+            std::vector<double> m_sample_last;
+            std::vector<bool> m_is_sample_changed;
+            std::vector<bool> m_is_policy_changed;
+            /// Children that have posted at least one sample.
+            std::vector<bool> m_is_child_sent;
     };
 }
 
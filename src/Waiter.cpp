@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <time.h>
+
+#include "Waiter.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    Waiter::Waiter(double period)
+        : m_period(period)
+    {
+        if (!(period >= 0.0)) {
+            throw Exception("Waiter::Waiter(): period must be non-negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        reset();
+    }
+
+    void Waiter::reset(void)
+    {
+        struct geopm_time_s now;
+        clock_gettime(CLOCK_MONOTONIC, &(now.t));
+        geopm_time_add(&now, m_period, &m_deadline);
+    }
+
+    void Waiter::wait(void)
+    {
+        struct geopm_time_s now;
+        clock_gettime(CLOCK_MONOTONIC, &(now.t));
+        if (geopm_time_comp(&now, &m_deadline)) {
+            int err = 0;
+            do {
+                err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &(m_deadline.t), NULL);
+            } while (err == EINTR);
+            if (err) {
+                throw Exception("Waiter::wait(): clock_nanosleep() failed",
+                                err, __FILE__, __LINE__);
+            }
+            struct geopm_time_s last_deadline = m_deadline;
+            geopm_time_add(&last_deadline, m_period, &m_deadline);
+        }
+        else {
+            geopm_time_add(&now, m_period, &m_deadline);
+        }
+    }
+
+    double Waiter::period(void) const
+    {
+        return m_period;
+    }
+
+    void Waiter::period(double period)
+    {
+        if (!(period >= 0.0)) {
+            throw Exception("Waiter::period(): period must be non-negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        struct geopm_time_s last_deadline = m_deadline;
+        geopm_time_add(&last_deadline, period - m_period, &m_deadline);
+        m_period = period;
+    }
+}
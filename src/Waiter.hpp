@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WAITER_HPP_INCLUDE
+#define WAITER_HPP_INCLUDE
+
+#include "geopm_time.h"
+
+namespace geopm
+{
+    /// @brief Sleeps the calling thread to hold a fixed period
+    ///        between successive returns from wait().
+    ///
+    /// The end of each period is tracked as an absolute deadline on
+    /// CLOCK_MONOTONIC and the thread sleeps with clock_nanosleep()
+    /// so that the controller does not consume a core while it waits
+    /// for the next sample.  Time spent by the caller between calls
+    /// to wait() counts towards the period.
+    class Waiter
+    {
+        public:
+            /// @brief Start the first period.
+            /// @param [in] period Duration of each period in seconds.
+            Waiter(double period);
+            virtual ~Waiter() = default;
+            /// @brief Start a new period from the current time.
+            void reset(void);
+            /// @brief Sleep until the end of the current period and
+            ///        start the next one.  If the period has already
+            ///        expired, return immediately and start the
+            ///        next period from the current time rather than
+            ///        trying to catch up.
+            void wait(void);
+            /// @brief Duration of each period in seconds.
+            double period(void) const;
+            /// @brief Change the duration of each period.  The end
+            ///        of the current period moves by the difference
+            ///        between the new and old durations.
+            /// @param [in] period Duration of each period in seconds.
+            void period(double period);
+        private:
+            double m_period;
+            struct geopm_time_s m_deadline;
+    };
+}
+
+#endif
@@ -47,10 +47,12 @@ const char *geopm_env_policy(void);
 const char *geopm_env_agent(void);
 const char *geopm_env_shmkey(void);
 const char *geopm_env_trace(void);
+const char *geopm_env_trace_format(void);
 const char *geopm_env_plugin_path(void);
 const char *geopm_env_report(void);
 const char *geopm_env_comm(void);
 const char *geopm_env_profile(void);
+const char *geopm_env_profile_table(void);
 const char *geopm_env_trace_signal(int);
 int geopm_env_num_trace_signal(void);
 int geopm_env_report_verbosity(void);
@@ -61,6 +63,9 @@ int geopm_env_do_profile(void);
 int geopm_env_profile_timeout(void);
 int geopm_env_debug_attach(void);
 int geopm_env_do_kontroller(void);
+int geopm_env_do_msr_async(void);
+int geopm_env_do_report_parallel(void);
+double geopm_env_ctl_overhead(void);
 
 #ifdef __cplusplus
 }
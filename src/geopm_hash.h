@@ -46,7 +46,7 @@
 #include "geopm_arch.h"
 
 #include <stdint.h>
-#ifdef X86
+#if defined(X86) && defined(__SSE4_2__)
 #include <smmintrin.h>
 #endif
 #include <string.h>
@@ -59,6 +59,13 @@ extern "C"
 unsigned int crc32_vpmsum(unsigned int crc, unsigned char *p, unsigned long len);
 #endif
 
+#if defined(X86) && !defined(__SSE4_2__)
+/// @brief CRC32C of one 64-bit word.  The build does not target
+///        SSE4.2, so the dynamic loader selects the crc32
+///        instruction when the CPU supports it and a lookup table
+///        otherwise; both give the same result.
+uint64_t geopm_crc32_u64(uint64_t begin, uint64_t key);
+#else
 static inline uint64_t geopm_crc32_u64(uint64_t begin, uint64_t key)
 {
 #ifdef X86
@@ -83,6 +90,7 @@ static inline uint64_t geopm_crc32_u64(uint64_t begin, uint64_t key)
 #endif
 
 }
+#endif
 
 uint64_t geopm_crc32_str(uint64_t begin, const char *key);
 
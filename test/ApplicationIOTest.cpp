@@ -49,6 +49,7 @@
 using geopm::ApplicationIO;
 using geopm::IPlatformTopo;
 using testing::Return;
+using testing::_;
 
 class ApplicationIOTest : public ::testing::Test
 {
@@ -63,6 +64,9 @@ class ApplicationIOTest : public ::testing::Test
         MockPlatformIO m_platform_io;
         MockPlatformTopo m_platform_topo;
         std::unique_ptr<ApplicationIO> m_app_io;
+        int m_energy_pkg_idx = 7;
+        int m_energy_dram_idx = 8;
+        int m_time_idx = 9;
 };
 
 void ApplicationIOTest::SetUp()
@@ -82,7 +86,16 @@ void ApplicationIOTest::SetUp()
         .WillOnce(Return(m_num_package_domain));
     m_num_memory_domain = 1;
     EXPECT_CALL(m_platform_topo, num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY))
-        .WillOnce(Return(m_num_memory_domain));
+        .Times(2)
+        .WillRepeatedly(Return(m_num_memory_domain));
+    EXPECT_CALL(m_platform_io, push_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(m_energy_pkg_idx));
+    EXPECT_CALL(m_platform_io, push_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(m_energy_dram_idx));
+    EXPECT_CALL(m_platform_io, push_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(m_time_idx));
+    EXPECT_CALL(m_platform_io, read_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(1.0));
     EXPECT_CALL(m_platform_io, read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, m_num_package_domain - 1))
         .WillOnce(Return(122.0));
     EXPECT_CALL(m_platform_io, read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, m_num_memory_domain - 1))
@@ -155,3 +168,32 @@ TEST_F(ApplicationIOTest, passthrough)
     EXPECT_CALL(*m_epoch_regulator, clear_region_info());
     m_app_io->clear_region_info();
 }
+
+TEST_F(ApplicationIOTest, update_energy)
+{
+    EXPECT_CALL(*m_sampler, sample(_, _, _)).Times(3);
+    EXPECT_CALL(*m_pio_sample, update(_, _)).Times(3);
+    // no batch has been read before the first update
+    EXPECT_CALL(*m_epoch_regulator, record_energy(_, _)).Times(0);
+    m_app_io->update(nullptr);
+
+    // later updates pass the batched energy to the regulator
+    EXPECT_CALL(m_platform_io, sample(m_energy_pkg_idx))
+        .WillOnce(Return(1000.0))
+        .WillOnce(Return(1500.0))
+        .WillOnce(Return(1600.0));
+    EXPECT_CALL(m_platform_io, sample(m_energy_dram_idx))
+        .WillOnce(Return(100.0))
+        .WillOnce(Return(150.0))
+        .WillOnce(Return(160.0));
+    EXPECT_CALL(m_platform_io, sample(m_time_idx))
+        .WillOnce(Return(2.0))
+        .WillOnce(Return(3.0));
+    EXPECT_CALL(*m_epoch_regulator, record_energy(1100.0, _));
+    m_app_io->update(nullptr);
+    EXPECT_CALL(*m_epoch_regulator, record_energy(1650.0, _));
+    m_app_io->update(nullptr);
+
+    // start energy was read directly at connect()
+    EXPECT_EQ(1760.0 - (122.0 + 221.0), m_app_io->total_app_energy());
+}
@@ -31,6 +31,7 @@
  */
 
 #include <iostream>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "CircularBuffer.hpp"
@@ -90,3 +91,50 @@ TEST_F(CircularBufferTest, buffer_capacity)
     m_buffer->set_capacity(2);
     EXPECT_EQ(2, m_buffer->capacity());
 }
+
+TEST_F(CircularBufferTest, fixed_buffer)
+{
+    geopm::FixedCircularBuffer<double, 4> buffer;
+    EXPECT_EQ(4, buffer.capacity());
+    EXPECT_EQ(0, buffer.size());
+    for (int idx = 1; idx <= 6; ++idx) {
+        buffer.insert(idx);
+    }
+    EXPECT_EQ(4, buffer.size());
+    EXPECT_DOUBLE_EQ(3.0, buffer.value(0));
+    EXPECT_DOUBLE_EQ(4.0, buffer.value(1));
+    EXPECT_DOUBLE_EQ(5.0, buffer.value(2));
+    EXPECT_DOUBLE_EQ(6.0, buffer.value(3));
+    buffer.clear();
+    EXPECT_EQ(0, buffer.size());
+    buffer.insert(7.0);
+    EXPECT_EQ(1, buffer.size());
+    EXPECT_DOUBLE_EQ(7.0, buffer.value(0));
+}
+
+TEST_F(CircularBufferTest, fixed_buffer_2d)
+{
+    geopm::FixedCircularBuffer2D<double, 2> buffer(3);
+    EXPECT_EQ(2, buffer.capacity());
+    EXPECT_EQ(3u, buffer.row_size());
+    EXPECT_EQ(0, buffer.size());
+    std::vector<double> row {1.0, 2.0, 3.0};
+    buffer.insert(row.data());
+    EXPECT_EQ(1, buffer.size());
+    EXPECT_DOUBLE_EQ(2.0, buffer.value(0)[1]);
+    for (auto &val : row) {
+        val += 10.0;
+    }
+    buffer.insert(row.data());
+    for (auto &val : row) {
+        val += 10.0;
+    }
+    buffer.insert(row.data());
+    EXPECT_EQ(2, buffer.size());
+    EXPECT_DOUBLE_EQ(11.0, buffer.value(0)[0]);
+    EXPECT_DOUBLE_EQ(13.0, buffer.value(0)[2]);
+    EXPECT_DOUBLE_EQ(21.0, buffer.value(1)[0]);
+    EXPECT_DOUBLE_EQ(23.0, buffer.value(1)[2]);
+    buffer.clear();
+    EXPECT_EQ(0, buffer.size());
+}
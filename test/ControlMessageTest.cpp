@@ -30,8 +30,13 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <unistd.h>
+
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "ControlMessage.hpp"
+#include "Exception.hpp"
 
 class ControlMessageTest: public geopm::ControlMessage, public testing::Test
 {
@@ -140,6 +145,26 @@ TEST_F(ControlMessageTest, wait)
     ASSERT_EQ(M_STATUS_MAP_END, m_test_ctl_msg_buffer.app_status);
 }
 
+TEST_F(ControlMessageTest, wait_blocked)
+{
+    // application blocks in wait() until the controller steps from
+    // another thread
+    std::thread ctl_thread([this] () {
+        usleep(20000);
+        m_test_ctl_msg->step();
+    });
+    m_test_app_msg->wait();
+    ASSERT_EQ(M_STATUS_MAP_BEGIN, m_test_ctl_msg_buffer.ctl_status);
+    ctl_thread.join();
+
+    std::thread abort_thread([this] () {
+        usleep(20000);
+        m_test_ctl_msg->abort();
+    });
+    EXPECT_THROW(m_test_app_msg->wait(), geopm::Exception);
+    abort_thread.join();
+}
+
 TEST_F(ControlMessageTest, cpu_rank)
 {
     int num_cpu = 256;
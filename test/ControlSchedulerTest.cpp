@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+#include <time.h>
+
+#include "gtest/gtest.h"
+
+#include "ControlScheduler.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::ControlScheduler;
+
+static double monotonic_time(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1E-9;
+}
+
+TEST(ControlSchedulerTest, disabled)
+{
+    ControlScheduler scheduler(0.0);
+    EXPECT_FALSE(scheduler.is_enabled());
+    scheduler.update(1.0, NAN);
+    EXPECT_EQ(0.0, scheduler.period());
+    scheduler.record_policy(false);
+    double begin = monotonic_time();
+    for (int step = 0; step < 4; ++step) {
+        for (int level = 0; level < 4; ++level) {
+            EXPECT_TRUE(scheduler.do_send_up(level));
+        }
+        scheduler.wait();
+    }
+    EXPECT_GT(0.5, monotonic_time() - begin);
+    EXPECT_EQ(0u, scheduler.report().size());
+}
+
+TEST(ControlSchedulerTest, period)
+{
+    ControlScheduler scheduler(0.1, 0.05, 4);
+    EXPECT_TRUE(scheduler.is_enabled());
+    EXPECT_EQ(0.0, scheduler.period());
+    // the first measurement sets the overhead directly
+    scheduler.update(0.001, NAN);
+    EXPECT_DOUBLE_EQ(0.01, scheduler.period());
+    // later measurements are smoothed
+    scheduler.update(0.009, NAN);
+    EXPECT_DOUBLE_EQ(0.02, scheduler.period());
+    // at least four steps per epoch
+    scheduler.update(0.002, 0.04);
+    EXPECT_DOUBLE_EQ(0.01, scheduler.period());
+    // never longer than the maximum period
+    scheduler.update(1.0, NAN);
+    EXPECT_DOUBLE_EQ(0.05, scheduler.period());
+    // unknown overhead is ignored
+    scheduler.update(NAN, NAN);
+    EXPECT_DOUBLE_EQ(0.05, scheduler.period());
+
+    double begin = monotonic_time();
+    scheduler.wait();
+    scheduler.wait();
+    EXPECT_LE(0.05, monotonic_time() - begin);
+
+    auto report = scheduler.report();
+    ASSERT_EQ(1u, report.size());
+    EXPECT_EQ("Controller scheduled period (sec)", report[0].first);
+    EXPECT_EQ("last=0.05 max=0.05 overhead-fraction=0.1", report[0].second);
+}
+
+TEST(ControlSchedulerTest, tree_decimation)
+{
+    ControlScheduler scheduler(0.1, 0.0, 1);
+    std::vector<int> num_send(5, 0);
+    int num_step = 32;
+    for (int step = 0; step < num_step; ++step) {
+        scheduler.record_policy(step == 0);
+        for (int level = 0; level < 5; ++level) {
+            num_send[level] += scheduler.do_send_up(level);
+        }
+        scheduler.wait();
+    }
+    // the leaf always sends, upper levels send every 2^level steps
+    // up to a stride of 16 while the policy is unchanged
+    EXPECT_EQ(num_step, num_send[0]);
+    EXPECT_EQ(16, num_send[1]);
+    EXPECT_EQ(8, num_send[2]);
+    EXPECT_EQ(4, num_send[3]);
+    EXPECT_EQ(2, num_send[4]);
+
+    // a policy change sends from every level
+    scheduler.record_policy(true);
+    for (int level = 0; level < 5; ++level) {
+        EXPECT_TRUE(scheduler.do_send_up(level));
+    }
+}
+
+TEST(ControlSchedulerTest, negative_construct)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(ControlScheduler(-0.1), GEOPM_ERROR_INVALID, "overhead fraction");
+    GEOPM_EXPECT_THROW_MESSAGE(ControlScheduler(1.0), GEOPM_ERROR_INVALID, "overhead fraction");
+    GEOPM_EXPECT_THROW_MESSAGE(ControlScheduler(0.1, -1.0, 4), GEOPM_ERROR_INVALID, "invalid maximum period");
+    GEOPM_EXPECT_THROW_MESSAGE(ControlScheduler(0.1, 1.0, 0), GEOPM_ERROR_INVALID, "invalid maximum period");
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <math.h>
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "ControllerIOGroup.hpp"
+#include "ControllerProfiler.hpp"
+#include "ControlScheduler.hpp"
+#include "PlatformTopo.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::ControllerIOGroup;
+using geopm::ControllerProfiler;
+using geopm::ControlScheduler;
+using geopm::PlatformTopo;
+using testing::HasSubstr;
+
+class ControllerIOGroupTest : public :: testing::Test
+{
+    protected:
+        void SetUp();
+        std::shared_ptr<ControllerProfiler> m_profiler;
+        std::shared_ptr<ControlScheduler> m_scheduler;
+        std::unique_ptr<ControllerIOGroup> m_group;
+};
+
+void ControllerIOGroupTest::SetUp()
+{
+    m_profiler = std::make_shared<ControllerProfiler>();
+    m_scheduler = std::make_shared<ControlScheduler>(0.1);
+    m_group = std::unique_ptr<ControllerIOGroup>(new ControllerIOGroup(m_profiler, m_scheduler));
+}
+
+TEST_F(ControllerIOGroupTest, profiler)
+{
+    for (int step = 0; step < 3; ++step) {
+        m_profiler->enter(ControllerProfiler::M_PHASE_STEP);
+        m_profiler->enter(ControllerProfiler::M_PHASE_READ_BATCH);
+        usleep(1000);
+        m_profiler->exit(ControllerProfiler::M_PHASE_READ_BATCH);
+        m_profiler->exit(ControllerProfiler::M_PHASE_STEP);
+    }
+    EXPECT_EQ(3u, m_profiler->histogram(ControllerProfiler::M_PHASE_STEP).count());
+    EXPECT_EQ(3u, m_profiler->histogram(ControllerProfiler::M_PHASE_READ_BATCH).count());
+    // the period is recorded between consecutive steps
+    EXPECT_EQ(2u, m_profiler->histogram(ControllerProfiler::M_PHASE_PERIOD).count());
+    EXPECT_EQ(0u, m_profiler->histogram(ControllerProfiler::M_PHASE_ASCEND).count());
+    EXPECT_LE(1E-3, m_profiler->histogram(ControllerProfiler::M_PHASE_READ_BATCH).max());
+    EXPECT_LE(m_profiler->histogram(ControllerProfiler::M_PHASE_READ_BATCH).max(),
+              m_profiler->histogram(ControllerProfiler::M_PHASE_STEP).max());
+
+    auto report = m_profiler->report();
+    ASSERT_EQ(3u, report.size());
+    EXPECT_EQ("Controller step latency (sec)", report[0].first);
+    EXPECT_EQ("Controller period latency (sec)", report[1].first);
+    EXPECT_EQ("Controller read-batch latency (sec)", report[2].first);
+    EXPECT_THAT(report[2].second, HasSubstr("count=3"));
+    EXPECT_THAT(report[2].second, HasSubstr("p99="));
+
+    EXPECT_EQ("TREE_RECEIVE", ControllerProfiler::phase_name(ControllerProfiler::M_PHASE_TREE_RECEIVE));
+    GEOPM_EXPECT_THROW_MESSAGE(ControllerProfiler::phase_name(ControllerProfiler::M_NUM_PHASE),
+                               GEOPM_ERROR_INVALID, "phase out of range");
+}
+
+TEST_F(ControllerIOGroupTest, valid_signals)
+{
+    auto names = m_group->signal_names();
+    EXPECT_EQ(3u * ControllerProfiler::M_NUM_PHASE + 1, names.size());
+    for (const auto &name : names) {
+        EXPECT_TRUE(m_group->is_valid_signal(name));
+        EXPECT_EQ(PlatformTopo::M_DOMAIN_BOARD, m_group->signal_domain_type(name));
+    }
+    EXPECT_TRUE(m_group->is_valid_signal("CONTROLLER::STEP_LATENCY_P99"));
+    EXPECT_TRUE(m_group->is_valid_signal("CONTROLLER::WALK_DOWN_LATENCY_MAX"));
+    EXPECT_FALSE(m_group->is_valid_signal("CONTROLLER::STEP"));
+    EXPECT_EQ(PlatformTopo::M_DOMAIN_INVALID, m_group->signal_domain_type("CONTROLLER::STEP"));
+    EXPECT_EQ(0u, m_group->control_names().size());
+    EXPECT_FALSE(m_group->is_valid_control("CONTROLLER::STEP_LATENCY_P99"));
+}
+
+TEST_F(ControllerIOGroupTest, push_signal)
+{
+    int p99_idx = m_group->push_signal("CONTROLLER::STEP_LATENCY_P99", PlatformTopo::M_DOMAIN_BOARD, 0);
+    int max_idx = m_group->push_signal("CONTROLLER::STEP_LATENCY_MAX", PlatformTopo::M_DOMAIN_BOARD, 0);
+    EXPECT_NE(p99_idx, max_idx);
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->sample(p99_idx), GEOPM_ERROR_INVALID, "signal has not been read");
+
+    // no steps recorded yet
+    m_group->read_batch();
+    EXPECT_TRUE(isnan(m_group->sample(p99_idx)));
+    EXPECT_TRUE(isnan(m_group->sample(max_idx)));
+
+    m_profiler->enter(ControllerProfiler::M_PHASE_STEP);
+    usleep(1000);
+    m_profiler->exit(ControllerProfiler::M_PHASE_STEP);
+    // values are updated by read_batch()
+    EXPECT_TRUE(isnan(m_group->sample(p99_idx)));
+    m_group->read_batch();
+    double max = m_profiler->histogram(ControllerProfiler::M_PHASE_STEP).max();
+    EXPECT_EQ(max, m_group->sample(p99_idx));
+    EXPECT_EQ(max, m_group->sample(max_idx));
+    EXPECT_EQ(max, m_group->read_signal("CONTROLLER::STEP_LATENCY_P50", PlatformTopo::M_DOMAIN_BOARD, 0));
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("CONTROLLER::STEP_LATENCY_P50", PlatformTopo::M_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "cannot push signal after call to read_batch");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->sample(2), GEOPM_ERROR_INVALID, "batch_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->read_signal("CONTROLLER::STEP_LATENCY_P50", PlatformTopo::M_DOMAIN_CPU, 0),
+                               GEOPM_ERROR_INVALID, "not defined for domain");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_control("CONTROLLER::STEP_LATENCY_P50", PlatformTopo::M_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "no controls supported");
+}
+
+TEST_F(ControllerIOGroupTest, scheduled_period)
+{
+    int period_idx = m_group->push_signal("CONTROLLER::SCHEDULED_PERIOD", PlatformTopo::M_DOMAIN_BOARD, 0);
+    m_group->read_batch();
+    EXPECT_EQ(0.0, m_group->sample(period_idx));
+    m_scheduler->update(0.001, NAN);
+    m_group->read_batch();
+    EXPECT_DOUBLE_EQ(0.01, m_group->sample(period_idx));
+    EXPECT_DOUBLE_EQ(0.01, m_group->read_signal("CONTROLLER::SCHEDULED_PERIOD", PlatformTopo::M_DOMAIN_BOARD, 0));
+}
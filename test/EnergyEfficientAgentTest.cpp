@@ -55,6 +55,7 @@ using ::testing::Invoke;
 using ::testing::Sequence;
 using ::testing::Return;
 using ::testing::AtLeast;
+using ::testing::SetArgReferee;
 using geopm::EnergyEfficientAgent;
 using geopm::PlatformTopo;
 using geopm::IPlatformIO;
@@ -69,6 +70,15 @@ class EnergyEfficientAgentTest : public :: testing :: Test
             ENERGY_PKG_IDX,
             ENERGY_DRAM_IDX,
         };
+        enum mock_group_idx_e {
+            SAMPLE_GROUP,
+            CONTROL_GROUP,
+        };
+        // ENERGY_PACKAGE, ENERGY_DRAM and REGION_ID# sampled as a group
+        std::vector<double> group_sample(uint64_t region_id) const
+        {
+            return {8888, 10000, geopm_field_to_signal(region_id)};
+        }
 
         void SetUp();
         void TearDown();
@@ -115,6 +125,10 @@ void EnergyEfficientAgentTest::SetUp()
         .WillByDefault(Return(ENERGY_DRAM_IDX));
     ON_CALL(*m_platform_io, push_control("FREQUENCY", _, _))
         .WillByDefault(Return(FREQ_IDX));
+    ON_CALL(*m_platform_io, push_signal_group(_))
+        .WillByDefault(Return(SAMPLE_GROUP));
+    ON_CALL(*m_platform_io, push_control_group(_))
+        .WillByDefault(Return(CONTROL_GROUP));
     ON_CALL(*m_platform_io, agg_function(_))
         .WillByDefault(Return(IPlatformIO::agg_max));
     EXPECT_CALL(*m_platform_io, agg_function(_))
@@ -127,6 +141,8 @@ void EnergyEfficientAgentTest::SetUp()
     EXPECT_CALL(*m_platform_io, read_signal(_, _, _)).Times(AtLeast(1));
     EXPECT_CALL(*m_platform_io, push_signal(_, _, _)).Times(AtLeast(1));
     EXPECT_CALL(*m_platform_io, push_control(_, _, _)).Times(M_NUM_CPU);
+    EXPECT_CALL(*m_platform_io, push_signal_group(std::vector<int>{ENERGY_PKG_IDX, ENERGY_DRAM_IDX, REGION_ID_IDX}));
+    EXPECT_CALL(*m_platform_io, push_control_group(std::vector<int>(M_NUM_CPU, FREQ_IDX)));
 
     m_freq_min = 1800000000.0;
     m_freq_max = 2200000000.0;
@@ -167,18 +183,13 @@ void EnergyEfficientAgentTest::TearDown()
 
 TEST_F(EnergyEfficientAgentTest, map)
 {
-    EXPECT_CALL(*m_platform_io, sample(ENERGY_PKG_IDX))
-        .Times(M_NUM_REGIONS)
-        .WillRepeatedly(Return(8888));
-    EXPECT_CALL(*m_platform_io, sample(ENERGY_DRAM_IDX))
-        .Times(M_NUM_REGIONS)
-        .WillRepeatedly(Return(10000));
-
     for (size_t x = 0; x < M_NUM_REGIONS; x++) {
-        EXPECT_CALL(*m_platform_io, sample(REGION_ID_IDX))
-            .WillOnce(Return(geopm_field_to_signal(m_region_hash[x])));
+        EXPECT_CALL(*m_platform_io, sample_group(SAMPLE_GROUP, _))
+            .WillOnce(SetArgReferee<1>(group_sample(m_region_hash[x])));
         m_agent->sample_platform(m_sample);
-        EXPECT_CALL(*m_platform_io, adjust(FREQ_IDX, m_mapped_freqs[x])).Times(M_NUM_CPU);
+        EXPECT_EQ(8888, m_sample[0]);
+        EXPECT_EQ(10000, m_sample[1]);
+        EXPECT_CALL(*m_platform_io, adjust_group(CONTROL_GROUP, std::vector<double>(M_NUM_CPU, m_mapped_freqs[x])));
         m_agent->adjust_platform({});
     }
 }
@@ -191,16 +202,9 @@ TEST_F(EnergyEfficientAgentTest, name)
 
 TEST_F(EnergyEfficientAgentTest, hint)
 {
-    EXPECT_CALL(*m_platform_io, sample(ENERGY_PKG_IDX))
-        .Times(m_hints.size())
-        .WillRepeatedly(Return(8888));
-    EXPECT_CALL(*m_platform_io, sample(ENERGY_DRAM_IDX))
-        .Times(m_hints.size())
-        .WillRepeatedly(Return(10000));
-
     for (size_t x = 0; x < m_hints.size(); x++) {
-        EXPECT_CALL(*m_platform_io, sample(REGION_ID_IDX))
-            .WillOnce(Return(geopm_field_to_signal(
+        EXPECT_CALL(*m_platform_io, sample_group(SAMPLE_GROUP, _))
+            .WillOnce(SetArgReferee<1>(group_sample(
                 geopm_region_id_set_hint(m_hints[x], 0x1234))));
         double expected_freq = NAN;
         switch(m_hints[x]) {
@@ -223,7 +227,7 @@ TEST_F(EnergyEfficientAgentTest, hint)
                 expected_freq = 1.8e9;
                 break;
         }
-        EXPECT_CALL(*m_platform_io, adjust(FREQ_IDX, expected_freq)).Times(M_NUM_CPU);
+        EXPECT_CALL(*m_platform_io, adjust_group(CONTROL_GROUP, std::vector<double>(M_NUM_CPU, expected_freq)));
         m_agent->sample_platform(m_sample);
         m_agent->adjust_platform({});
     }
@@ -250,18 +254,21 @@ TEST_F(EnergyEfficientAgentTest, online_mode)
         EXPECT_CALL(*m_platform_io, push_signal("REGION_RUNTIME", _, _)).Times(1);
         EXPECT_CALL(*m_platform_io, push_signal("ENERGY_PACKAGE", _, _)).Times(2);
         EXPECT_CALL(*m_platform_io, push_signal("ENERGY_DRAM", _, _)).Times(2);
+        EXPECT_CALL(*m_platform_io, push_signal_group(_)).Times(1);
+        EXPECT_CALL(*m_platform_io, push_control_group(_)).Times(1);
 
         // reset agent with new settings
         m_agent = geopm::make_unique<EnergyEfficientAgent>(*m_platform_io, *m_platform_topo);
 
         {
             // within EfficientFreqRegion
-            EXPECT_CALL(*m_platform_io, sample(REGION_ID_IDX))
-                .WillOnce(Return(geopm_region_id_set_hint(m_hints[x], m_region_hash[x])));
-            EXPECT_CALL(*m_platform_io, sample(ENERGY_PKG_IDX)).Times(2);
-            EXPECT_CALL(*m_platform_io, sample(ENERGY_DRAM_IDX)).Times(2);
+            double region_id = geopm_region_id_set_hint(m_hints[x], m_region_hash[x]);
+            EXPECT_CALL(*m_platform_io, sample_group(SAMPLE_GROUP, _))
+                .WillOnce(SetArgReferee<1>(std::vector<double>{8888, 10000, region_id}));
+            EXPECT_CALL(*m_platform_io, sample(ENERGY_PKG_IDX)).Times(1);
+            EXPECT_CALL(*m_platform_io, sample(ENERGY_DRAM_IDX)).Times(1);
 
-            EXPECT_CALL(*m_platform_io, adjust(FREQ_IDX, _)).Times(M_NUM_CPU);
+            EXPECT_CALL(*m_platform_io, adjust_group(CONTROL_GROUP, _)).Times(1);
 
             m_agent->sample_platform(m_sample);
             m_agent->adjust_platform({});
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "geopm_time.h"
+#include "EpochRuntimeRegulator.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::EpochRuntimeRegulator;
+
+class EpochRuntimeRegulatorTest : public ::testing::Test
+{
+    protected:
+        void SetUp();
+        struct geopm_time_s time(double offset);
+        struct geopm_time_s m_time_zero;
+};
+
+void EpochRuntimeRegulatorTest::SetUp()
+{
+    m_time_zero = {{1, 0}};
+}
+
+struct geopm_time_s EpochRuntimeRegulatorTest::time(double offset)
+{
+    struct geopm_time_s result;
+    geopm_time_add(&m_time_zero, offset, &result);
+    return result;
+}
+
+TEST_F(EpochRuntimeRegulatorTest, epoch_energy_interpolated)
+{
+    EpochRuntimeRegulator regulator(1);
+    EXPECT_TRUE(std::isnan(regulator.total_epoch_energy()));
+
+    regulator.record_energy(100.0, time(0.0));
+    regulator.record_energy(200.0, time(1.0));
+    // 250 J at the first epoch is extrapolated from the last two records
+    regulator.epoch(0, time(1.5));
+    regulator.record_energy(300.0, time(2.0));
+    // a record with a stale time stamp is ignored
+    regulator.record_energy(900.0, time(2.0));
+    regulator.epoch(0, time(2.5));
+    EXPECT_DOUBLE_EQ(350.0 - 250.0, regulator.total_epoch_energy());
+
+    // interpolation within the last sample period
+    regulator.record_energy(500.0, time(4.0));
+    regulator.epoch(0, time(3.0));
+    EXPECT_DOUBLE_EQ(400.0 - 250.0, regulator.total_epoch_energy());
+}
+
+TEST_F(EpochRuntimeRegulatorTest, epoch_before_energy)
+{
+    EpochRuntimeRegulator regulator(1);
+    // the first epoch comes before the first batch is read
+    regulator.epoch(0, time(0.5));
+    regulator.record_energy(100.0, time(1.0));
+    regulator.epoch(0, time(1.0));
+    EXPECT_DOUBLE_EQ(0.0, regulator.total_epoch_energy());
+    regulator.record_energy(200.0, time(2.0));
+    regulator.epoch(0, time(2.0));
+    EXPECT_DOUBLE_EQ(100.0, regulator.total_epoch_energy());
+}
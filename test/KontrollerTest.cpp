@@ -57,6 +57,7 @@ using geopm::IPlatformTopo;
 using geopm::ApplicationIO;
 using geopm::IComm;
 using geopm::IAgent;
+using geopm::MessageMatrix;
 using testing::NiceMock;
 using testing::_;
 using testing::Return;
@@ -225,7 +226,7 @@ TEST_F(KontrollerTest, two_level_controller_1)
     kontroller.setup_trace();
 
     // mock parent sending to this child
-    std::vector<std::vector<double> > policy = {{1, 2}, {3, 4}};
+    MessageMatrix policy(std::vector<std::vector<double> > {{1, 2}, {3, 4}});
     m_tree_comm->send_down(num_level_ctl, policy);
 
     // should not interact with manager io
@@ -302,7 +303,7 @@ TEST_F(KontrollerTest, two_level_controller_2)
     kontroller.setup_trace();
 
     // mock parent sending to this child
-    std::vector<std::vector<double> > policy = {{1, 2}, {3, 4}};
+    MessageMatrix policy(std::vector<std::vector<double> > {{1, 2}, {3, 4}});
     m_tree_comm->send_down(num_level_ctl, policy);
 
     // should not interact with manager io
@@ -422,3 +423,86 @@ TEST_F(KontrollerTest, two_level_controller_0)
     EXPECT_NE(0, m_tree_comm->num_send());
     EXPECT_NE(0, m_tree_comm->num_recv());
 }
+
+TEST_F(KontrollerTest, two_level_controller_aggregate)
+{
+    int num_level_ctl = 2;
+    int root_level = 2;
+    std::vector<int> fan_out = {2, 2};
+    ASSERT_EQ(root_level, (int)fan_out.size());
+
+    EXPECT_CALL(*m_tree_comm, num_level_controlled())
+        .WillOnce(Return(num_level_ctl));
+    EXPECT_CALL(*m_tree_comm, root_level())
+        .WillOnce(Return(root_level));
+    for (int level = 0; level < num_level_ctl; ++level) {
+        EXPECT_CALL(*m_tree_comm, level_size(level)).WillOnce(Return(fan_out[level]));
+    }
+    std::vector<std::function<double(const std::vector<double> &)> > agg_func(m_num_send_up, IPlatformIO::agg_sum);
+    for (int level = 0; level < num_level_ctl + 1; ++level) {
+        auto tmp = new MockAgent();
+        EXPECT_CALL(*tmp, init(level));
+        tmp->init(level);
+        if (level < num_level_ctl) {
+            EXPECT_CALL(*tmp, aggregate_function())
+                .WillOnce(Return(agg_func));
+        }
+        m_level_agent.push_back(tmp);
+
+        m_agents.emplace_back(m_level_agent[level]);
+    }
+    ASSERT_EQ(3u, m_level_agent.size());
+
+    Kontroller kontroller(m_comm, m_topo, m_platform_io,
+                          m_agent_name, m_num_send_down, m_num_send_up,
+                          std::unique_ptr<MockTreeComm>(m_tree_comm),
+                          m_application_io,
+                          std::unique_ptr<MockReporter>(m_reporter),
+                          std::unique_ptr<MockTracer>(m_tracer),
+                          std::move(m_agents),
+                          std::unique_ptr<MockManagerIOSampler>(m_manager_io));
+
+    std::vector<std::string> trace_names = {"COL1", "COL2"};
+    EXPECT_CALL(*m_level_agent[0], trace_names()).WillOnce(Return(trace_names));
+    EXPECT_CALL(*m_tracer, columns(_));
+    kontroller.setup_trace();
+
+    EXPECT_CALL(m_platform_io, read_batch()).Times(m_num_step);
+    EXPECT_CALL(m_platform_io, write_batch()).Times(m_num_step);
+    EXPECT_CALL(*m_application_io, update(_)).Times(m_num_step);
+    EXPECT_CALL(*m_application_io, region_info()).Times(m_num_step)
+        .WillRepeatedly(Return(m_region_info));
+    EXPECT_CALL(*m_application_io, clear_region_info()).Times(m_num_step);
+    std::vector<double> manager_sample = {8.8, 9.9};
+    ASSERT_EQ(m_num_send_down, (int)manager_sample.size());
+    EXPECT_CALL(*m_manager_io, sample()).Times(m_num_step)
+        .WillRepeatedly(Return(manager_sample));
+    EXPECT_CALL(*m_tracer, update(_, _)).Times(m_num_step);
+    EXPECT_CALL(*m_level_agent[0], trace_values(_)).Times(m_num_step);
+    EXPECT_CALL(*m_level_agent[0], adjust_platform(_)).Times(m_num_step).WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_level_agent[0], sample_platform(_)).Times(m_num_step)
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_level_agent[0], wait()).Times(m_num_step);
+
+    EXPECT_CALL(*m_level_agent[1], descend(_, _)).Times(m_num_step)
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_level_agent[0], descend(_, _)).Times(m_num_step)
+        .WillRepeatedly(Return(true));
+    // samples are reduced by the tree comm instead of the agents
+    EXPECT_CALL(*m_level_agent[0], ascend(_, _)).Times(0);
+    EXPECT_CALL(*m_level_agent[1], ascend(_, _)).Times(0);
+
+    for (int step = 0; step < m_num_step; ++step) {
+        kontroller.step();
+    }
+
+    EXPECT_CALL(*m_level_agent[root_level], report_header()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(*m_level_agent[0], report_node()).WillOnce(Return(m_agent_report));
+    EXPECT_CALL(*m_level_agent[0], report_region()).WillOnce(Return(m_region_names));
+    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _));
+    EXPECT_CALL(*m_tracer, flush());
+    kontroller.generate();
+
+    EXPECT_NE(0, m_tree_comm->num_send());
+    EXPECT_NE(0, m_tree_comm->num_recv());
+}
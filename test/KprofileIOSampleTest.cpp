@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "geopm_time.h"
+#include "KprofileIOSample.hpp"
+#include "KruntimeRegulator.hpp"
+#include "MockEpochRuntimeRegulator.hpp"
+
+using geopm::KprofileIOSample;
+using testing::_;
+using testing::Return;
+using testing::ReturnRef;
+
+TEST(KprofileIOSampleTest, rank_index)
+{
+    // Ranks on the node are not contiguous.
+    std::vector<int> cpu_rank {10, 10, 74, 74};
+    MockEpochRuntimeRegulator epoch_regulator;
+    geopm::KruntimeRegulator region_regulator(2);
+    ON_CALL(epoch_regulator, region_regulator(_))
+        .WillByDefault(ReturnRef(region_regulator));
+    EXPECT_CALL(epoch_regulator, region_regulator(_)).Times(testing::AnyNumber());
+    KprofileIOSample sample(cpu_rank, epoch_regulator);
+    std::vector<int> expected_cpu_rank {0, 0, 1, 1};
+    EXPECT_EQ(expected_cpu_rank, sample.cpu_rank());
+
+    struct geopm_time_s time_0 {{1, 0}};
+    struct geopm_time_s time_1 {{2, 0}};
+    uint64_t region_id = 0x1234;
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > prof_sample {
+        {region_id, {74, region_id, time_0, 0.0}},
+        {GEOPM_REGION_ID_EPOCH, {10, GEOPM_REGION_ID_EPOCH, time_1, 0.0}},
+    };
+    EXPECT_CALL(epoch_regulator, record_exit(GEOPM_REGION_ID_UNMARKED, 1, _));
+    EXPECT_CALL(epoch_regulator, record_entry(region_id, 1, _));
+    EXPECT_CALL(epoch_regulator, epoch(0, _));
+    sample.update(prof_sample.cbegin(), prof_sample.cend());
+    std::vector<uint64_t> expected_region_id {GEOPM_REGION_ID_UNMARKED, GEOPM_REGION_ID_UNMARKED,
+                                              region_id, region_id};
+    EXPECT_EQ(expected_region_id, sample.per_cpu_region_id());
+
+    std::vector<double> expected_runtime {0.0, 0.0, 0.0, 0.0};
+    EXPECT_EQ(expected_runtime, sample.per_cpu_current_runtime());
+
+    // Only ranks with new samples pick up the updated runtime.
+    struct geopm_time_s time_2 {{4, 0}};
+    region_regulator.record_entry(0, time_0);
+    region_regulator.record_exit(0, time_2);
+    region_regulator.record_entry(1, time_0);
+    region_regulator.record_exit(1, time_1);
+    prof_sample = {{region_id, {74, region_id, time_1, 0.5}}};
+    sample.update(prof_sample.cbegin(), prof_sample.cend());
+    expected_runtime = {0.0, 0.0, 1.0, 1.0};
+    EXPECT_EQ(expected_runtime, sample.per_cpu_current_runtime());
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+
+#include "gtest/gtest.h"
+
+#include "LatencyHistogram.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::LatencyHistogram;
+
+TEST(LatencyHistogramTest, empty)
+{
+    LatencyHistogram hist;
+    EXPECT_EQ(0u, hist.count());
+    EXPECT_EQ(0.0, hist.total());
+    EXPECT_EQ(0.0, hist.max());
+    EXPECT_TRUE(isnan(hist.percentile(0.5)));
+    GEOPM_EXPECT_THROW_MESSAGE(hist.percentile(1.5), GEOPM_ERROR_INVALID,
+                               "fraction must be between 0 and 1");
+}
+
+TEST(LatencyHistogramTest, percentile)
+{
+    LatencyHistogram hist;
+    // 1 us to 1 ms in 1 us steps
+    for (int idx = 1; idx <= 1000; ++idx) {
+        hist.insert(idx * 1E-6);
+    }
+    EXPECT_EQ(1000u, hist.count());
+    EXPECT_NEAR(0.5005, hist.total(), 1E-6);
+    EXPECT_DOUBLE_EQ(1E-3, hist.max());
+    // bucket upper bounds are within 1/16 of the true value
+    EXPECT_LE(500E-6, hist.percentile(0.5));
+    EXPECT_GE(500E-6 * (1 + 1.0 / 16), hist.percentile(0.5));
+    EXPECT_LE(990E-6, hist.percentile(0.99));
+    EXPECT_GE(1E-3, hist.percentile(0.99));
+    EXPECT_DOUBLE_EQ(hist.max(), hist.percentile(1.0));
+    EXPECT_LE(1E-6, hist.percentile(0.0));
+    EXPECT_GE(1E-6 * (1 + 1.0 / 16), hist.percentile(0.0));
+}
+
+TEST(LatencyHistogramTest, range)
+{
+    LatencyHistogram hist;
+    // small values are exact and negative values are zero
+    hist.insert(-1.0);
+    hist.insert(3E-9);
+    EXPECT_EQ(0.0, hist.percentile(0.5));
+    EXPECT_DOUBLE_EQ(3E-9, hist.percentile(1.0));
+    // very large values do not overflow the last bucket
+    hist.insert(1E9);
+    EXPECT_DOUBLE_EQ(1E9, hist.max());
+    EXPECT_DOUBLE_EQ(1E9, hist.percentile(1.0));
+
+    hist.clear();
+    EXPECT_EQ(0u, hist.count());
+    EXPECT_EQ(0.0, hist.max());
+    EXPECT_TRUE(isnan(hist.percentile(0.99)));
+}
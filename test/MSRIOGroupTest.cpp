@@ -344,6 +344,101 @@ TEST_F(MSRIOGroupTest, sample)
     close(fd_1);
 }
 
+TEST_F(MSRIOGroupTest, sample_bulk)
+{
+    EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_PACKAGE, _, _)).Times(2);
+    EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_PACKAGE)).Times(2);
+    EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_CPU, _, _)).Times(2);
+    EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_CPU)).Times(2);
+
+    std::vector<int> signal_idx;
+    signal_idx.push_back(m_msrio_group->push_signal("MSR::PERF_STATUS:FREQ", IPlatformTopo::M_DOMAIN_PACKAGE, 0));
+    signal_idx.push_back(m_msrio_group->push_signal("MSR::PERF_FIXED_CTR0:INST_RETIRED_ANY",
+                                                    IPlatformTopo::M_DOMAIN_CPU, 0));
+    signal_idx.push_back(m_msrio_group->push_signal("MSR::PKG_ENERGY_STATUS:ENERGY", IPlatformTopo::M_DOMAIN_PACKAGE, 0));
+    signal_idx.push_back(m_msrio_group->push_signal("MSR::PERF_FIXED_CTR0:INST_RETIRED_ANY",
+                                                    IPlatformTopo::M_DOMAIN_CPU, 1));
+    std::vector<double> value(signal_idx.size(), NAN);
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->sample_bulk(signal_idx, value.data()),
+                               GEOPM_ERROR_RUNTIME, "sample_bulk() called before signal was read");
+
+    int fd_0 = open(m_test_dev_path[0].c_str(), O_RDWR);
+    int fd_1 = open(m_test_dev_path[1].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    ASSERT_NE(-1, fd_1);
+    std::vector<uint64_t> inst_0 {1234, 87654};
+    std::vector<uint64_t> inst_1 {5678, 65432};
+    std::vector<uint64_t> freq {0xB00, 0xC00};
+    std::vector<uint64_t> energy {0xFFFFFFFF00001000ULL, 0x2000};
+    for (int iter = 0; iter < 2; ++iter) {
+        ASSERT_EQ(sizeof(uint64_t), (size_t)pwrite(fd_0, &freq[iter], sizeof(uint64_t), 0x198));
+        ASSERT_EQ(sizeof(uint64_t), (size_t)pwrite(fd_0, &inst_0[iter], sizeof(uint64_t), 0x309));
+        ASSERT_EQ(sizeof(uint64_t), (size_t)pwrite(fd_1, &inst_1[iter], sizeof(uint64_t), 0x309));
+        ASSERT_EQ(sizeof(uint64_t), (size_t)pwrite(fd_0, &energy[iter], sizeof(uint64_t), 0x611));
+        m_msrio_group->read_batch();
+        m_msrio_group->sample_bulk(signal_idx, value.data());
+        for (auto idx : signal_idx) {
+            EXPECT_EQ(m_msrio_group->sample(idx), value[idx]);
+        }
+    }
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->sample_bulk({signal_idx[0], 4}, value.data()),
+                               GEOPM_ERROR_INVALID, "sample_idx out of range");
+    EXPECT_EQ(1.2e9, value[signal_idx[0]]);
+    EXPECT_EQ(87654 - 1234, value[signal_idx[1]]);
+    EXPECT_DOUBLE_EQ(0x2000 * 6.103515625e-05, value[signal_idx[2]]);
+    EXPECT_EQ(65432 - 5678, value[signal_idx[3]]);
+
+    close(fd_0);
+    close(fd_1);
+}
+
+TEST_F(MSRIOGroupTest, sample_age)
+{
+    EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_PACKAGE, _, _)).Times(1);
+    EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_PACKAGE)).Times(1);
+    EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_CPU, _, _)).Times(2);
+    EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_CPU)).Times(2);
+
+    EXPECT_TRUE(m_msrio_group->is_valid_signal("MSR::SAMPLE_AGE"));
+    EXPECT_EQ(1u, m_msrio_group->signal_names().count("MSR::SAMPLE_AGE"));
+    EXPECT_EQ(IPlatformTopo::M_DOMAIN_BOARD, m_msrio_group->signal_domain_type("MSR::SAMPLE_AGE"));
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->push_signal("MSR::SAMPLE_AGE", IPlatformTopo::M_DOMAIN_CPU, 0),
+                               GEOPM_ERROR_INVALID, "domain_type does not match");
+
+    // The sample age signal shares the index space of the MSR signals.
+    int freq_idx = m_msrio_group->push_signal("MSR::PERF_STATUS:FREQ", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+    int age_idx = m_msrio_group->push_signal("MSR::SAMPLE_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0);
+    int inst_idx = m_msrio_group->push_signal("MSR::PERF_FIXED_CTR0:INST_RETIRED_ANY",
+                                              IPlatformTopo::M_DOMAIN_CPU, 0);
+    EXPECT_EQ(0, freq_idx);
+    EXPECT_EQ(1, age_idx);
+    EXPECT_EQ(2, inst_idx);
+    EXPECT_EQ(age_idx, m_msrio_group->push_signal("MSR::SAMPLE_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0));
+    EXPECT_EQ(inst_idx, m_msrio_group->push_signal("MSR::PERF_FIXED_CTR0:INST_RETIRED_ANY",
+                                                   IPlatformTopo::M_DOMAIN_CPU, 0));
+
+    int fd_0 = open(m_test_dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    uint64_t value = 0xB00;
+    ASSERT_EQ(sizeof(value), (size_t)pwrite(fd_0, &value, sizeof(value), 0x198));
+    close(fd_0);
+
+    m_msrio_group->read_batch();
+    EXPECT_EQ(1.1e9, m_msrio_group->sample(freq_idx));
+    double age = m_msrio_group->sample(age_idx);
+    EXPECT_LE(0.0, age);
+    EXPECT_GT(1.0, age);
+    std::vector<double> bulk(3);
+    m_msrio_group->sample_bulk({inst_idx, age_idx, freq_idx}, bulk.data());
+    EXPECT_EQ(m_msrio_group->sample(inst_idx), bulk[0]);
+    EXPECT_EQ(age, bulk[1]);
+    EXPECT_EQ(1.1e9, bulk[2]);
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->sample(3),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+
+    EXPECT_EQ(0.0, m_msrio_group->read_signal("MSR::SAMPLE_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0));
+}
+
 TEST_F(MSRIOGroupTest, read_signal)
 {
     EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_PACKAGE, _, _)).Times(1);
@@ -483,8 +578,8 @@ TEST_F(MSRIOGroupTest, adjust)
     EXPECT_EQ(0x500ULL, (value & 0x3FFF));
 
     // Set frequency to 5 GHz, power to 200W
-    m_msrio_group->adjust(freq_idx_0, 5e9);
-    m_msrio_group->adjust(power_idx, 200);
+    std::vector<double> setting {5e9, 200};
+    m_msrio_group->adjust_bulk({freq_idx_0, power_idx}, setting.data());
     // Calling adjust without calling write_batch() should not
     // change the platform.
     num_read = pread(fd_0, &value, sizeof(value), 0x199);
@@ -506,6 +601,8 @@ TEST_F(MSRIOGroupTest, adjust)
 
     GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->push_control("INVALID", IPlatformTopo::M_DOMAIN_CPU, 0),
                                GEOPM_ERROR_INVALID, "cannot push a control after read_batch() or adjust()");
+    GEOPM_EXPECT_THROW_MESSAGE(m_msrio_group->adjust_bulk({freq_idx_0, 2}, setting.data()),
+                               GEOPM_ERROR_INVALID, "control_idx out of range");
 
     close(fd_0);
 }
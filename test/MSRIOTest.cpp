@@ -757,9 +757,18 @@ TEST_F(MSRIOTest, read_batch)
         }
     }
     m_msrio->config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    struct geopm_time_s time_before;
+    geopm_time(&time_before);
     std::vector<uint64_t> actual;
     m_msrio->read_batch(actual);
     EXPECT_EQ(expected, actual);
+    struct geopm_time_s time_batch = m_msrio->batch_time();
+    EXPECT_LE(0.0, geopm_time_diff(&time_before, &time_batch));
+
+    // Output is resized to the configured batch, not only grown.
+    m_msrio->config_batch({read_cpu_idx[0]}, {read_offset[0]}, {}, {}, {});
+    m_msrio->read_batch(actual);
+    EXPECT_EQ(std::vector<uint64_t>{expected[0]}, actual);
 }
 
 TEST_F(MSRIOTest, write_batch)
@@ -820,3 +829,59 @@ TEST_F(MSRIOTest, write_batch)
     EXPECT_THROW(m_msrio->config_batch(write_cpu_idx, {}, {}, {}, {}), geopm::Exception);
     EXPECT_THROW(m_msrio->config_batch({}, {}, write_cpu_idx, write_offset, {}), geopm::Exception);
 }
+
+TEST_F(MSRIOTest, read_batch_async)
+{
+    TestMSRIO *test_msrio = new TestMSRIO(m_num_cpu);
+    std::unique_ptr<geopm::IMSRIO> msrio(test_msrio);
+    geopm::AsyncMSRIO async_msrio(std::move(msrio));
+    std::vector<std::string> words {"software", "engineer", "document", "everyday"};
+    std::vector<uint64_t> offsets {0xd28, 0x520, 0x468, 0x570};
+    std::vector<std::string> new_words {"hardware", "designer", "notebook", "whenever"};
+
+    std::vector<int> read_cpu_idx;
+    std::vector<uint64_t> read_offset;
+    std::vector<uint64_t> expected;
+    std::vector<uint64_t> new_expected;
+    for (int ci = 0; ci < m_num_cpu; ++ci) {
+        for (size_t wi = 0; wi < words.size(); ++wi) {
+            read_cpu_idx.push_back(ci);
+            read_offset.push_back(offsets[wi]);
+            uint64_t result;
+            memcpy(&result, words[wi].data(), 8);
+            expected.push_back(result);
+            memcpy(&result, new_words[wi].data(), 8);
+            new_expected.push_back(result);
+        }
+    }
+    async_msrio.config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    std::vector<uint64_t> actual;
+    // First read is synchronous and subsequent reads return the
+    // batch issued at the end of the previous call.
+    async_msrio.read_batch(actual);
+    EXPECT_EQ(expected, actual);
+    struct geopm_time_s time_first = async_msrio.batch_time();
+    async_msrio.read_batch(actual);
+    EXPECT_EQ(expected, actual);
+    struct geopm_time_s time_second = async_msrio.batch_time();
+    EXPECT_LE(0.0, geopm_time_diff(&time_first, &time_second));
+
+    for (int ci = 0; ci < m_num_cpu; ++ci) {
+        for (size_t wi = 0; wi < words.size(); ++wi) {
+            memcpy(test_msrio->msr_space_ptr(ci, offsets[wi]), new_words[wi].data(), 8);
+        }
+    }
+    // The update is seen at the latest by the second read after it.
+    async_msrio.read_batch(actual);
+    async_msrio.read_batch(actual);
+    EXPECT_EQ(new_expected, actual);
+
+    // Single MSR operations are forwarded.
+    uint64_t field = async_msrio.read_msr(0, offsets[0]);
+    EXPECT_EQ(new_expected[0], field);
+
+    // Reconfiguration discards the outstanding read.
+    async_msrio.config_batch({read_cpu_idx[0]}, {read_offset[0]}, {}, {}, {});
+    async_msrio.read_batch(actual);
+    EXPECT_EQ(std::vector<uint64_t>{new_expected[0]}, actual);
+}
@@ -30,6 +30,7 @@
 #
 
 check_PROGRAMS += test/geopm_test
+check_PROGRAMS += test/geopm_kontroller_bench
 
 if ENABLE_MPI
     check_PROGRAMS += test/geopm_mpi_test_api
@@ -61,6 +62,8 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/CircularBufferTest.buffer_size \
               test/gtest_links/CircularBufferTest.buffer_values \
               test/gtest_links/CircularBufferTest.buffer_capacity \
+              test/gtest_links/CircularBufferTest.fixed_buffer \
+              test/gtest_links/CircularBufferTest.fixed_buffer_2d \
               test/gtest_links/GlobalPolicyTest.mode_tdp_balance_static \
               test/gtest_links/GlobalPolicyTest.mode_freq_uniform_static \
               test/gtest_links/GlobalPolicyTest.mode_freq_hybrid_static \
@@ -83,6 +86,18 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/ProfileTableTest.hello \
               test/gtest_links/ProfileTableTest.name_set_fill_short \
               test/gtest_links/ProfileTableTest.name_set_fill_long \
+              test/gtest_links/ProfileTableTest.ring_insert_dump \
+              test/gtest_links/ProfileTableTest.ring_overflow_drop \
+              test/gtest_links/ProfileTableTest.ring_multi_producer \
+              test/gtest_links/ProfileTableTest.ring_name_set_fill \
+              test/gtest_links/ProfileTableTest.name_arena \
+              test/gtest_links/ProfileTableTest.name_arena_fill \
+              test/gtest_links/RegionIdCacheTest.cached \
+              test/gtest_links/RegionIdCacheTest.concurrent_lookup \
+              test/gtest_links/RegionIdCacheTest.failed_lookup \
+              test/gtest_links/RegionIdCacheTest.resolve_throw \
+              test/gtest_links/RegionIdCacheTest.collision \
+              test/gtest_links/RegionIdCacheTest.full \
               test/gtest_links/RegionTest.identifier \
               test/gtest_links/RegionTest.sample_message \
               test/gtest_links/RegionTest.signal_last \
@@ -96,6 +111,8 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/RegionTest.signal_capacity_leaf \
               test/gtest_links/RegionTest.signal_capacity_tree \
               test/gtest_links/RegionTest.signal_invalid_entry \
+              test/gtest_links/RegionTest.signal_invalid_runtime \
+              test/gtest_links/RegionTest.signal_window_unordered \
               test/gtest_links/RegionTest.negative_region_invalid \
               test/gtest_links/RegionTest.negative_signal_invalid \
               test/gtest_links/RegionTest.negative_signal_derivative_tree \
@@ -130,6 +147,14 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/GoverningDeciderTest.1_socket_over_budget \
               test/gtest_links/GoverningDeciderTest.2_socket_under_budget \
               test/gtest_links/GoverningDeciderTest.2_socket_over_budget \
+              test/gtest_links/ControllerIOGroupTest.profiler \
+              test/gtest_links/ControllerIOGroupTest.valid_signals \
+              test/gtest_links/ControllerIOGroupTest.push_signal \
+              test/gtest_links/ControllerIOGroupTest.scheduled_period \
+              test/gtest_links/ControlSchedulerTest.disabled \
+              test/gtest_links/ControlSchedulerTest.period \
+              test/gtest_links/ControlSchedulerTest.tree_decimation \
+              test/gtest_links/ControlSchedulerTest.negative_construct \
               test/gtest_links/CpuinfoIOGroupTest.valid_signals \
               test/gtest_links/CpuinfoIOGroupTest.parse_cpu_info0 \
               test/gtest_links/CpuinfoIOGroupTest.parse_cpu_info1 \
@@ -153,6 +178,7 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/SharedMemoryTest.invalid_construction \
               test/gtest_links/SharedMemoryTest.share_data \
               test/gtest_links/SharedMemoryTest.share_data_ipc \
+              test/gtest_links/SharedMemoryTest.wait_blocked \
               test/gtest_links/EnvironmentTest.construction0 \
               test/gtest_links/EnvironmentTest.construction1 \
               test/gtest_links/SchedTest.test_proc_cpuset_0 \
@@ -166,6 +192,7 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/SchedTest.test_proc_cpuset_8 \
               test/gtest_links/ControlMessageTest.step \
               test/gtest_links/ControlMessageTest.wait \
+              test/gtest_links/ControlMessageTest.wait_blocked \
               test/gtest_links/ControlMessageTest.cpu_rank \
               test/gtest_links/ControlMessageTest.is_sample_begin \
               test/gtest_links/ControlMessageTest.is_sample_end \
@@ -184,11 +211,19 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/CommMPIImpTest.mpi_mem_ops \
               test/gtest_links/CommMPIImpTest.mpi_barrier \
               test/gtest_links/CommMPIImpTest.mpi_win_ops \
+              test/gtest_links/LatencyHistogramTest.empty \
+              test/gtest_links/LatencyHistogramTest.percentile \
+              test/gtest_links/LatencyHistogramTest.range \
+              test/gtest_links/MessageMatrixTest.construction \
+              test/gtest_links/MessageMatrixTest.row_access \
+              test/gtest_links/MessageMatrixTest.view_stride \
+              test/gtest_links/MessageMatrixTest.copy_move \
               test/gtest_links/MSRIOTest.read_aligned \
               test/gtest_links/MSRIOTest.read_unaligned \
               test/gtest_links/MSRIOTest.write \
               test/gtest_links/MSRIOTest.read_batch \
               test/gtest_links/MSRIOTest.write_batch \
+              test/gtest_links/MSRIOTest.read_batch_async \
               test/gtest_links/MSRTest.msr \
               test/gtest_links/MSRTest.msr_overflow \
               test/gtest_links/MSRTest.msr_64_bit \
@@ -222,6 +257,8 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/PlatformTopoTest.singleton_construction \
               test/gtest_links/PlatformTopoTest.bdx_domain_idx \
               test/gtest_links/PlatformTopoTest.bdx_domain_cpus \
+              test/gtest_links/PlatformTopoTest.sysfs_parse \
+              test/gtest_links/PlatformTopoTest.cache \
               test/gtest_links/PlatformTopoTest.parse_error \
               test/gtest_links/SingleTreeCommunicatorTest.hello \
               test/gtest_links/TreeCommunicatorTest.hello \
@@ -238,6 +275,8 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/MSRIOGroupTest.signal_error \
               test/gtest_links/MSRIOGroupTest.push_signal \
               test/gtest_links/MSRIOGroupTest.sample \
+              test/gtest_links/MSRIOGroupTest.sample_bulk \
+              test/gtest_links/MSRIOGroupTest.sample_age \
               test/gtest_links/MSRIOGroupTest.read_signal \
               test/gtest_links/MSRIOGroupTest.signal_alias \
               test/gtest_links/MSRIOGroupTest.control_error \
@@ -255,8 +294,12 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/PlatformIOTest.signal_power \
               test/gtest_links/PlatformIOTest.push_control \
               test/gtest_links/PlatformIOTest.sample \
+              test/gtest_links/PlatformIOTest.sample_group \
               test/gtest_links/PlatformIOTest.sample_region_total \
+              test/gtest_links/PlatformIOTest.sample_region_total_invalid \
               test/gtest_links/PlatformIOTest.adjust \
+              test/gtest_links/PlatformIOTest.adjust_vector \
+              test/gtest_links/PlatformIOTest.adjust_group \
               test/gtest_links/PlatformIOTest.read_signal \
               test/gtest_links/PlatformIOTest.write_control \
               test/gtest_links/PlatformIOTest.read_signal_override \
@@ -277,6 +320,7 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/ProfileTestIntegration.misconfig_table_shmem \
               test/gtest_links/ProfileTestIntegration.misconfig_affinity \
               test/gtest_links/ProfileTest.region \
+              test/gtest_links/ProfileTest.region_cache \
               test/gtest_links/ProfileTest.enter_exit \
               test/gtest_links/ProfileTest.progress \
               test/gtest_links/ProfileTest.epoch \
@@ -287,20 +331,38 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/TreeCommLevelTest.send_down \
               test/gtest_links/TreeCommLevelTest.receive_up_complete \
               test/gtest_links/TreeCommLevelTest.receive_up_incomplete \
+              test/gtest_links/TreeCommLevelTest.receive_up_aggregate \
               test/gtest_links/TreeCommLevelTest.receive_down_complete \
               test/gtest_links/TreeCommLevelTest.receive_down_incomplete \
+              test/gtest_links/TreeCommLevelTest.send_up_sparse \
+              test/gtest_links/TreeCommLevelTest.receive_up_sparse \
+              test/gtest_links/TreeCommLevelTest.send_down_changed \
               test/gtest_links/TreeCommTest.geometry \
               test/gtest_links/TreeCommTest.send_receive \
               test/gtest_links/TreeCommTest.overhead_send \
+              test/gtest_links/TreeCommTest.receive_up_aggregate \
+              test/gtest_links/TreeCommTest.sample_tolerance \
+              test/gtest_links/TreeCommTest.fan_out \
+              test/gtest_links/TreeCommTest.measure_latency \
+              test/gtest_links/WaiterTest.period \
+              test/gtest_links/WaiterTest.work_counts_toward_period \
+              test/gtest_links/WaiterTest.reset \
+              test/gtest_links/WaiterTest.set_period \
               test/gtest_links/MonitorAgentTest.fixed_signal_list \
               test/gtest_links/MonitorAgentTest.sample_platform \
               test/gtest_links/MonitorAgentTest.descend_nothing \
               test/gtest_links/MonitorAgentTest.ascend_aggregates_signals \
+              test/gtest_links/MonitorAgentTest.sample_tolerance \
               test/gtest_links/ReporterTest.generate \
+              test/gtest_links/ReporterTest.generate_parallel \
+              test/gtest_links/ReporterTest.generate_parallel_offset \
+              test/gtest_links/ReporterTest.generate_parallel_error \
+              test/gtest_links/ReporterTest.generate_parallel_fallback \
               test/gtest_links/KontrollerTest.single_node \
               test/gtest_links/KontrollerTest.two_level_controller_2 \
               test/gtest_links/KontrollerTest.two_level_controller_1 \
               test/gtest_links/KontrollerTest.two_level_controller_0 \
+              test/gtest_links/KontrollerTest.two_level_controller_aggregate \
               test/gtest_links/ManagerIOTest.write_json_file \
               test/gtest_links/ManagerIOTest.write_shm \
               test/gtest_links/ManagerIOTest.negative_write_json_file \
@@ -314,9 +376,14 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/ManagerIOSamplerTestIntegration.parse_shm \
               test/gtest_links/TracerTest.columns \
               test/gtest_links/TracerTest.update_samples \
+              test/gtest_links/TracerTest.update_samples_binary \
               test/gtest_links/TracerTest.region_entry_exit \
               test/gtest_links/AgentFactoryTest.static_info_monitor \
               test/gtest_links/ApplicationIOTest.passthrough \
+              test/gtest_links/ApplicationIOTest.update_energy \
+              test/gtest_links/EpochRuntimeRegulatorTest.epoch_energy_interpolated \
+              test/gtest_links/EpochRuntimeRegulatorTest.epoch_before_energy \
+              test/gtest_links/KprofileIOSampleTest.rank_index \
               test/gtest_links/KruntimeRegulatorTest.exceptions \
               test/gtest_links/KruntimeRegulatorTest.all_in_and_out \
               test/gtest_links/KruntimeRegulatorTest.all_reenter \
@@ -354,6 +421,7 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/ExceptionTest.cpp \
                           test/ProfileTableTest.cpp \
                           test/SampleRegulatorTest.cpp \
+                          test/RegionIdCacheTest.cpp \
                           test/RegionTest.cpp \
                           test/PolicyTest.cpp \
                           plugin/BalancingDecider.hpp \
@@ -373,6 +441,7 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/MockIOGroup.hpp \
                           test/MockRegion.hpp \
                           test/MockPolicy.hpp \
+                          test/ControllerIOGroupTest.cpp \
                           test/CpuinfoIOGroupTest.cpp \
                           test/EfficientFreqDeciderTest.cpp \
                           test/MockComm.hpp \
@@ -392,10 +461,13 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/EnvironmentTest.cpp \
                           test/SchedTest.cpp \
                           test/ControlMessageTest.cpp \
+                          test/ControlSchedulerTest.cpp \
                           test/CommMPIImpTest.cpp \
                           test/PlatformIOTest.cpp \
                           test/MSRIOTest.cpp \
                           test/MSRTest.cpp \
+                          test/MessageMatrixTest.cpp \
+                          test/LatencyHistogramTest.cpp \
                           plugin/EfficientFreqRegion.hpp \
                           plugin/EfficientFreqRegion.cpp \
                           test/EfficientFreqRegionTest.cpp \
@@ -422,11 +494,13 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/ProfileTest.cpp \
                           test/TreeCommLevelTest.cpp \
                           test/TreeCommTest.cpp \
+                          test/WaiterTest.cpp \
                           test/MockTreeCommLevel.hpp \
                           test/MonitorAgentTest.cpp \
                           test/AgentFactoryTest.cpp \
                           test/ReporterTest.cpp \
                           test/KontrollerTest.cpp \
+                          test/KprofileIOSampleTest.cpp \
                           test/MockApplicationIO.hpp \
                           test/MockAgent.hpp \
                           test/MockReporter.hpp \
@@ -435,6 +509,7 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/MockManagerIOSampler.hpp \
                           test/TracerTest.cpp \
                           test/ApplicationIOTest.cpp \
+                          test/EpochRuntimeRegulatorTest.cpp \
                           test/MockKprofileIOSample.hpp \
                           test/MockProfileIORuntime.hpp \
                           test/KruntimeRegulatorTest.cpp \
@@ -453,6 +528,11 @@ if GEOPM_DISABLE_NULL_PTR
     test_geopm_test_CFLAGS += -fno-delete-null-pointer-checks
     test_geopm_test_CXXFLAGS += -fno-delete-null-pointer-checks
 endif
+test_geopm_kontroller_bench_SOURCES = test/geopm_kontroller_bench.cpp
+test_geopm_kontroller_bench_LDADD = libgeopmpolicy.la
+test_geopm_kontroller_bench_CPPFLAGS = $(AM_CPPFLAGS) -Iplugin
+test_geopm_kontroller_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
 if ENABLE_OPENMP
     test_geopm_static_modes_test_SOURCES = test/geopm_static_modes_test.cpp
     test_geopm_static_modes_test_LDADD = libgeopmpolicy.la
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "MessageMatrix.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::MessageMatrix;
+
+TEST(MessageMatrixTest, construction)
+{
+    MessageMatrix empty;
+    EXPECT_EQ(0u, empty.num_row());
+    EXPECT_EQ(0u, empty.num_col());
+
+    MessageMatrix zeros(3, 2);
+    EXPECT_EQ(3u, zeros.num_row());
+    EXPECT_EQ(3u, zeros.size());
+    EXPECT_EQ(2u, zeros.num_col());
+    EXPECT_EQ(2u, zeros.stride());
+    EXPECT_EQ(std::vector<double>({0.0, 0.0}), zeros.row(2));
+
+    MessageMatrix rows(std::vector<std::vector<double> > {{1.0, 2.0}, {3.0, 4.0}});
+    EXPECT_EQ(2u, rows.num_row());
+    EXPECT_EQ(2u, rows.num_col());
+    EXPECT_EQ(3.0, rows[1][0]);
+    EXPECT_EQ(std::vector<double>({1.0, 2.0}), rows.row(0));
+    // consecutive rows are contiguous
+    EXPECT_EQ(rows[0] + 2, rows[1]);
+
+    GEOPM_EXPECT_THROW_MESSAGE(MessageMatrix(std::vector<std::vector<double> > {{1.0, 2.0}, {3.0}}),
+                               GEOPM_ERROR_INVALID, "not sized correctly");
+}
+
+TEST(MessageMatrixTest, row_access)
+{
+    MessageMatrix mat(2, 3);
+    mat.row(1, {4.0, 5.0, 6.0});
+    EXPECT_EQ(5.0, mat[1][1]);
+    mat[0][2] = 7.0;
+    EXPECT_EQ(std::vector<double>({0.0, 0.0, 7.0}), mat.row(0));
+
+    MessageMatrix other(std::vector<std::vector<double> > {{4.0, 5.0, 6.0}});
+    EXPECT_TRUE(mat.row_equal(1, other, 0));
+    EXPECT_FALSE(mat.row_equal(0, other, 0));
+
+    mat.fill(1.5);
+    EXPECT_EQ(std::vector<double>({1.5, 1.5, 1.5}), mat.row(1));
+    mat.resize(1, 4);
+    EXPECT_EQ(1u, mat.num_row());
+    EXPECT_EQ(std::vector<double>({0.0, 0.0, 0.0, 0.0}), mat.row(0));
+
+    GEOPM_EXPECT_THROW_MESSAGE(mat.row(1), GEOPM_ERROR_INVALID, "row out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(mat.row(0, {1.0}), GEOPM_ERROR_INVALID, "not sized correctly");
+}
+
+TEST(MessageMatrixTest, view_stride)
+{
+    // each row is preceded by a flag as in a TreeCommLevel mailbox
+    std::vector<double> mem {1.0, 10.0, 11.0,
+                             0.0, 20.0, 21.0};
+    MessageMatrix view(mem.data() + 1, 2, 2, 3);
+    EXPECT_EQ(3u, view.stride());
+    EXPECT_EQ(std::vector<double>({20.0, 21.0}), view.row(1));
+    view[1][0] = 22.0;
+    EXPECT_EQ(22.0, mem[4]);
+    EXPECT_EQ(MessageMatrix(std::vector<std::vector<double> > {{10.0, 11.0}, {22.0, 21.0}}), view);
+
+    GEOPM_EXPECT_THROW_MESSAGE(MessageMatrix(mem.data(), 2, 3, 2),
+                               GEOPM_ERROR_INVALID, "stride is less than number of columns");
+}
+
+TEST(MessageMatrixTest, copy_move)
+{
+    std::vector<double> mem {1.0, 10.0, 11.0,
+                             0.0, 20.0, 21.0};
+    MessageMatrix view(mem.data() + 1, 2, 2, 3);
+
+    // copy is dense and owned
+    MessageMatrix copy(view);
+    EXPECT_EQ(2u, copy.stride());
+    EXPECT_EQ(view, copy);
+    copy[0][0] = 99.0;
+    EXPECT_EQ(10.0, mem[1]);
+    EXPECT_NE(view, copy);
+
+    MessageMatrix assigned(2, 2);
+    assigned = view;
+    EXPECT_EQ(view, assigned);
+
+    // move keeps viewing the same memory
+    MessageMatrix moved(std::move(view));
+    EXPECT_EQ(0u, view.num_row());
+    EXPECT_EQ(3u, moved.stride());
+    EXPECT_EQ(mem.data() + 1, moved[0]);
+}
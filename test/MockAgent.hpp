@@ -43,10 +43,14 @@ class MockAgent : public geopm::IAgent
                      void(int level));
         MOCK_METHOD2(descend,
                      bool(const std::vector<double> &in_policy,
-                          std::vector<std::vector<double> >&out_policy));
+                          geopm::MessageMatrix &out_policy));
         MOCK_METHOD2(ascend,
-                     bool(const std::vector<std::vector<double> > &in_signal,
+                     bool(const geopm::MessageMatrix &in_signal,
                           std::vector<double> &out_signal));
+        MOCK_CONST_METHOD0(aggregate_function,
+                           std::vector<std::function<double(const std::vector<double> &)> >(void));
+        MOCK_CONST_METHOD0(sample_tolerance,
+                           std::vector<double>(void));
         MOCK_METHOD1(adjust_platform,
                      bool(const std::vector<double> &in_policy));
         MOCK_METHOD1(sample_platform,
@@ -78,6 +78,8 @@ class MockApplicationIO : public geopm::IApplicationIO
                      void(void));
         MOCK_METHOD0(controller_ready,
                      void(void));
+        MOCK_CONST_METHOD0(total_profile_drop,
+                           size_t(void));
 };
 
 #endif
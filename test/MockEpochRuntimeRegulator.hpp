@@ -50,6 +50,8 @@ class MockEpochRuntimeRegulator : public geopm::IEpochRuntimeRegulator {
                      void(uint64_t region_id, int rank, struct geopm_time_s entry_time));
         MOCK_METHOD3(record_exit,
                      void(uint64_t region_id, int rank, struct geopm_time_s exit_time));
+        MOCK_METHOD2(record_energy,
+                     void(double energy, struct geopm_time_s sample_time));
         MOCK_CONST_METHOD1(region_regulator,
                            const geopm::IKruntimeRegulator&(uint64_t region_id));
         MOCK_CONST_METHOD1(is_regulated,
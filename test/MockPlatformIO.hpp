@@ -58,16 +58,28 @@ class MockPlatformIO : public geopm::IPlatformIO
                      void(int signal_idx, int domain_type, int domain_idx));
         MOCK_METHOD3(push_control,
                      int(const std::string &control_name, int domain_type, int domain_idx));
+        MOCK_METHOD1(push_signal_group,
+                     int(const std::vector<int> &signal_idx));
+        MOCK_METHOD1(push_control_group,
+                     int(const std::vector<int> &control_idx));
         MOCK_CONST_METHOD0(num_signal,
                            int(void));
         MOCK_CONST_METHOD0(num_control,
                            int(void));
         MOCK_METHOD1(sample,
                      double(int signal_idx));
+        MOCK_METHOD2(sample,
+                     void(const std::vector<int> &signal_idx, std::vector<double> &signal_value));
+        MOCK_METHOD2(sample_group,
+                     void(int group_idx, std::vector<double> &signal_value));
         MOCK_METHOD2(sample_region_total,
                      double(int signal_idx, uint64_t region_id));
         MOCK_METHOD2(adjust,
                      void(int control_idx, double setting));
+        MOCK_METHOD2(adjust,
+                     void(const std::vector<int> &control_idx, const std::vector<double> &setting));
+        MOCK_METHOD2(adjust_group,
+                     void(int group_idx, const std::vector<double> &setting));
         MOCK_METHOD0(read_batch,
                      void(void));
         MOCK_METHOD0(write_batch,
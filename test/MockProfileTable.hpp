@@ -53,6 +53,16 @@ class MockProfileTable : public geopm::IProfileTable
                 bool (size_t header_offset));
         MOCK_METHOD2(name_set,
                 bool (size_t header_offset, std::set<std::string> &name));
+        MOCK_CONST_METHOD0(name_offset,
+                size_t (void));
+        MOCK_CONST_METHOD0(num_drop,
+                size_t (void));
+        void name_arena(std::unique_ptr<geopm::ProfileNameArena> arena) override
+        {
+            name_arena_mock(arena.get());
+        }
+        MOCK_METHOD1(name_arena_mock,
+                void (geopm::ProfileNameArena *arena));
 };
 
 #endif
@@ -52,23 +52,38 @@ class MockTreeComm : public geopm::ITreeComm
             ++m_num_send;
             m_data_sent_up[level] = sample;
         }
-        void send_down(int level, const std::vector<std::vector<double> > &policy) override
+        void send_down(int level, const geopm::MessageMatrix &policy) override
         {
             ++m_num_send;
             if (policy.size() == 0) {
                 throw std::runtime_error("MockTreeComm::send_down(): policy vector was wrong size");
             }
-            m_data_sent_down[level] = policy[0]; /// @todo slightly wrong
+            m_data_sent_down[level] = policy.row(0); /// @todo slightly wrong
         }
-        bool receive_up(int level, std::vector<std::vector<double> > &sample)
+        bool receive_up(int level, geopm::MessageMatrix &sample)
         {
             ++m_num_recv;
             if (m_data_sent_up.find(level) == m_data_sent_up.end()) {
                 throw std::runtime_error("MockTreeComm::receive_up(): no data for level " +
                                          std::to_string(level));
             }
-            for (auto &vec : sample) {
-                vec = m_data_sent_up.at(level);
+            for (size_t child = 0; child < sample.num_row(); ++child) {
+                sample.row(child, m_data_sent_up.at(level));
+            }
+            return true;
+        }
+        bool receive_up_aggregate(int level,
+                                  const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                  std::vector<double> &sample) override
+        {
+            ++m_num_recv;
+            if (m_data_sent_up.find(level) == m_data_sent_up.end()) {
+                throw std::runtime_error("MockTreeComm::receive_up_aggregate(): no data for level " +
+                                         std::to_string(level));
+            }
+            const std::vector<double> &data = m_data_sent_up.at(level);
+            for (size_t idx = 0; idx < sample.size(); ++idx) {
+                sample[idx] = agg_func.at(idx)({data.at(idx)});
             }
             return true;
         }
@@ -84,6 +99,8 @@ class MockTreeComm : public geopm::ITreeComm
         }
         MOCK_CONST_METHOD0(overhead_send,
                      size_t(void));
+        MOCK_METHOD2(sample_tolerance,
+                     void(int level, const std::vector<double> &tolerance));
         MOCK_METHOD1(broadcast_string,
                      void(const std::string &str));
         MOCK_METHOD0(broadcast_string,
@@ -47,13 +47,18 @@ class MockTreeCommLevel : public geopm::ITreeCommLevel {
         MOCK_METHOD1(send_up,
                      void(const std::vector<double> &sample));
         MOCK_METHOD1(send_down,
-                     void(const std::vector<std::vector<double> > &policy));
+                     void(const geopm::MessageMatrix &policy));
         MOCK_METHOD1(receive_up,
-                     bool(std::vector<std::vector<double> > &sample));
+                     bool(geopm::MessageMatrix &sample));
+        MOCK_METHOD2(receive_up_aggregate,
+                     bool(const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                          std::vector<double> &sample));
         MOCK_METHOD1(receive_down,
                      bool(std::vector<double> &policy));
         MOCK_CONST_METHOD0(overhead_send,
                      size_t(void));
+        MOCK_METHOD1(sample_tolerance,
+                     void(const std::vector<double> &tolerance));
 };
 
 #endif
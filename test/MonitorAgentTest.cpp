@@ -30,6 +30,8 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
@@ -43,6 +45,7 @@ using geopm::IPlatformIO;
 using geopm::MonitorAgent;
 using ::testing::_;
 using ::testing::Return;
+using ::testing::SetArgReferee;
 
 class MonitorAgentTest : public ::testing::Test
 {
@@ -52,6 +55,7 @@ class MonitorAgentTest : public ::testing::Test
             M_POWER_PACKAGE,
             M_FREQUENCY,
         };
+        static const int M_SAMPLE_GROUP = 3;
         MonitorAgentTest();
         void SetUp();
         MockPlatformIO m_platform_io;
@@ -78,6 +82,9 @@ void MonitorAgentTest::SetUp()
 
     EXPECT_CALL(m_platform_io, push_signal("POWER_PACKAGE", _, _));
     EXPECT_CALL(m_platform_io, push_signal("FREQUENCY", _, _));
+    std::vector<int> sample_idx {M_POWER_PACKAGE, M_FREQUENCY};
+    EXPECT_CALL(m_platform_io, push_signal_group(sample_idx))
+        .WillOnce(Return(M_SAMPLE_GROUP));
 
     // does not necessarily match PlatformIO, but Agent should call
     // these and use whatever function is returned
@@ -100,10 +107,8 @@ TEST_F(MonitorAgentTest, fixed_signal_list)
 TEST_F(MonitorAgentTest, sample_platform)
 {
     std::vector<double> expected_value {456, 789};
-    EXPECT_CALL(m_platform_io, sample(M_POWER_PACKAGE))
-        .WillOnce(Return(expected_value[0]));
-    EXPECT_CALL(m_platform_io, sample(M_FREQUENCY))
-        .WillOnce(Return(expected_value[1]));
+    EXPECT_CALL(m_platform_io, sample_group(M_SAMPLE_GROUP, _))
+        .WillOnce(SetArgReferee<1>(expected_value));
 
     std::vector<double> result(expected_value.size());
     m_agent->sample_platform(result);
@@ -132,3 +137,17 @@ TEST_F(MonitorAgentTest, ascend_aggregates_signals)
 
     EXPECT_EQ(expected, result);
 }
+
+TEST_F(MonitorAgentTest, sample_tolerance)
+{
+    std::vector<double> tolerance = m_agent->sample_tolerance();
+    std::vector<std::string> names = m_agent->sample_names();
+    ASSERT_EQ(names.size(), tolerance.size());
+    for (auto tol : tolerance) {
+        EXPECT_LT(0.0, tol);
+    }
+    // each tolerance is at the index of its sample
+    auto power_it = std::find(names.begin(), names.end(), "POWER_PACKAGE");
+    ASSERT_NE(names.end(), power_it);
+    EXPECT_DOUBLE_EQ(0.5, tolerance[power_it - names.begin()]);
+}
@@ -384,6 +384,43 @@ TEST_F(PlatformIOTest, sample)
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample(10), GEOPM_ERROR_INVALID, "signal_idx out of range");
 }
 
+TEST_F(PlatformIOTest, sample_group)
+{
+    for (auto &it : m_iogroup_ptr) {
+        if (it->is_valid_signal("FREQ")) {
+            EXPECT_CALL(*it, sample(0)).Times(2).WillRepeatedly(Return(2e9));
+            EXPECT_CALL(*it, push_signal(_, _, _));
+            EXPECT_CALL(*it, signal_domain_type("FREQ"));
+        }
+        if (it->is_valid_signal("TIME")) {
+            EXPECT_CALL(*it, sample(0)).Times(2).WillRepeatedly(Return(1.0));
+            EXPECT_CALL(*it, push_signal(_, _, _));
+            EXPECT_CALL(*it, signal_domain_type("TIME"));
+        }
+        EXPECT_CALL(*it, read_batch());
+    }
+    int freq_idx = m_platio->push_signal("FREQ", IPlatformTopo::M_DOMAIN_CPU, 0);
+    int time_idx = m_platio->push_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
+    int group_idx = m_platio->push_signal_group({time_idx, freq_idx});
+    EXPECT_EQ(0, group_idx);
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->push_signal_group({time_idx, 10}),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+    std::vector<double> value;
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_group(group_idx, value),
+                               GEOPM_ERROR_RUNTIME, "read_batch() not called");
+    m_platio->read_batch();
+    m_platio->sample_group(group_idx, value);
+    std::vector<double> expected {1.0, 2e9};
+    EXPECT_EQ(expected, value);
+    m_platio->sample({freq_idx, time_idx}, value);
+    expected = {2e9, 1.0};
+    EXPECT_EQ(expected, value);
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_group(1, value),
+                               GEOPM_ERROR_INVALID, "group_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample({-1, freq_idx}, value),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+}
+
 TEST_F(PlatformIOTest, sample_region_total)
 {
     // expectations for push
@@ -460,6 +497,16 @@ TEST_F(PlatformIOTest, sample_region_total)
     }
 }
 
+TEST_F(PlatformIOTest, sample_region_total_invalid)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->push_region_signal_total(-1, IPlatformTopo::M_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->push_region_signal_total(0, IPlatformTopo::M_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_region_total(0, 0x444),
+                               GEOPM_ERROR_INVALID, "not pushed with push_region_signal_total()");
+}
+
 TEST_F(PlatformIOTest, adjust)
 {
     for (auto &it : m_iogroup_ptr) {
@@ -477,6 +524,48 @@ TEST_F(PlatformIOTest, adjust)
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust(10, 0.0), GEOPM_ERROR_INVALID, "control_idx out of range");
 }
 
+TEST_F(PlatformIOTest, adjust_vector)
+{
+    for (auto &it : m_iogroup_ptr) {
+        if (it->is_valid_control("FREQ")) {
+            EXPECT_CALL(*it, push_control("FREQ", _, _));
+            EXPECT_CALL(*it, adjust(0, 3e9));
+        }
+        EXPECT_CALL(*it, write_batch());
+    }
+    int freq_idx = m_platio->push_control("FREQ", IPlatformTopo::M_DOMAIN_CPU, 0);
+    m_platio->adjust(std::vector<int>{freq_idx}, std::vector<double>{3e9});
+    m_platio->write_batch();
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust(std::vector<int>{freq_idx}, std::vector<double>{}),
+                               GEOPM_ERROR_INVALID, "not the same length");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust(std::vector<int>{10}, std::vector<double>{0.0}),
+                               GEOPM_ERROR_INVALID, "control_idx out of range");
+}
+
+TEST_F(PlatformIOTest, adjust_group)
+{
+    for (auto &it : m_iogroup_ptr) {
+        if (it->is_valid_control("FREQ")) {
+            EXPECT_CALL(*it, push_control("FREQ", _, _));
+            EXPECT_CALL(*it, adjust(0, 3e9));
+        }
+        EXPECT_CALL(*it, write_batch());
+    }
+    int freq_idx = m_platio->push_control("FREQ", IPlatformTopo::M_DOMAIN_CPU, 0);
+    int group_idx = m_platio->push_control_group({freq_idx});
+    EXPECT_EQ(0, group_idx);
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->push_control_group({freq_idx, 10}),
+                               GEOPM_ERROR_INVALID, "control_idx out of range");
+    m_platio->adjust_group(group_idx, {3e9});
+    m_platio->write_batch();
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust_group(group_idx, {}),
+                               GEOPM_ERROR_INVALID, "does not match the size of the group");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust_group(group_idx, {NAN}),
+                               GEOPM_ERROR_INVALID, "setting is NAN");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust_group(1, {3e9}),
+                               GEOPM_ERROR_INVALID, "group_idx out of range");
+}
+
 TEST_F(PlatformIOTest, read_signal)
 {
     for (auto &it : m_iogroup_ptr) {
@@ -31,9 +31,12 @@
  */
 
 #include <unistd.h>
+#include <sys/stat.h>
 #include <fstream>
+#include <sstream>
 #include "gtest/gtest.h"
 
+#include "geopm_hash.h"
 #include "PlatformTopo.hpp"
 #include "Exception.hpp"
 
@@ -390,6 +393,125 @@ TEST_F(PlatformTopoTest, bdx_is_domain_within)
     EXPECT_TRUE(topo.is_domain_within(IPlatformTopo::M_DOMAIN_PACKAGE_MEMORY, IPlatformTopo::M_DOMAIN_PACKAGE));
 }
 
+static void write_sysfs(const std::string &path, const std::string &value)
+{
+    std::string dir_path;
+    std::istringstream path_stream(path.substr(0, path.rfind('/')));
+    std::string dir_name;
+    while (std::getline(path_stream, dir_name, '/')) {
+        dir_path += dir_name + "/";
+        (void)mkdir(dir_path.c_str(), 0755);
+    }
+    std::ofstream sysfs_file(path);
+    sysfs_file << value << "\n";
+}
+
+TEST_F(PlatformTopoTest, sysfs_parse)
+{
+    // 2 packages, 2 cores per package, 2 threads per core with
+    // Linux enumeration and a memory only NUMA node.
+    const std::string sysfs_path = "PlatformTopoTest-sysfs";
+    write_sysfs(sysfs_path + "/cpu/online", "0-7");
+    for (int cpu_idx = 0; cpu_idx < 8; ++cpu_idx) {
+        std::string topo_path = sysfs_path + "/cpu/cpu" + std::to_string(cpu_idx) + "/topology/";
+        int core_idx = cpu_idx % 4;
+        write_sysfs(topo_path + "physical_package_id", std::to_string(core_idx / 2));
+        write_sysfs(topo_path + "thread_siblings_list",
+                    std::to_string(core_idx) + "," + std::to_string(core_idx + 4));
+    }
+    write_sysfs(sysfs_path + "/node/online", "0-2");
+    write_sysfs(sysfs_path + "/node/node0/cpulist", "0-1,4-5");
+    write_sysfs(sysfs_path + "/node/node1/cpulist", "2-3,6-7");
+    write_sysfs(sysfs_path + "/node/node2/cpulist", "");
+
+    std::string lscpu_str = PlatformTopo::sysfs_lscpu(sysfs_path);
+    std::string expected =
+        "CPU(s):                8\n"
+        "On-line CPU(s) mask:   0xff\n"
+        "Thread(s) per core:    2\n"
+        "Core(s) per socket:    2\n"
+        "Socket(s):             2\n"
+        "NUMA node(s):          3\n"
+        "NUMA node0 CPU(s):     0x33\n"
+        "NUMA node1 CPU(s):     0xcc\n"
+        "NUMA node2 CPU(s):     0x0\n";
+    EXPECT_EQ(expected, lscpu_str);
+    write_lscpu(lscpu_str);
+    PlatformTopo topo(m_lscpu_file_name);
+    EXPECT_EQ(2, topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE));
+    EXPECT_EQ(4, topo.num_domain(IPlatformTopo::M_DOMAIN_CORE));
+    EXPECT_EQ(8, topo.num_domain(IPlatformTopo::M_DOMAIN_CPU));
+    EXPECT_EQ(2, topo.num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY));
+    EXPECT_EQ(1, topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE_MEMORY));
+    EXPECT_EQ(1, topo.domain_idx(IPlatformTopo::M_DOMAIN_BOARD_MEMORY, 6));
+
+    // CPU 7 offline and no NUMA support in the kernel
+    write_sysfs(sysfs_path + "/cpu/online", "0-6");
+    write_sysfs(sysfs_path + "/cpu/cpu3/topology/thread_siblings_list", "3");
+    (void)unlink((sysfs_path + "/node/online").c_str());
+    lscpu_str = PlatformTopo::sysfs_lscpu(sysfs_path);
+    EXPECT_NE(std::string::npos, lscpu_str.find("CPU(s):                7\n"));
+    EXPECT_NE(std::string::npos, lscpu_str.find("On-line CPU(s) mask:   0x7f\n"));
+    EXPECT_NE(std::string::npos, lscpu_str.find("NUMA node(s):          1\n"));
+    EXPECT_NE(std::string::npos, lscpu_str.find("NUMA node0 CPU(s):     0x7f\n"));
+
+    write_sysfs(sysfs_path + "/cpu/online", "0-x");
+    EXPECT_THROW(PlatformTopo::sysfs_lscpu(sysfs_path), Exception);
+    EXPECT_THROW(PlatformTopo::sysfs_lscpu("PlatformTopoTest-no-sysfs"), Exception);
+    int err = system(("rm -rf " + sysfs_path).c_str());
+    EXPECT_EQ(0, err);
+}
+
+TEST_F(PlatformTopoTest, cache)
+{
+    std::string cache_path = PlatformTopo::cache_path();
+    if (!cache_path.empty()) {
+        EXPECT_NE(std::string::npos, cache_path.find("-" + std::to_string(getuid()) + "-"));
+        // the name changes with the set of online CPUs
+        std::ifstream online_file("/sys/devices/system/cpu/online");
+        std::string online_cpu;
+        ASSERT_TRUE(std::getline(online_file, online_cpu));
+        std::ostringstream online_hash;
+        online_hash << "-" << std::hex << geopm_crc32_str(0, online_cpu.c_str());
+        EXPECT_EQ(cache_path.size() - online_hash.str().size(), cache_path.rfind(online_hash.str()));
+    }
+    cache_path = "PlatformTopoTest-cache";
+    unlink(cache_path.c_str());
+    std::string sysfs_str;
+    try {
+        sysfs_str = PlatformTopo::sysfs_lscpu("/sys/devices/system");
+    }
+    catch (const Exception &ex) {
+        return;
+    }
+    PlatformTopo topo("", cache_path);
+    std::ifstream cache_file(cache_path);
+    ASSERT_TRUE(cache_file.good());
+    std::string cache_str((std::istreambuf_iterator<char>(cache_file)),
+                          std::istreambuf_iterator<char>());
+    cache_file.close();
+    EXPECT_EQ(sysfs_str, cache_str);
+
+    // later construction uses the cached copy
+    std::ofstream fake_cache(cache_path);
+    fake_cache << m_hsw_lscpu_str;
+    fake_cache.close();
+    chmod(cache_path.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    PlatformTopo topo_cached("", cache_path);
+    EXPECT_EQ(2, topo_cached.num_domain(IPlatformTopo::M_DOMAIN_CPU));
+
+    // a cache that others can modify is ignored and replaced
+    chmod(cache_path.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+    PlatformTopo topo_untrusted("", cache_path);
+    EXPECT_EQ(topo.num_domain(IPlatformTopo::M_DOMAIN_CPU),
+              topo_untrusted.num_domain(IPlatformTopo::M_DOMAIN_CPU));
+    cache_file.open(cache_path);
+    cache_str.assign((std::istreambuf_iterator<char>(cache_file)),
+                     std::istreambuf_iterator<char>());
+    EXPECT_EQ(sysfs_str, cache_str);
+    unlink(cache_path.c_str());
+}
+
 TEST_F(PlatformTopoTest, parse_error)
 {
     std::string lscpu_missing_cpu =
@@ -31,9 +31,15 @@
  */
 
 #include <stdlib.h>
+
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "Exception.hpp"
 #include "ProfileTable.hpp"
+#include "ProfileNameArena.hpp"
+#include "Helper.hpp"
 
 class ProfileTableTest: public :: testing :: Test
 {
@@ -279,3 +285,251 @@ TEST_F(ProfileTableTest, name_set_fill_long)
     ASSERT_EQ(input_set, output_set);
     ASSERT_LT(1, count);
 }
+
+TEST_F(ProfileTableTest, ring_insert_dump)
+{
+    geopm::ProfileRingTable table(m_size, (void *)m_ptr);
+    EXPECT_THROW(geopm::ProfileRingTable(0, NULL), geopm::Exception);
+    uint64_t tmp[4];
+    EXPECT_THROW(geopm::ProfileRingTable(sizeof(tmp), tmp), geopm::Exception);
+    size_t capacity = table.capacity();
+    EXPECT_LT(0ULL, capacity);
+    EXPECT_EQ(0ULL, capacity & (capacity - 1));
+    struct geopm_prof_message_s insert_message;
+    EXPECT_THROW(table.insert(0, insert_message), geopm::Exception);
+    insert_message.progress = 0.0;
+    table.insert(1234, insert_message);
+    insert_message.progress = 0.5;
+    table.insert(1234, insert_message);
+    insert_message.progress = 1.0;
+    table.insert(1234, insert_message);
+    EXPECT_EQ(3ULL, table.size());
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(capacity);
+    size_t length;
+    table.dump(contents.begin(), length);
+    ASSERT_EQ(3ULL, length);
+    EXPECT_EQ(0ULL, table.size());
+    std::vector<double> expect_progress {0.0, 0.5, 1.0};
+    for (size_t i = 0; i < length; ++i) {
+        EXPECT_EQ(1234ULL, contents[i].first);
+        EXPECT_EQ(expect_progress[i], contents[i].second.progress);
+    }
+    // Wrap around the end of the ring several times.
+    for (size_t loop = 0; loop < 3; ++loop) {
+        for (size_t i = 1; i < capacity; ++i) {
+            insert_message.progress = (double)i;
+            table.insert(i, insert_message);
+        }
+        table.dump(contents.begin(), length);
+        ASSERT_EQ(capacity - 1, length);
+        for (size_t i = 0; i < length; ++i) {
+            EXPECT_EQ(i + 1, contents[i].first);
+            EXPECT_EQ((double)(i + 1), contents[i].second.progress);
+        }
+    }
+    EXPECT_EQ(0ULL, table.num_drop());
+}
+
+TEST_F(ProfileTableTest, ring_overflow_drop)
+{
+    geopm::ProfileRingTable table(m_small_size, (void *)m_small_ptr);
+    struct geopm_prof_message_s insert_message;
+    size_t capacity = table.capacity();
+    size_t num_extra = 5;
+    for (size_t i = 1; i <= capacity + num_extra; ++i) {
+        insert_message.progress = (double)i;
+        EXPECT_NO_THROW(table.insert(i, insert_message));
+    }
+    EXPECT_EQ(capacity, table.size());
+    EXPECT_EQ(num_extra, table.num_drop());
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(capacity);
+    size_t length;
+    table.dump(contents.begin(), length);
+    ASSERT_EQ(capacity, length);
+    EXPECT_EQ(1ULL, contents.front().first);
+    EXPECT_EQ(capacity, contents.back().first);
+    // Space is available again after the consumer drains the ring.
+    table.insert(42, insert_message);
+    EXPECT_EQ(1ULL, table.size());
+    EXPECT_EQ(num_extra, table.num_drop());
+    EXPECT_EQ(0ULL, m_table->num_drop());
+}
+
+TEST_F(ProfileTableTest, ring_multi_producer)
+{
+    const size_t num_entry = geopm::ProfileRingTable::M_DEFAULT_RING_LENGTH;
+    std::vector<char> buffer(geopm::ProfileRingTable::buffer_size(num_entry));
+    geopm::ProfileRingTable table(buffer.size(), buffer.data());
+    ASSERT_EQ(num_entry, table.capacity());
+    const int num_thread = 4;
+    const int num_insert = num_entry / num_thread;
+    std::vector<std::thread> producer;
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        producer.emplace_back([&table, thread_idx, num_insert] () {
+            struct geopm_prof_message_s insert_message {};
+            for (int i = 0; i < num_insert; ++i) {
+                insert_message.progress = (double)i;
+                table.insert(thread_idx + 1, insert_message);
+            }
+        });
+    }
+    for (auto &thread : producer) {
+        thread.join();
+    }
+    EXPECT_EQ(0ULL, table.num_drop());
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(num_entry);
+    size_t length;
+    table.dump(contents.begin(), length);
+    ASSERT_EQ((size_t)(num_thread * num_insert), length);
+    // Every message is delivered once, in order for each producer.
+    std::vector<double> next_progress(num_thread, 0.0);
+    for (size_t i = 0; i < length; ++i) {
+        uint64_t key = contents[i].first;
+        ASSERT_LE(1ULL, key);
+        ASSERT_GE((uint64_t)num_thread, key);
+        EXPECT_EQ(next_progress[key - 1], contents[i].second.progress);
+        next_progress[key - 1] += 1.0;
+    }
+}
+
+TEST_F(ProfileTableTest, ring_name_set_fill)
+{
+    geopm::ProfileRingTable table(m_size, (void *)m_ptr);
+    std::set<std::string> input_set = {"hello", "goodbye"};
+    std::set<std::string> output_set;
+    for (auto it = input_set.begin(); it != input_set.end(); ++it) {
+        EXPECT_EQ(m_table->key(*it), table.key(*it));
+    }
+    bool is_in_done = table.name_fill(0);
+    bool is_out_done = table.name_set(0, output_set);
+    ASSERT_EQ(input_set, output_set);
+    ASSERT_EQ(is_in_done, is_out_done);
+}
+
+TEST_F(ProfileTableTest, ring_name_fill_insert)
+{
+    geopm::ProfileRingTable producer(m_small_size, (void *)m_small_ptr, true);
+    geopm::ProfileRingTable consumer(m_small_size, (void *)m_small_ptr, false);
+    EXPECT_LT(0ULL, producer.name_offset());
+    EXPECT_EQ(producer.name_offset(), consumer.name_offset());
+    EXPECT_EQ(0ULL, m_table->name_offset());
+    size_t capacity = producer.capacity();
+    size_t num_extra = 3;
+    struct geopm_prof_message_s insert_message {};
+    for (size_t i = 1; i <= capacity + num_extra; ++i) {
+        producer.insert(i, insert_message);
+    }
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(capacity);
+    size_t length;
+    consumer.dump(contents.begin(), length);
+    ASSERT_EQ(capacity, length);
+    // Pass enough names to cover the ring entries several times.
+    std::set<std::string> input_set;
+    std::set<std::string> output_set;
+    for (int i = 0; i < 1000; ++i) {
+        std::string name = "region_name_" + std::to_string(i);
+        input_set.insert(name);
+        producer.key(name);
+    }
+    bool is_in_done = false;
+    bool is_out_done = false;
+    while (!is_in_done) {
+        is_in_done = producer.name_fill(0);
+        is_out_done = consumer.name_set(0, output_set);
+        ASSERT_EQ(is_in_done, is_out_done);
+    }
+    EXPECT_EQ(input_set, output_set);
+    // The drop count and the ring indices are intact.
+    EXPECT_EQ(num_extra, consumer.num_drop());
+    EXPECT_EQ(0ULL, consumer.size());
+    for (size_t i = 1; i <= capacity; ++i) {
+        insert_message.progress = (double)i;
+        producer.insert(i, insert_message);
+    }
+    EXPECT_EQ(num_extra, consumer.num_drop());
+    consumer.dump(contents.begin(), length);
+    ASSERT_EQ(capacity, length);
+    for (size_t i = 0; i < length; ++i) {
+        EXPECT_EQ(i + 1, contents[i].first);
+        EXPECT_EQ((double)(i + 1), contents[i].second.progress);
+    }
+}
+
+TEST_F(ProfileTableTest, ring_consumer_attach)
+{
+    geopm::ProfileRingTable producer(m_size, (void *)m_ptr, true);
+    struct geopm_prof_message_s insert_message {};
+    producer.insert(1234, insert_message);
+    producer.insert(5678, insert_message);
+    // A consumer attaching after inserts have started does not reset
+    // the ring.
+    geopm::ProfileRingTable consumer(m_size, (void *)m_ptr, false);
+    EXPECT_EQ(2ULL, consumer.size());
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(consumer.capacity());
+    size_t length;
+    consumer.dump(contents.begin(), length);
+    ASSERT_EQ(2ULL, length);
+    EXPECT_EQ(1234ULL, contents[0].first);
+    EXPECT_EQ(5678ULL, contents[1].first);
+}
+
+TEST_F(ProfileTableTest, name_arena)
+{
+    uint64_t tmp[2] = {};
+    EXPECT_THROW(geopm::ProfileNameArena(sizeof(tmp), tmp), geopm::Exception);
+    EXPECT_THROW(geopm::ProfileNameArena(1024, NULL), geopm::Exception);
+
+    // Zero filled buffer is an empty arena.
+    std::vector<uint64_t> buffer(16, 0);
+    size_t buffer_size = buffer.size() * sizeof(uint64_t);
+    geopm::ProfileNameArena producer(buffer_size, buffer.data());
+    geopm::ProfileNameArena consumer(buffer_size, buffer.data());
+    std::set<std::string> output_set;
+    consumer.name_set(output_set);
+    EXPECT_TRUE(output_set.empty());
+    EXPECT_EQ(0ULL, consumer.num_name());
+
+    EXPECT_TRUE(producer.insert(1, "hello"));
+    EXPECT_TRUE(producer.insert(2, "goodbye"));
+    consumer.name_set(output_set);
+    std::set<std::string> expected_set = {"hello", "goodbye"};
+    EXPECT_EQ(expected_set, output_set);
+    EXPECT_EQ(2ULL, consumer.num_name());
+    EXPECT_FALSE(consumer.is_overflow());
+
+    // 104 byte data region holds two 24 byte records and 56 bytes remain
+    EXPECT_FALSE(producer.insert(3, "a region name that is too long to fit in the arena"));
+    EXPECT_TRUE(consumer.is_overflow());
+    EXPECT_FALSE(producer.insert(4, "tiny"));
+    output_set.clear();
+    consumer.name_set(output_set);
+    EXPECT_EQ(expected_set, output_set);
+
+    // Corrupt size in the header.
+    buffer[0] = buffer_size;
+    EXPECT_THROW(consumer.name_set(output_set), geopm::Exception);
+}
+
+TEST_F(ProfileTableTest, name_arena_fill)
+{
+    std::vector<uint64_t> buffer(8, 0);
+    geopm::ProfileNameArena consumer(buffer.size() * sizeof(uint64_t), buffer.data());
+    m_table->name_arena(geopm::make_unique<geopm::ProfileNameArena>(buffer.size() * sizeof(uint64_t), buffer.data()));
+    // Only the first name fits in the arena, the rest are passed
+    // through the table buffer.
+    std::set<std::string> input_set = {"arena", "fill_0", "fill_1"};
+    for (auto it = input_set.begin(); it != input_set.end(); ++it) {
+        m_table->key(*it);
+    }
+    EXPECT_EQ(1ULL, consumer.num_name());
+    EXPECT_TRUE(consumer.is_overflow());
+    std::set<std::string> output_set;
+    bool is_in_done = m_table->name_fill(0);
+    bool is_out_done = m_table->name_set(0, output_set);
+    ASSERT_TRUE(is_in_done);
+    ASSERT_TRUE(is_out_done);
+    std::set<std::string> expected_set = {"fill_0", "fill_1"};
+    EXPECT_EQ(expected_set, output_set);
+    consumer.name_set(output_set);
+    EXPECT_EQ(input_set, output_set);
+}
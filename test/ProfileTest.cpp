@@ -30,9 +30,13 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <map>
+#include <algorithm>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "geopm_env.h"
+#include "geopm_message.h"
 #include "Helper.hpp"
 #include "Profile.hpp"
 #include "Exception.hpp"
@@ -238,6 +242,44 @@ TEST_F(ProfileTest, region)
     }
 }
 
+TEST_F(ProfileTest, region_cache)
+{
+    int shm_rank = 0;
+    int world_rank = 0;
+    std::map<std::string, int> num_key;
+    auto key_lambda = [this, &num_key] (const std::string &name)
+    {
+        ++num_key[name];
+        auto it = std::find(m_region_names.begin(), m_region_names.end(), name);
+        EXPECT_NE(m_region_names.end(), it);
+        return m_expected_rid[it - m_region_names.begin()];
+    };
+    auto insert_lambda = [] (uint64_t key, const struct geopm_prof_message_s &value)
+    {
+    };
+    m_table = geopm::make_unique<ProfileTestProfileTable>(key_lambda, insert_lambda);
+    m_tprof = geopm::make_unique<ProfileTestProfileThreadTable>(M_NUM_CPU);
+    m_ctl_msg = geopm::make_unique<ProfileTestControlMessage>();
+    m_shm_comm = std::make_shared<ProfileTestComm>(shm_rank, M_SHM_COMM_SIZE);
+    m_world_comm = geopm::make_unique<ProfileTestComm>(world_rank, m_shm_comm);
+
+    m_profile = geopm::make_unique<Profile>(M_PROF_NAME, M_SHM_KEY, std::move(m_world_comm),
+                                            std::move(m_ctl_msg), m_topo, std::move(m_table),
+                                            std::move(m_tprof), std::move(m_scheduler));
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        for (size_t idx = 0; idx < m_region_names.size(); ++idx) {
+            uint64_t rid = m_profile->region(m_region_names[idx].c_str(), GEOPM_REGION_HINT_COMPUTE);
+            EXPECT_EQ(geopm_region_id_set_hint(GEOPM_REGION_HINT_COMPUTE, m_expected_rid[idx]), rid);
+            rid = m_profile->region(m_region_names[idx], GEOPM_REGION_HINT_MEMORY);
+            EXPECT_EQ(geopm_region_id_set_hint(GEOPM_REGION_HINT_MEMORY, m_expected_rid[idx]), rid);
+        }
+    }
+    // Each name is resolved through the ProfileTable only once.
+    for (const auto &name : m_region_names) {
+        EXPECT_EQ(1, num_key[name]);
+    }
+}
+
 TEST_F(ProfileTest, enter_exit)
 {
     int shm_rank = 0;
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "geopm_message.h"
+#include "RegionIdCache.hpp"
+
+using geopm::RegionIdCache;
+
+TEST(RegionIdCacheTest, cached)
+{
+    RegionIdCache cache(64, 4);
+    int num_resolve = 0;
+    auto resolve = [&num_resolve](int slot_idx)
+    {
+        ++num_resolve;
+        EXPECT_LE(0, slot_idx);
+        return (uint64_t)0x1234;
+    };
+    auto is_match = [](int slot_idx) {return true;};
+    EXPECT_EQ(0x1234ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(0x1234ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(1, num_resolve);
+}
+
+TEST(RegionIdCacheTest, concurrent_lookup)
+{
+    RegionIdCache cache(64, 4);
+    const int num_thread = 8;
+    const int num_lookup = 1000;
+    std::atomic<int> num_resolve(0);
+    std::vector<std::thread> lookup;
+    std::vector<int> num_wrong(num_thread, 0);
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        lookup.emplace_back([&cache, &num_resolve, &num_wrong, thread_idx, num_lookup] () {
+            for (int i = 0; i < num_lookup; ++i) {
+                // Every thread looks up the same function.
+                uint64_t region_id = cache.region_id(42,
+                    [&num_resolve](int slot_idx)
+                    {
+                        ++num_resolve;
+                        std::this_thread::yield();
+                        return (uint64_t)0x1234;
+                    },
+                    [](int slot_idx) {return true;});
+                if (region_id != 0x1234) {
+                    ++num_wrong[thread_idx];
+                }
+            }
+        });
+    }
+    for (auto &thread : lookup) {
+        thread.join();
+    }
+    // Threads that race with the registration resolve directly
+    // rather than seeing an undefined region ID.
+    EXPECT_EQ(std::vector<int>(num_thread, 0), num_wrong);
+    EXPECT_LE(1, num_resolve.load());
+    EXPECT_GT(num_thread * num_lookup, num_resolve.load());
+    int num_resolve_end = num_resolve.load();
+    EXPECT_EQ(0x1234ULL, cache.region_id(42,
+                                         [&num_resolve](int slot_idx)
+                                         {
+                                             ++num_resolve;
+                                             return (uint64_t)0x1234;
+                                         },
+                                         [](int slot_idx) {return true;}));
+    EXPECT_EQ(num_resolve_end, num_resolve.load());
+}
+
+TEST(RegionIdCacheTest, failed_lookup)
+{
+    RegionIdCache cache(64, 4);
+    uint64_t next_result = GEOPM_REGION_ID_UNDEFINED;
+    int num_resolve = 0;
+    auto resolve = [&num_resolve, &next_result](int slot_idx)
+    {
+        ++num_resolve;
+        // Every resolution is made with a claimed slot.
+        EXPECT_LE(0, slot_idx);
+        return next_result;
+    };
+    auto is_match = [](int slot_idx) {return true;};
+    EXPECT_EQ(GEOPM_REGION_ID_UNDEFINED, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(1, num_resolve);
+    next_result = 0;
+    EXPECT_EQ(0ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(2, num_resolve);
+    // A failed lookup is not cached and the slot is claimed again.
+    next_result = 0x1234;
+    EXPECT_EQ(0x1234ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(3, num_resolve);
+    EXPECT_EQ(0x1234ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(3, num_resolve);
+}
+
+TEST(RegionIdCacheTest, resolve_throw)
+{
+    RegionIdCache cache(64, 4);
+    bool is_throw = true;
+    int num_resolve = 0;
+    auto resolve = [&num_resolve, &is_throw](int slot_idx)
+    {
+        ++num_resolve;
+        EXPECT_LE(0, slot_idx);
+        if (is_throw) {
+            throw std::runtime_error("table full");
+        }
+        return (uint64_t)0x1234;
+    };
+    auto is_match = [](int slot_idx) {return true;};
+    EXPECT_THROW(cache.region_id(42, resolve, is_match), std::runtime_error);
+    EXPECT_EQ(1, num_resolve);
+    // The slot was released, so the retry is resolved and cached.
+    is_throw = false;
+    EXPECT_EQ(0x1234ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(2, num_resolve);
+    EXPECT_EQ(0x1234ULL, cache.region_id(42, resolve, is_match));
+    EXPECT_EQ(2, num_resolve);
+}
+
+TEST(RegionIdCacheTest, collision)
+{
+    RegionIdCache cache(64, 4);
+    std::vector<std::string> slot_name(64);
+    auto lookup = [&cache, &slot_name](const std::string &name, uint64_t region_id)
+    {
+        // Both names use the same key.
+        return cache.region_id(42,
+                               [&slot_name, &name, region_id](int slot_idx)
+                               {
+                                   if (slot_idx >= 0) {
+                                       slot_name[slot_idx] = name;
+                                   }
+                                   return region_id;
+                               },
+                               [&slot_name, &name](int slot_idx)
+                               {
+                                   return slot_name[slot_idx] == name;
+                               });
+    };
+    EXPECT_EQ(0x1ULL, lookup("first", 0x1));
+    EXPECT_EQ(0x2ULL, lookup("second", 0x2));
+    EXPECT_EQ(0x1ULL, lookup("first", 0x3));
+    EXPECT_EQ(0x2ULL, lookup("second", 0x4));
+}
+
+TEST(RegionIdCacheTest, full)
+{
+    RegionIdCache cache(64, 2);
+    int num_uncached = 0;
+    for (int idx = 0; idx < 3; ++idx) {
+        cache.region_id(42,
+                        [&num_uncached, idx](int slot_idx)
+                        {
+                            if (slot_idx < 0) {
+                                ++num_uncached;
+                            }
+                            return (uint64_t)(idx + 1);
+                        },
+                        [](int slot_idx) {return false;});
+    }
+    // Only two slots are searched, so the third lookup is not cached.
+    EXPECT_EQ(1, num_uncached);
+    // A key of zero is never cached.
+    EXPECT_EQ(0x5ULL, cache.region_id(0,
+                                      [](int slot_idx)
+                                      {
+                                          EXPECT_EQ(-1, slot_idx);
+                                          return (uint64_t)0x5;
+                                      },
+                                      [](int slot_idx) {return true;}));
+}
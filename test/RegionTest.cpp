@@ -31,6 +31,9 @@
  */
 
 #include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
 
 #include "gtest/gtest.h"
 #include "geopm_error.h"
@@ -379,7 +382,7 @@ TEST_F(RegionTest, signal_invalid_entry)
     EXPECT_DOUBLE_EQ(4.0, m_leaf_region->median(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
     EXPECT_DOUBLE_EQ(9.0, m_leaf_region->median(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
     EXPECT_DOUBLE_EQ(1.707825127659933, m_leaf_region->std_deviation(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
-    EXPECT_DOUBLE_EQ(1.7078251276599345, m_leaf_region->std_deviation(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    EXPECT_DOUBLE_EQ(1.707825127659933, m_leaf_region->std_deviation(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
     EXPECT_DOUBLE_EQ(1.0, m_leaf_region->min(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
     EXPECT_DOUBLE_EQ(6.0, m_leaf_region->min(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
     EXPECT_DOUBLE_EQ(6.0, m_leaf_region->max(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
@@ -416,6 +419,87 @@ TEST_F(RegionTest, signal_invalid_entry)
 
 }
 
+TEST_F(RegionTest, signal_invalid_runtime)
+{
+    std::vector<struct geopm_telemetry_message_s> telemetry(2);
+    telemetry[0].region_id = 42;
+    telemetry[1].region_id = 42;
+    geopm_time(&telemetry[0].timestamp);
+    telemetry[1].timestamp = telemetry[0].timestamp;
+    // Only the runtime and progress of this sample are invalid
+    for (int j = 0; j < GEOPM_NUM_TELEMETRY_TYPE; j++) {
+        telemetry[0].signal[j] = 20.0;
+        telemetry[1].signal[j] = 25.0;
+    }
+    telemetry[0].signal[GEOPM_TELEMETRY_TYPE_RUNTIME] = -1.0;
+    telemetry[1].signal[GEOPM_TELEMETRY_TYPE_RUNTIME] = -1.0;
+    m_leaf_region->insert(telemetry);
+    EXPECT_EQ(8, m_leaf_region->num_sample(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_EQ(8, m_leaf_region->num_sample(1, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_EQ(7, m_leaf_region->num_sample(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    EXPECT_EQ(7, m_leaf_region->num_sample(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    // The energy statistics include the sample
+    EXPECT_DOUBLE_EQ((21.0 + 20.0) / 8, m_leaf_region->mean(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ((56.0 + 25.0) / 8, m_leaf_region->mean(1, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(4.0, m_leaf_region->median(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(9.0, m_leaf_region->median(1, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(20.0, m_leaf_region->max(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(25.0, m_leaf_region->max(1, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    // The runtime statistics do not
+    EXPECT_DOUBLE_EQ(3.0, m_leaf_region->mean(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    EXPECT_DOUBLE_EQ(8.0, m_leaf_region->mean(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    EXPECT_DOUBLE_EQ(6.0, m_leaf_region->max(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    EXPECT_DOUBLE_EQ(11.0, m_leaf_region->max(1, GEOPM_TELEMETRY_TYPE_RUNTIME));
+
+    // A valid sample pushes the oldest sample out of the buffer
+    geopm_time(&telemetry[0].timestamp);
+    telemetry[1].timestamp = telemetry[0].timestamp;
+    for (int j = 0; j < GEOPM_NUM_TELEMETRY_TYPE; j++) {
+        telemetry[0].signal[j] = 7.0;
+        telemetry[1].signal[j] = 12.0;
+    }
+    m_leaf_region->insert(telemetry);
+    EXPECT_EQ(8, m_leaf_region->num_sample(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_EQ(7, m_leaf_region->num_sample(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+    EXPECT_DOUBLE_EQ((28.0 + 20.0) / 8, m_leaf_region->mean(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(5.0, m_leaf_region->median(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(1.0, m_leaf_region->min(0, GEOPM_TELEMETRY_TYPE_PKG_ENERGY));
+    EXPECT_DOUBLE_EQ(4.0, m_leaf_region->mean(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+}
+
+TEST_F(RegionTest, signal_window_unordered)
+{
+    geopm::Region region(42, 1, 0, NULL);
+    std::vector<struct geopm_telemetry_message_s> telemetry(1);
+    telemetry[0].region_id = 42;
+    std::vector<double> values = {5.0, 1.0, 9.0, 3.0, 3.0, 7.0, 2.0, 8.0, 6.0, 4.0, 0.0, 3.0, 10.0};
+    for (size_t idx = 0; idx < values.size(); ++idx) {
+        geopm_time(&telemetry[0].timestamp);
+        for (int j = 0; j < GEOPM_NUM_TELEMETRY_TYPE; j++) {
+            telemetry[0].signal[j] = values[idx];
+        }
+        region.insert(telemetry);
+        // Brute force statistics over the samples still in the window
+        size_t begin = idx + 1 > 8 ? idx + 1 - 8 : 0;
+        std::vector<double> window(values.begin() + begin, values.begin() + idx + 1);
+        double mean = std::accumulate(window.begin(), window.end(), 0.0) / window.size();
+        double ss = 0.0;
+        for (auto it = window.begin(); it != window.end(); ++it) {
+            ss += (*it - mean) * (*it - mean);
+        }
+        std::sort(window.begin(), window.end());
+        EXPECT_EQ((int)window.size(), region.num_sample(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+        EXPECT_DOUBLE_EQ(window[window.size() / 2], region.median(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+        EXPECT_DOUBLE_EQ(window.front(), region.min(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+        EXPECT_DOUBLE_EQ(window.back(), region.max(0, GEOPM_TELEMETRY_TYPE_RUNTIME));
+        EXPECT_NEAR(mean, region.mean(0, GEOPM_TELEMETRY_TYPE_RUNTIME), 1e-12);
+        EXPECT_NEAR(std::sqrt(ss / window.size()), region.std_deviation(0, GEOPM_TELEMETRY_TYPE_RUNTIME), 1e-12);
+    }
+    region.clear();
+    EXPECT_TRUE(std::isnan(region.median(0, GEOPM_TELEMETRY_TYPE_RUNTIME)));
+    EXPECT_TRUE(std::isnan(region.mean(0, GEOPM_TELEMETRY_TYPE_RUNTIME)));
+}
+
 TEST_F(RegionTest, negative_region_invalid)
 {
     int thrown = 0;
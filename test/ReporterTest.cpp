@@ -37,6 +37,7 @@
 #include "gmock/gmock.h"
 
 #include "Reporter.hpp"
+#include "Exception.hpp"
 #include "MockPlatformIO.hpp"
 #include "MockApplicationIO.hpp"
 #include "MockComm.hpp"
@@ -46,13 +47,15 @@
 #include "config.h"
 
 using geopm::Reporter;
+using geopm::Exception;
 using testing::HasSubstr;
 using testing::Return;
 using testing::_;
 using testing::SaveArg;
 using testing::SetArgPointee;
 
-// Mock for gathering reports; assumes one node only
+// Mock for gathering reports; assumes one node only unless
+// m_file_offset is set to the offsets broadcast by the root.
 class ReporterTestMockComm : public MockComm
 {
     public:
@@ -67,6 +70,14 @@ class ReporterTestMockComm : public MockComm
         {
             memcpy(recv_buf, send_buf, send_size);
         }
+        void broadcast(void *buffer, size_t size, int root) const override
+        {
+            if (!m_file_offset.empty() &&
+                size == m_file_offset.size() * sizeof(off_t)) {
+                memcpy(buffer, m_file_offset.data(), size);
+            }
+        }
+        std::vector<off_t> m_file_offset;
 };
 
 class ReporterTest : public testing::Test
@@ -80,6 +91,12 @@ class ReporterTest : public testing::Test
         };
         ReporterTest();
         void TearDown(void);
+        void expect_init(void);
+        /// Set the expectations for generate() and return the
+        /// expected report.
+        std::string expect_generate(void);
+        void generate(void);
+        void check_generate(void);
         std::string m_report_name = "test_reporter.out";
 
         MockPlatformIO m_platform_io;
@@ -137,7 +154,15 @@ ReporterTest::ReporterTest()
         .WillByDefault(Return(m_profile_name));
     ON_CALL(m_application_io, region_name_set())
         .WillByDefault(Return(m_region_set));
+    expect_init();
+
+    m_comm = std::make_shared<ReporterTestMockComm>();
+    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0);
+    m_reporter->init();
+}
 
+void ReporterTest::expect_init(void)
+{
     EXPECT_CALL(m_platform_io, push_signal("ENERGY_PACKAGE", _, _))
         .WillOnce(Return(M_ENERGY_PKG_IDX));
     EXPECT_CALL(m_platform_io, push_region_signal_total(M_ENERGY_PKG_IDX, _, _));
@@ -150,10 +175,6 @@ ReporterTest::ReporterTest()
     EXPECT_CALL(m_platform_io, push_signal("CYCLES_THREAD", _, _))
         .WillOnce(Return(M_CLK_CORE_IDX));
     EXPECT_CALL(m_platform_io, push_region_signal_total(M_CLK_CORE_IDX, _, _));
-
-    m_comm = std::make_shared<ReporterTestMockComm>();
-    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0);
-    m_reporter->init();
 }
 
 void ReporterTest::TearDown(void)
@@ -165,8 +186,112 @@ void check_report(std::istream &expected, std::istream &result);
 
 TEST_F(ReporterTest, generate)
 {
-    EXPECT_CALL(m_application_io, report_name()).WillOnce(Return(m_report_name));
+    check_generate();
+}
+
+TEST_F(ReporterTest, generate_parallel)
+{
+    expect_init();
+    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0, true);
+    m_reporter->init();
+    // every node opened the file and wrote its section
+    EXPECT_CALL(*m_comm, test(true)).Times(2).WillRepeatedly(Return(true));
+    check_generate();
+}
+
+TEST_F(ReporterTest, generate_parallel_fallback)
+{
+    // Another node can not open the report file: the report is
+    // gathered to the root instead.
+    expect_init();
+    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0, true);
+    m_reporter->init();
+    std::istringstream exp_stream(expect_generate());
+    EXPECT_CALL(m_application_io, profile_name());
+    EXPECT_CALL(*m_comm, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*m_comm, num_rank()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*m_comm, test(true)).WillOnce(Return(false));
+    generate();
+    std::ifstream report(m_report_name);
+    check_report(exp_stream, report);
+}
+
+TEST_F(ReporterTest, generate_parallel_offset)
+{
+    // Act as the second of two nodes.  The root has already written
+    // the header, and the section of the first node ends where this
+    // node's section begins.
+    expect_init();
+    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0, true);
+    m_reporter->init();
+    std::string expected = expect_generate();
+    // Each node section begins with an empty line.
+    size_t section_pos = expected.find("\nHost:");
+    ASSERT_NE(std::string::npos, section_pos);
+    std::string root_text = expected.substr(0, section_pos) + "\nHost: node0\n";
+    std::ofstream root_file(m_report_name);
+    root_file << root_text;
+    root_file.close();
+    m_comm->m_file_offset = {(off_t)section_pos, (off_t)root_text.size()};
+    EXPECT_CALL(*m_comm, rank()).WillOnce(Return(1));
+    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(2));
+    EXPECT_CALL(*m_comm, test(true)).Times(2).WillRepeatedly(Return(true));
+    generate();
+
+    std::ifstream report(m_report_name);
+    std::string root_result(root_text.size(), '\0');
+    report.read(&root_result[0], root_result.size());
+    EXPECT_EQ(root_text, root_result);
+    // The root writes the final newline after the last section.
+    std::istringstream exp_stream(expected.substr(section_pos, expected.size() - section_pos - 1));
+    check_report(exp_stream, report);
+}
+
+TEST_F(ReporterTest, generate_parallel_error)
+{
+    // Another node fails to write its section: this node throws
+    // too rather than waiting for it.
+    expect_init();
+    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0, true);
+    m_reporter->init();
+    expect_generate();
     EXPECT_CALL(m_application_io, profile_name());
+    EXPECT_CALL(*m_comm, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(1));
+    EXPECT_CALL(*m_comm, test(true))
+        .WillOnce(Return(true))
+        .WillOnce(Return(false));
+    EXPECT_CALL(*m_comm, barrier()).Times(0);
+    EXPECT_THROW(generate(), Exception);
+}
+
+void ReporterTest::check_generate(void)
+{
+    std::istringstream exp_stream(expect_generate());
+    EXPECT_CALL(m_application_io, profile_name());
+    EXPECT_CALL(*m_comm, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(1));
+    generate();
+    std::ifstream report(m_report_name);
+    check_report(exp_stream, report);
+}
+
+void ReporterTest::generate(void)
+{
+    std::vector<std::pair<std::string, std::string> >  agent_header {
+        {"one", "1"},
+        {"two", "2"} };
+    std::vector<std::pair<std::string, std::string> >  agent_node_report {
+        {"three", "3"},
+        {"four", "4"} };
+    m_reporter->generate("my_agent", agent_header, agent_node_report, m_region_agent_detail,
+                         m_application_io,
+                         m_comm, m_tree_comm);
+}
+
+std::string ReporterTest::expect_generate(void)
+{
+    EXPECT_CALL(m_application_io, report_name()).WillOnce(Return(m_report_name));
     EXPECT_CALL(m_application_io, region_name_set());
     EXPECT_CALL(m_application_io, total_app_runtime()).WillOnce(Return(56));
     EXPECT_CALL(m_application_io, total_app_energy()).WillOnce(Return(4444));
@@ -177,6 +302,7 @@ TEST_F(ReporterTest, generate)
     EXPECT_CALL(m_application_io, total_epoch_mpi_runtime()).WillOnce(Return(7.0));
     EXPECT_CALL(m_application_io, total_epoch_energy()).WillOnce(Return(8888));
     EXPECT_CALL(m_tree_comm, overhead_send()).WillOnce(Return(678 * 56));
+    EXPECT_CALL(m_application_io, total_profile_drop()).WillOnce(Return(3));
     for (auto rid : m_region_runtime) {
         EXPECT_CALL(m_application_io, total_region_runtime(rid.first))
             .WillOnce(Return(rid.second));
@@ -215,16 +341,6 @@ TEST_F(ReporterTest, generate)
                     sample_region_total(M_CLK_REF_IDX, geopm_region_id_set_mpi(rid.first)))
             .WillOnce(Return(rid.second));
     }
-    EXPECT_CALL(*m_comm, rank()).WillOnce(Return(0));
-    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(1));
-
-    std::vector<std::pair<std::string, std::string> >  agent_header {
-        {"one", "1"},
-        {"two", "2"} };
-    std::vector<std::pair<std::string, std::string> >  agent_node_report {
-        {"three", "3"},
-        {"four", "4"} };
-
     // Check for labels at start of line but ignore numbers
     // Note that region lines start with tab
     std::string expected = "#####\n"
@@ -275,15 +391,10 @@ TEST_F(ReporterTest, generate)
         "    mpi-runtime (sec): 45\n"
         "    ignore-time (sec): 0.7\n"
         "    geopmctl memory HWM:\n"
-        "    geopmctl network BW (B/sec): 678\n\n";
-
-    std::istringstream exp_stream(expected);
-
-    m_reporter->generate("my_agent", agent_header, agent_node_report, m_region_agent_detail,
-                         m_application_io,
-                         m_comm, m_tree_comm);
-    std::ifstream report(m_report_name);
-    check_report(exp_stream, report);
+        "    geopmctl network BW (B/sec): 678\n"
+        "    geopmctl CPU utilization (%): \n"
+        "    geopmctl profile messages dropped: 3\n\n";
+    return expected;
 }
 
 void check_report(std::istream &expected, std::istream &result)
@@ -32,10 +32,13 @@
 
 #include <iostream>
 #include <sys/stat.h>
+#include <time.h>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "geopm_error.h"
 #include "geopm_env.h"
+#include "geopm_time.h"
 #include "Exception.hpp"
 #include "SharedMemory.hpp"
 
@@ -157,3 +160,32 @@ TEST_F(SharedMemoryTest, share_data_ipc)
         exit(0);
     }
 }
+
+TEST_F(SharedMemoryTest, wait_blocked)
+{
+    m_shm_key += "-wait_blocked";
+    std::thread creator([this] () {
+        usleep(200000);
+        config_shmem();
+    });
+    struct timespec cpu_begin;
+    struct timespec cpu_end;
+    struct geopm_time_s wall_begin;
+    struct geopm_time_s wall_end;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_begin);
+    geopm_time(&wall_begin);
+    m_shmem_u = new geopm::SharedMemoryUser(m_shm_key, 5);
+    geopm_time(&wall_end);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+    creator.join();
+    double wall_time = geopm_time_diff(&wall_begin, &wall_end);
+    double cpu_time = (cpu_end.tv_sec - cpu_begin.tv_sec) +
+                      1e-9 * (cpu_end.tv_nsec - cpu_begin.tv_nsec);
+    EXPECT_EQ(m_size, m_shmem_u->size());
+    EXPECT_LT(0.1, wall_time);
+    EXPECT_GT(2.0, wall_time);
+    // The waiting process should sleep rather than spin.
+    EXPECT_GT(0.5 * wall_time, cpu_time);
+    cleanup_shmem_u();
+    cleanup_shmem();
+}
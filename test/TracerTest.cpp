@@ -32,6 +32,9 @@
 
 #include <fstream>
 #include <sstream>
+#include <numeric>
+#include <iterator>
+#include <string.h>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -48,6 +51,7 @@ using geopm::IPlatformIO;
 using geopm::IPlatformTopo;
 using testing::_;
 using testing::Return;
+using testing::SetArgReferee;
 using testing::HasSubstr;
 
 class TracerTest : public ::testing::Test
@@ -60,6 +64,7 @@ class TracerTest : public ::testing::Test
         std::string m_hostname = "myhost";
         std::vector<IPlatformIO::m_request_s> m_default_cols;
         std::vector<std::string> m_extra_cols;
+        const int M_COLUMN_GROUP = 2;
 };
 
 void TracerTest::SetUp(void)
@@ -88,6 +93,10 @@ void TracerTest::SetUp(void)
             .WillOnce(Return(idx));
         ++idx;
     }
+    std::vector<int> column_idx(idx);
+    std::iota(column_idx.begin(), column_idx.end(), 0);
+    EXPECT_CALL(m_platform_io, push_signal_group(column_idx))
+        .WillOnce(Return(M_COLUMN_GROUP));
 }
 
 void TracerTest::TearDown(void)
@@ -99,7 +108,7 @@ void check_trace(std::istream &expected, std::istream &result);
 
 TEST_F(TracerTest, columns)
 {
-    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1);
+    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1, "text");
 
     // columns from agent will be printed as-is
     std::vector<std::string> agent_cols {"col1", "col2"};
@@ -125,17 +134,18 @@ TEST_F(TracerTest, columns)
 
 TEST_F(TracerTest, update_samples)
 {
-    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1);
+    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1, "text");
+    std::vector<double> column_value;
     int idx = 0;
     for (auto cc : m_default_cols) {
-        EXPECT_CALL(m_platform_io, sample(idx))
-            .WillOnce(Return(idx + 0.5));
+        column_value.push_back(idx + 0.5);
         ++idx;
     }
     for (auto cc : m_extra_cols) {
-        EXPECT_CALL(m_platform_io, sample(idx))
-            .WillOnce(Return(idx + 0.7));
+        column_value.push_back(idx + 0.7);
     }
+    EXPECT_CALL(m_platform_io, sample_group(M_COLUMN_GROUP, _))
+        .WillOnce(SetArgReferee<1>(column_value));
 
     std::vector<std::string> agent_cols {"col1", "col2"};
     std::vector<double> agent_vals {88.8, 77.7};
@@ -153,14 +163,94 @@ TEST_F(TracerTest, update_samples)
     check_trace(expected, result);
 }
 
+TEST_F(TracerTest, update_samples_binary)
+{
+    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1, "binary");
+    std::vector<double> column_value;
+    int idx = 0;
+    for (auto cc : m_default_cols) {
+        column_value.push_back(idx + 0.5);
+        ++idx;
+    }
+    for (auto cc : m_extra_cols) {
+        column_value.push_back(idx + 0.7);
+    }
+    EXPECT_CALL(m_platform_io, sample_group(M_COLUMN_GROUP, _))
+        .Times(2)
+        .WillRepeatedly(SetArgReferee<1>(column_value));
+
+    std::vector<std::string> agent_cols {"col1", "col2"};
+    std::vector<double> agent_vals {88.8, 77.7};
+
+    tracer.columns(agent_cols);
+    tracer.update(agent_vals, {});
+    tracer.update(agent_vals, {});
+    tracer.flush();
+
+    std::ifstream result(m_path + "-" + m_hostname, std::ios::binary);
+    ASSERT_TRUE(result.good()) << strerror(errno);
+    std::string contents((std::istreambuf_iterator<char>(result)),
+                         std::istreambuf_iterator<char>());
+    size_t offset = 0;
+    auto read_u32 = [&contents, &offset](void) {
+        uint32_t value;
+        memcpy(&value, contents.data() + offset, sizeof(value));
+        offset += sizeof(value);
+        return value;
+    };
+    ASSERT_LT(16u, contents.size());
+    EXPECT_EQ("GEOPMTRB", contents.substr(0, 8));
+    offset = 8;
+    EXPECT_EQ(1u, read_u32());
+    uint32_t num_col = read_u32();
+    ASSERT_EQ(10u, num_col);
+    uint32_t header_len = read_u32();
+    std::string header = contents.substr(offset, header_len);
+    offset += header_len;
+    EXPECT_THAT(header, HasSubstr("# \"node_name\" : \"" + m_hostname + "\"\n"));
+    std::vector<std::string> expected_name {"seconds", "region_id", "progress-0",
+                                            "runtime-0", "energy_package", "power_package",
+                                            "frequency", "extra", "col1", "col2"};
+    std::vector<uint32_t> col_type;
+    for (uint32_t col = 0; col < num_col; ++col) {
+        col_type.push_back(read_u32());
+        uint32_t name_len = read_u32();
+        EXPECT_EQ(expected_name[col], contents.substr(offset, name_len));
+        offset += name_len;
+    }
+    std::vector<uint32_t> expected_type {0, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_EQ(expected_type, col_type);
+    offset = 8 * ((offset + 7) / 8);
+    // one block holding both rows
+    EXPECT_EQ(2u, read_u32());
+    EXPECT_EQ(0u, read_u32());
+    ASSERT_EQ(offset + 2 * num_col * sizeof(uint64_t), contents.size());
+    std::vector<double> expected_row(column_value);
+    expected_row.insert(expected_row.end(), agent_vals.begin(), agent_vals.end());
+    for (uint32_t col = 0; col < num_col; ++col) {
+        for (int row = 0; row < 2; ++row) {
+            uint64_t value;
+            memcpy(&value, contents.data() + offset, sizeof(value));
+            offset += sizeof(value);
+            if (col_type[col] == 1) {
+                EXPECT_EQ(geopm_signal_to_field(expected_row[col]), value);
+            }
+            else {
+                double dval;
+                memcpy(&dval, &value, sizeof(dval));
+                EXPECT_EQ(expected_row[col], dval);
+            }
+        }
+    }
+}
+
 TEST_F(TracerTest, region_entry_exit)
 {
-    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1);
-    EXPECT_CALL(m_platform_io, sample(_)).Times(m_default_cols.size() + m_extra_cols.size())
-        .WillOnce(Return(2.2))  // time
-        .WillOnce(Return(2.2))  // region id
-        .WillOnce(Return(0.0))  // progress; should cause one region entry to be skipped
-        .WillRepeatedly(Return(2.2));
+    Tracer tracer(m_path, m_hostname, true, m_platform_io, m_extra_cols, 1, "text");
+    std::vector<double> column_value(m_default_cols.size() + m_extra_cols.size(), 2.2);
+    column_value[2] = 0.0;  // progress; should cause one region entry to be skipped
+    EXPECT_CALL(m_platform_io, sample_group(M_COLUMN_GROUP, _))
+        .WillOnce(SetArgReferee<1>(column_value));
 
     std::vector<std::string> agent_cols {"col1", "col2"};
     std::vector<double> agent_vals {88.8, 77.7};
@@ -36,10 +36,12 @@
 #include "gmock/gmock.h"
 
 #include "TreeCommLevel.hpp"
+#include "PlatformIO.hpp"
 #include "MockComm.hpp"
 #include "geopm_test.hpp"
 
 using geopm::TreeCommLevel;
+using geopm::MessageMatrix;
 using testing::Return;
 using testing::Invoke;
 using testing::SetArgPointee;
@@ -225,7 +227,7 @@ TEST_F(TreeCommLevelTest, receive_up_complete)
                                               {46.6, 36.6, 26.6},
                                               {45.5, 35.5, 25.5}};
     ASSERT_EQ(m_num_rank, (int)sample.size());
-    std::vector<std::vector<double> > sample_out(m_num_rank, std::vector<double>(m_num_up, 0.0));
+    MessageMatrix sample_out(m_num_rank, m_num_up);
 
     EXPECT_CALL(*m_comm_0, window_lock(_, false, _, _)); // read
     EXPECT_CALL(*m_comm_0, window_lock(_, true, _, _)); // write
@@ -243,7 +245,7 @@ TEST_F(TreeCommLevelTest, receive_up_complete)
     }
 
     EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
-    EXPECT_EQ(sample, sample_out);
+    EXPECT_EQ(MessageMatrix(sample), sample_out);
     // errors
 #ifdef GEOPM_DEBUG
     GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_1->receive_up(sample_out),
@@ -258,7 +260,8 @@ TEST_F(TreeCommLevelTest, receive_up_incomplete)
                                               {46.6, 36.6, 26.6},
                                               {45.5, 35.5, 25.5}};
     ASSERT_EQ(m_num_rank, (int)sample.size());
-    std::vector<std::vector<double> > sample_out(m_num_rank, std::vector<double>(m_num_up, NAN));
+    MessageMatrix sample_out(m_num_rank, m_num_up);
+    sample_out.fill(NAN);
 
     EXPECT_CALL(*m_comm_0, window_lock(_, false, _, _)); // read
     EXPECT_CALL(*m_comm_0, window_unlock(_, _));
@@ -275,13 +278,52 @@ TEST_F(TreeCommLevelTest, receive_up_incomplete)
     }
 
     EXPECT_FALSE(m_level_rank_0->receive_up(sample_out));
-    for (const auto &ss : sample_out) {
-        for (auto tt : ss) {
-            EXPECT_TRUE(isnan(tt));
+    for (size_t child = 0; child < sample_out.num_row(); ++child) {
+        for (size_t sig = 0; sig < sample_out.num_col(); ++sig) {
+            EXPECT_TRUE(isnan(sample_out[child][sig]));
         }
     }
 }
 
+TEST_F(TreeCommLevelTest, receive_up_aggregate)
+{
+    std::vector<std::vector<double> > sample {{44.4, 33.3, 22.2},
+                                              {41.1, 31.1, 21.1},
+                                              {46.6, 36.6, 26.6},
+                                              {45.5, 35.5, 25.5}};
+    ASSERT_EQ(m_num_rank, (int)sample.size());
+    std::vector<std::function<double(const std::vector<double> &)> > agg_func {
+        geopm::IPlatformIO::agg_max, geopm::IPlatformIO::agg_min, geopm::IPlatformIO::agg_sum};
+    ASSERT_EQ(m_num_up, (int)agg_func.size());
+    std::vector<double> sample_out(m_num_up, 0.0);
+
+    EXPECT_CALL(*m_comm_0, window_lock(_, false, _, _)); // read
+    EXPECT_CALL(*m_comm_0, window_lock(_, true, _, _)); // write
+    EXPECT_CALL(*m_comm_0, window_unlock(_, _)).Times(2);
+    // mock writing into window
+    double complete = 1.0;
+    double *curr = m_sample_mem_0;
+    for (const auto &child_sample : sample) {
+        memcpy(curr, &complete, sizeof(complete));
+        ++curr;
+        memcpy(curr, child_sample.data(), m_num_up * sizeof(double));
+        curr += m_num_up;
+    }
+
+    EXPECT_TRUE(m_level_rank_0->receive_up_aggregate(agg_func, sample_out));
+    EXPECT_DOUBLE_EQ(46.6, sample_out[0]);
+    EXPECT_DOUBLE_EQ(31.1, sample_out[1]);
+    EXPECT_DOUBLE_EQ(22.2 + 21.1 + 26.6 + 25.5, sample_out[2]);
+    // ready flags are cleared
+    for (int rank = 0; rank < m_num_rank; ++rank) {
+        EXPECT_EQ(0.0, m_sample_mem_0[rank * (m_num_up + 1)]);
+    }
+
+    agg_func.pop_back();
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_0->receive_up_aggregate(agg_func, sample_out),
+                               GEOPM_ERROR_INVALID, "not sized correctly");
+}
+
 TEST_F(TreeCommLevelTest, receive_down_complete)
 {
     // only rank 1 locks window
@@ -333,3 +375,99 @@ TEST_F(TreeCommLevelTest, receive_down_incomplete)
         EXPECT_TRUE(isnan(pp));
     }
 }
+
+TEST_F(TreeCommLevelTest, send_up_sparse)
+{
+    std::vector<double> tolerance {0.0, 0.5, 1.0};
+    m_level_rank_0->sample_tolerance(tolerance);
+    m_level_rank_1->sample_tolerance(tolerance);
+    size_t base_off = (m_num_up + 1) * sizeof(double);
+
+    // first send puts every value
+    EXPECT_CALL(*m_comm_1, window_lock(_, _, _, _)).Times(2);
+    EXPECT_CALL(*m_comm_1, window_unlock(_, _)).Times(2);
+    EXPECT_CALL(*m_comm_1, window_put(_, sizeof(double), _, base_off, _)).Times(2); // ready flag
+    EXPECT_CALL(*m_comm_1, window_put(_, 3 * sizeof(double), _, base_off + sizeof(double), _));
+    std::vector<double> sample {5.5, 6.6, 7.7};
+    m_level_rank_1->send_up(sample);
+    EXPECT_EQ(4 * sizeof(double), m_level_rank_1->overhead_send());
+
+    // changes within tolerance are not sent
+    sample = {5.5, 7.0, 8.5};
+    m_level_rank_1->send_up(sample);
+    EXPECT_EQ(4 * sizeof(double), m_level_rank_1->overhead_send());
+
+    // only the value that changed by more than its tolerance is put
+    sample = {5.5, 7.2, 8.5};
+    EXPECT_CALL(*m_comm_1, window_put(_, sizeof(double), _, base_off + 2 * sizeof(double), _));
+    m_level_rank_1->send_up(sample);
+    EXPECT_EQ(6 * sizeof(double), m_level_rank_1->overhead_send());
+
+    // rank zero writes its own mailbox only on change
+    EXPECT_CALL(*m_comm_0, window_put(_, _, _, _, _)).Times(0);
+    sample = {1.0, 2.0, 3.0};
+    m_level_rank_0->send_up(sample);
+    EXPECT_EQ(1.0, m_sample_mem_0[0]);
+    m_sample_mem_0[0] = 0.0;
+    m_level_rank_0->send_up(sample);
+    EXPECT_EQ(0.0, m_sample_mem_0[0]);
+
+    tolerance = {0.0, -1.0, 0.0};
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_0->sample_tolerance(tolerance),
+                               GEOPM_ERROR_INVALID, "tolerance vector");
+    tolerance = {0.0};
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_0->sample_tolerance(tolerance),
+                               GEOPM_ERROR_INVALID, "tolerance vector");
+}
+
+TEST_F(TreeCommLevelTest, receive_up_sparse)
+{
+    m_level_rank_0->sample_tolerance({0.0, 0.0, 0.0});
+    std::vector<std::vector<double> > sample {{44.4, 33.3, 22.2},
+                                              {41.1, 31.1, 21.1},
+                                              {46.6, 36.6, 26.6},
+                                              {45.5, 35.5, 25.5}};
+    MessageMatrix sample_out(m_num_rank, m_num_up);
+    EXPECT_CALL(*m_comm_0, window_lock(_, false, _, _)).Times(3);
+    EXPECT_CALL(*m_comm_0, window_lock(_, true, _, _)).Times(2);
+    EXPECT_CALL(*m_comm_0, window_unlock(_, _)).Times(5);
+
+    // all but the last child have posted
+    double *curr = m_sample_mem_0;
+    for (int rank = 0; rank < m_num_rank; ++rank) {
+        *curr = rank != m_num_rank - 1 ? 1.0 : 0.0;
+        memcpy(curr + 1, sample[rank].data(), m_num_up * sizeof(double));
+        curr += m_num_up + 1;
+    }
+    EXPECT_FALSE(m_level_rank_0->receive_up(sample_out));
+
+    // once every child has posted the mailbox is complete
+    m_sample_mem_0[(m_num_rank - 1) * (m_num_up + 1)] = 1.0;
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    EXPECT_EQ(MessageMatrix(sample), sample_out);
+
+    // one child posts a change; the others keep their last values
+    sample[2][1] = 99.9;
+    m_sample_mem_0[2 * (m_num_up + 1)] = 1.0;
+    m_sample_mem_0[2 * (m_num_up + 1) + 2] = 99.9;
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    EXPECT_EQ(MessageMatrix(sample), sample_out);
+}
+
+TEST_F(TreeCommLevelTest, send_down_changed)
+{
+    std::vector<std::vector<double> > policy {{2.2, 3.3}, {2.9, 3.9}, {2.1, 3.1}, {2.0, 3.0}};
+    size_t msg_size = sizeof(double) * m_num_down;
+    EXPECT_CALL(*m_comm_0, window_lock(_, _, _, _)).Times(m_num_rank);
+    EXPECT_CALL(*m_comm_0, window_unlock(_, _)).Times(m_num_rank);
+    EXPECT_CALL(*m_comm_0, window_put(_, sizeof(double), _, 0, _)).Times(m_num_rank);
+    EXPECT_CALL(*m_comm_0, window_put(_, msg_size, _, sizeof(double), _)).Times(m_num_rank - 1);
+    m_level_rank_0->send_down(policy);
+
+    // only the changed value of the changed child is put
+    policy[2][1] = 4.4;
+    EXPECT_CALL(*m_comm_0, window_put(_, sizeof(double), 2, 2 * sizeof(double), _));
+    m_level_rank_0->send_down(policy);
+    EXPECT_EQ((sizeof(double) + msg_size) * (m_num_rank - 1) + 2 * sizeof(double),
+              m_level_rank_0->overhead_send());
+}
@@ -35,12 +35,14 @@
 #include <utility>
 #include <algorithm>
 #include <numeric>
+#include <map>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 #include "TreeComm.hpp"
 #include "TreeCommLevel.hpp"
+#include "PlatformIO.hpp"
 #include "MockComm.hpp"
 #include "MockTreeCommLevel.hpp"
 #include "geopm_test.hpp"
@@ -48,11 +50,17 @@
 
 using geopm::ITreeCommLevel;
 using geopm::TreeComm;
+using geopm::MessageMatrix;
+using geopm::ITreeComm;
 using geopm::IComm;
 using testing::_;
 using testing::Return;
 using testing::DoAll;
 using testing::SetArgReferee;
+using testing::Invoke;
+using testing::AnyNumber;
+using testing::AtLeast;
+using testing::SetArgPointee;
 
 class TreeCommTest : public ::testing::Test
 {
@@ -106,9 +114,9 @@ TEST_F(TreeCommTest, geometry)
 TEST_F(TreeCommTest, send_receive)
 {
     std::vector<double> sample {10.0, 11.0, 12.0};
-    std::vector<std::vector<double> > expected_sample {sample, sample};
-    std::vector<std::vector<double> > recv_sample(2, std::vector<double>(3));
-    std::vector<std::vector<double> > policy {{9.0}, {8.0}};
+    MessageMatrix expected_sample(std::vector<std::vector<double> > {sample, sample});
+    MessageMatrix recv_sample(2, 3);
+    MessageMatrix policy(std::vector<std::vector<double> > {{9.0}, {8.0}});
     std::vector<double> recv_policy(1);
 
     for (int level = 0; level < 4; ++level) {
@@ -126,9 +134,9 @@ TEST_F(TreeCommTest, send_receive)
         }
 
         EXPECT_CALL(*(m_level_ptr[level]), receive_down(_)).WillOnce(
-            DoAll(SetArgReferee<0>(policy[0]), Return(true)));
+            DoAll(SetArgReferee<0>(policy.row(0)), Return(true)));
         EXPECT_TRUE(m_tree_comm->receive_down(level, recv_policy));
-        EXPECT_EQ(policy[0], recv_policy);
+        EXPECT_EQ(policy.row(0), recv_policy);
     }
 
     GEOPM_EXPECT_THROW_MESSAGE(m_tree_comm->send_up(-1, sample),
@@ -162,3 +170,146 @@ TEST_F(TreeCommTest, overhead_send)
 
     EXPECT_EQ(expected_overhead, m_tree_comm->overhead_send());
 }
+
+TEST_F(TreeCommTest, receive_up_aggregate)
+{
+    std::vector<std::function<double(const std::vector<double> &)> > agg_func {
+        geopm::IPlatformIO::agg_sum, geopm::IPlatformIO::agg_max};
+    std::vector<double> sample(2);
+    EXPECT_CALL(*(m_level_ptr[1]), receive_up_aggregate(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<double>{5.5, 6.6}), Return(true)));
+    EXPECT_TRUE(m_tree_comm->receive_up_aggregate(1, agg_func, sample));
+    EXPECT_EQ(std::vector<double>({5.5, 6.6}), sample);
+    GEOPM_EXPECT_THROW_MESSAGE(m_tree_comm->receive_up_aggregate(-1, agg_func, sample),
+                               GEOPM_ERROR_LEVEL_RANGE, "receive_up_aggregate");
+    GEOPM_EXPECT_THROW_MESSAGE(m_tree_comm->receive_up_aggregate(4, agg_func, sample),
+                               GEOPM_ERROR_LEVEL_RANGE, "receive_up_aggregate");
+}
+
+TEST_F(TreeCommTest, sample_tolerance)
+{
+    std::vector<std::vector<double> > tolerance {
+        {0.5, 1.0},
+        {5.0, 1.0},
+        {20.0, 2.0},
+        {100.0, 4.0},
+    };
+    for (int level = 0; level < 4; ++level) {
+        EXPECT_CALL(*(m_level_ptr[level]), sample_tolerance(tolerance[level]));
+    }
+    for (int level = 3; level >= 0; --level) {
+        m_tree_comm->sample_tolerance(level, tolerance[level]);
+    }
+    GEOPM_EXPECT_THROW_MESSAGE(m_tree_comm->sample_tolerance(-1, tolerance[0]),
+                               GEOPM_ERROR_LEVEL_RANGE, "sample_tolerance");
+    GEOPM_EXPECT_THROW_MESSAGE(m_tree_comm->sample_tolerance(4, tolerance[0]),
+                               GEOPM_ERROR_LEVEL_RANGE, "sample_tolerance");
+}
+
+TEST_F(TreeCommTest, fan_out)
+{
+    std::map<size_t, std::vector<int> > dims {
+        {2, {8, 8}},
+        {3, {4, 4, 4}},
+        {4, {4, 4, 2, 2}},
+        {5, {4, 2, 2, 2, 2}},
+        {6, {2, 2, 2, 2, 2, 2}},
+    };
+    auto comm = std::make_shared<MockComm>();
+    EXPECT_CALL(*comm, num_rank()).WillRepeatedly(Return(64));
+    EXPECT_CALL(*comm, dimension_create(64, _))
+        .WillRepeatedly(Invoke([&dims](int num_rank, std::vector<int> &dim) {
+                                   dim = dims.at(dim.size());
+                               }));
+    // level latency dominates: flattest tree within the fan out cap
+    EXPECT_EQ(std::vector<int>({8, 8}), ITreeComm::fan_out(comm, 1e-3, 1e-6));
+    // balanced: two levels
+    EXPECT_EQ(std::vector<int>({8, 8}), ITreeComm::fan_out(comm, 10e-6, 1e-6));
+    // child latency dominates: deep tree, the shallowest of equal
+    // child cost is chosen
+    EXPECT_EQ(std::vector<int>({4, 4, 4}), ITreeComm::fan_out(comm, 1e-9, 1e-6));
+    EXPECT_DOUBLE_EQ(3 * 10e-6 + 12 * 1e-6,
+                     ITreeComm::fan_out_cost({4, 4, 4}, 10e-6, 1e-6));
+
+    // measured latencies: 10 us per level and no measurable
+    // contention, the child latency is raised to 1 us
+    std::vector<double> mailbox(64);
+    EXPECT_CALL(*comm, rank()).WillRepeatedly(Return(0));
+    EXPECT_CALL(*comm, alloc_mem(64 * sizeof(double), _))
+        .WillOnce(SetArgPointee<1>((void *)mailbox.data()));
+    EXPECT_CALL(*comm, window_create(64 * sizeof(double), (void *)mailbox.data()))
+        .WillOnce(Return(42));
+    EXPECT_CALL(*comm, barrier()).Times(AtLeast(1));
+    EXPECT_CALL(*comm, reduce_max(_, _, 2, 0))
+        .WillOnce(Invoke([](double *send_buf, double *recv_buf, size_t count, int root) {
+                             recv_buf[0] = 10e-6;
+                             recv_buf[1] = 9e-6;
+                         }));
+    EXPECT_CALL(*comm, broadcast(_, 2 * sizeof(double), 0))
+        .WillOnce(Invoke([](void *buffer, size_t size, int root) {
+                             double *latency = (double *)buffer;
+                             EXPECT_DOUBLE_EQ(10e-6, latency[0]);
+                             EXPECT_DOUBLE_EQ(1e-6, latency[1]);
+                         }));
+    EXPECT_CALL(*comm, window_destroy(42));
+    EXPECT_CALL(*comm, free_mem((void *)mailbox.data()));
+    EXPECT_EQ(std::vector<int>({8, 8}), ITreeComm::fan_out(comm));
+
+    // no tree within the fan out cap: the narrowest tree is chosen
+    dims = {
+        {2, {17, 2}},
+        {3, {17, 2, 1}},
+        {4, {17, 2, 1, 1}},
+        {5, {17, 2, 1, 1, 1}},
+    };
+    EXPECT_CALL(*comm, num_rank()).WillRepeatedly(Return(34));
+    EXPECT_CALL(*comm, dimension_create(34, _))
+        .WillRepeatedly(Invoke([&dims](int num_rank, std::vector<int> &dim) {
+                                   dim = dims.at(dim.size());
+                               }));
+    EXPECT_EQ(std::vector<int>({2, 17}), ITreeComm::fan_out(comm, 1e-3, 1e-6));
+    EXPECT_EQ(std::vector<int>({2, 17}), ITreeComm::fan_out(comm, 1e-6, 1e-6));
+
+    EXPECT_CALL(*comm, num_rank()).WillRepeatedly(Return(1));
+    EXPECT_EQ(std::vector<int>(), ITreeComm::fan_out(comm, 10e-6, 1e-6));
+    EXPECT_EQ(std::vector<int>(), ITreeComm::fan_out(comm));
+}
+
+TEST_F(TreeCommTest, measure_latency)
+{
+    // rank 1 of 4 sends to rank 0 and receives the latencies
+    // derived by rank 0
+    auto comm = std::make_shared<MockComm>();
+    EXPECT_CALL(*comm, num_rank()).WillRepeatedly(Return(4));
+    EXPECT_CALL(*comm, rank()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*comm, alloc_mem(_, _)).Times(0);
+    EXPECT_CALL(*comm, window_create(0, NULL)).WillOnce(Return(7));
+    EXPECT_CALL(*comm, window_lock(7, true, 0, 0)).Times(AtLeast(2));
+    EXPECT_CALL(*comm, window_put(_, sizeof(double), 0, sizeof(double), 7)).Times(AtLeast(2));
+    EXPECT_CALL(*comm, window_unlock(7, 0)).Times(AtLeast(2));
+    EXPECT_CALL(*comm, barrier()).Times(AtLeast(1));
+    EXPECT_CALL(*comm, reduce_max(_, _, 2, 0))
+        .WillOnce(Invoke([](double *send_buf, double *recv_buf, size_t count, int root) {
+                             EXPECT_LE(0.0, send_buf[0]);
+                             EXPECT_LE(0.0, send_buf[1]);
+                         }));
+    EXPECT_CALL(*comm, broadcast(_, 2 * sizeof(double), 0))
+        .WillOnce(Invoke([](void *buffer, size_t size, int root) {
+                             double *latency = (double *)buffer;
+                             latency[0] = 2e-6;
+                             latency[1] = 3e-6;
+                         }));
+    EXPECT_CALL(*comm, window_destroy(7));
+    EXPECT_CALL(*comm, free_mem(_)).Times(0);
+    double level_latency = -1.0;
+    double child_latency = -1.0;
+    ITreeComm::measure_latency(comm, level_latency, child_latency);
+    EXPECT_DOUBLE_EQ(2e-6, level_latency);
+    EXPECT_DOUBLE_EQ(3e-6, child_latency);
+
+    // nothing to measure with a single rank
+    EXPECT_CALL(*comm, num_rank()).WillRepeatedly(Return(1));
+    ITreeComm::measure_latency(comm, level_latency, child_latency);
+    EXPECT_EQ(0.0, level_latency);
+    EXPECT_EQ(0.0, child_latency);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <time.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "Waiter.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::Waiter;
+
+static double monotonic_time(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1E-9;
+}
+
+TEST(WaiterTest, period)
+{
+    double period = 0.01;
+    double begin = monotonic_time();
+    Waiter waiter(period);
+    EXPECT_EQ(period, waiter.period());
+    for (int idx = 0; idx < 5; ++idx) {
+        waiter.wait();
+    }
+    // periods are measured from absolute deadlines so they do not
+    // accumulate the latency of each wake up
+    EXPECT_LE(5 * period, monotonic_time() - begin);
+}
+
+TEST(WaiterTest, work_counts_toward_period)
+{
+    double period = 0.02;
+    Waiter waiter(period);
+    // work for half of the period
+    usleep(10000);
+    double begin = monotonic_time();
+    waiter.wait();
+    double elapsed = monotonic_time() - begin;
+    EXPECT_GT(period, elapsed);
+    // after an overrun wait() returns immediately and the next
+    // period starts from the overrun
+    usleep(30000);
+    begin = monotonic_time();
+    waiter.wait();
+    EXPECT_GT(period, monotonic_time() - begin);
+    waiter.wait();
+    EXPECT_LE(period, monotonic_time() - begin);
+}
+
+TEST(WaiterTest, reset)
+{
+    double period = 0.01;
+    Waiter waiter(period);
+    usleep(20000);
+    double begin = monotonic_time();
+    waiter.reset();
+    waiter.wait();
+    EXPECT_LE(period, monotonic_time() - begin);
+    GEOPM_EXPECT_THROW_MESSAGE(Waiter(-1.0), GEOPM_ERROR_INVALID, "period must be non-negative");
+}
+
+TEST(WaiterTest, set_period)
+{
+    Waiter waiter(1.0);
+    // shortening the period moves the current deadline earlier
+    waiter.period(0.01);
+    EXPECT_EQ(0.01, waiter.period());
+    double begin = monotonic_time();
+    waiter.wait();
+    double elapsed = monotonic_time() - begin;
+    EXPECT_GT(0.5, elapsed);
+    GEOPM_EXPECT_THROW_MESSAGE(waiter.period(-1.0), GEOPM_ERROR_INVALID, "period must be non-negative");
+}
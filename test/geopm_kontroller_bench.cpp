@@ -0,0 +1,756 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/// @file geopm_kontroller_bench.cpp
+/// @brief Measures the steady state cost of Kontroller::step() for
+///        each agent registered with the agent_factory().
+///
+/// The Kontroller is driven with a synthetic IOGroup behind a real
+/// PlatformIO and an in-process ITreeComm that simulates every level
+/// of the tree with a fixed fan-out.  The time, the number of heap
+/// allocations and the hardware cache misses per step are reported
+/// for each agent.  Agent wait() calls are skipped so that only the
+/// control loop overhead is measured.
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include <atomic>
+#include <functional>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "geopm_hash.h"
+#include "geopm_message.h"
+#include "geopm_time.h"
+#include "Agent.hpp"
+#include "ApplicationIO.hpp"
+#include "BalancingAgent.hpp"
+#include "EnergyEfficientAgent.hpp"
+#include "Exception.hpp"
+#include "IOGroup.hpp"
+#include "Kontroller.hpp"
+#include "ManagerIO.hpp"
+#include "MonitorAgent.hpp"
+#include "PlatformIO.hpp"
+#include "PlatformIOInternal.hpp"
+#include "PlatformTopo.hpp"
+#include "Reporter.hpp"
+#include "Tracer.hpp"
+#include "TreeComm.hpp"
+#include "config.h"
+
+using geopm::IAgent;
+using geopm::IPlatformIO;
+using geopm::IPlatformTopo;
+using geopm::MessageMatrix;
+
+static std::atomic<size_t> g_num_alloc(0);
+
+void *operator new(size_t size)
+{
+    ++g_num_alloc;
+    void *result = malloc(size ? size : 1);
+    if (!result) {
+        throw std::bad_alloc();
+    }
+    return result;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+/// Counts last level cache misses of the calling thread; reports NAN
+/// when hardware counters are not available.
+class CacheMissCounter
+{
+    public:
+        CacheMissCounter()
+        {
+            struct perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            m_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        }
+        virtual ~CacheMissCounter()
+        {
+            if (m_fd != -1) {
+                close(m_fd);
+            }
+        }
+        void start(void)
+        {
+            if (m_fd != -1) {
+                ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+        double stop(void)
+        {
+            double result = NAN;
+            uint64_t count = 0;
+            if (m_fd != -1) {
+                ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+                if (read(m_fd, &count, sizeof(count)) == sizeof(count)) {
+                    result = count;
+                }
+            }
+            return result;
+        }
+    private:
+        int m_fd;
+};
+
+class BenchPlatformTopo : public IPlatformTopo
+{
+    public:
+        BenchPlatformTopo(int num_package, int num_core_per_package, int num_hyperthread)
+            : m_num_package(num_package)
+            , m_num_core(num_package * num_core_per_package)
+            , m_num_cpu(m_num_core * num_hyperthread)
+        {
+
+        }
+        virtual ~BenchPlatformTopo() = default;
+        int num_domain(int domain_type) const override
+        {
+            int result = 0;
+            switch (domain_type) {
+                case M_DOMAIN_BOARD:
+                    result = 1;
+                    break;
+                case M_DOMAIN_PACKAGE:
+                case M_DOMAIN_BOARD_MEMORY:
+                    result = m_num_package;
+                    break;
+                case M_DOMAIN_CORE:
+                    result = m_num_core;
+                    break;
+                case M_DOMAIN_CPU:
+                    result = m_num_cpu;
+                    break;
+                default:
+                    break;
+            }
+            return result;
+        }
+        void domain_cpus(int domain_type, int domain_idx, std::set<int> &cpu_idx) const override
+        {
+            cpu_idx.clear();
+            int num_dom = num_domain(domain_type);
+            if (num_dom) {
+                int num_cpu_per_dom = m_num_cpu / num_dom;
+                for (int cpu = domain_idx * num_cpu_per_dom; cpu != (domain_idx + 1) * num_cpu_per_dom; ++cpu) {
+                    cpu_idx.insert(cpu);
+                }
+            }
+        }
+        int domain_idx(int domain_type, int cpu_idx) const override
+        {
+            int num_dom = num_domain(domain_type);
+            return num_dom ? cpu_idx / (m_num_cpu / num_dom) : -1;
+        }
+        int define_cpu_group(const std::vector<int> &cpu_domain_idx) override
+        {
+            throw geopm::Exception("BenchPlatformTopo::define_cpu_group(): not supported",
+                                   GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+        }
+        bool is_domain_within(int inner_domain, int outer_domain) override
+        {
+            return inner_domain >= outer_domain;
+        }
+    private:
+        int m_num_package;
+        int m_num_core;
+        int m_num_cpu;
+};
+
+/// Provides every signal and control name that is requested.  Signals
+/// are in the board domain and controls are in the package domain.
+/// Signal values drift a little on each read_batch() and the region
+/// id cycles through a few regions.
+class BenchIOGroup : public geopm::IOGroup
+{
+    public:
+        BenchIOGroup()
+            : m_num_batch(0)
+        {
+
+        }
+        virtual ~BenchIOGroup() = default;
+        std::set<std::string> signal_names(void) const override
+        {
+            return {};
+        }
+        std::set<std::string> control_names(void) const override
+        {
+            return {};
+        }
+        bool is_valid_signal(const std::string &signal_name) const override
+        {
+            return true;
+        }
+        bool is_valid_control(const std::string &control_name) const override
+        {
+            return true;
+        }
+        int signal_domain_type(const std::string &signal_name) const override
+        {
+            return IPlatformTopo::M_DOMAIN_BOARD;
+        }
+        int control_domain_type(const std::string &control_name) const override
+        {
+            return IPlatformTopo::M_DOMAIN_PACKAGE;
+        }
+        int push_signal(const std::string &signal_name, int domain_type, int domain_idx) override
+        {
+            m_signal_name.push_back(signal_name);
+            m_signal_base.push_back(base_value(signal_name));
+            m_signal_value.push_back(m_signal_base.back());
+            return m_signal_name.size() - 1;
+        }
+        int push_control(const std::string &control_name, int domain_type, int domain_idx) override
+        {
+            m_control_value.push_back(NAN);
+            return m_control_value.size() - 1;
+        }
+        void read_batch(void) override
+        {
+            ++m_num_batch;
+            double drift = std::sin(0.01 * m_num_batch);
+            for (size_t idx = 0; idx != m_signal_value.size(); ++idx) {
+                if (m_signal_name[idx] == "REGION_ID#") {
+                    uint64_t region_id = M_REGION_ID_BASE +
+                                         (m_num_batch / M_NUM_BATCH_PER_REGION) % M_NUM_REGION;
+                    m_signal_value[idx] = geopm_field_to_signal(region_id);
+                }
+                else {
+                    m_signal_value[idx] = m_signal_base[idx] * (1.0 + 0.01 * drift);
+                }
+            }
+        }
+        void write_batch(void) override
+        {
+
+        }
+        double sample(int sample_idx) override
+        {
+            return m_signal_value[sample_idx];
+        }
+        void adjust(int control_idx, double setting) override
+        {
+            m_control_value[control_idx] = setting;
+        }
+        double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override
+        {
+            return base_value(signal_name);
+        }
+        void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override
+        {
+
+        }
+    private:
+        static double base_value(const std::string &signal_name)
+        {
+            static const std::map<std::string, double> value_map {
+                {"CPUINFO::FREQ_STICKER", 2.0e9},
+                {"CPUINFO::FREQ_MIN", 1.0e9},
+                {"CPUINFO::FREQ_MAX", 3.0e9},
+                {"CPUINFO::FREQ_STEP", 1.0e8},
+                {"FREQUENCY", 2.0e9},
+                {"POWER", 300.0},
+                {"POWER_PACKAGE", 250.0},
+                {"POWER_DRAM", 50.0},
+                {"REGION_PROGRESS", 0.5},
+            };
+            auto it = value_map.find(signal_name);
+            return it != value_map.end() ? it->second : 1.0;
+        }
+        static constexpr uint64_t M_REGION_ID_BASE = 0x100;
+        static constexpr uint64_t M_NUM_REGION = 4;
+        static constexpr uint64_t M_NUM_BATCH_PER_REGION = 16;
+        uint64_t m_num_batch;
+        std::vector<std::string> m_signal_name;
+        std::vector<double> m_signal_base;
+        std::vector<double> m_signal_value;
+        std::vector<double> m_control_value;
+};
+
+/// Simulates every level of the tree within the process.  This node
+/// is the root and child zero of every level; the other children
+/// echo the samples and policies sent by this node.
+class BenchTreeComm : public geopm::ITreeComm
+{
+    public:
+        BenchTreeComm(int num_level, int fan_out, int num_send_down, int num_send_up)
+            : m_num_level(num_level)
+            , m_fan_out(fan_out)
+            , m_policy(num_level + 1, std::vector<double>(num_send_down, NAN))
+            , m_sample(num_level + 1, std::vector<double>(num_send_up, NAN))
+            , m_is_policy_sent(num_level + 1, false)
+            , m_is_sample_sent(num_level + 1, false)
+            , m_operand(fan_out)
+        {
+
+        }
+        virtual ~BenchTreeComm() = default;
+        int num_level_controlled(void) const override
+        {
+            return m_num_level;
+        }
+        int root_level(void) const override
+        {
+            return m_num_level;
+        }
+        int level_rank(int level) const override
+        {
+            return 0;
+        }
+        int level_size(int level) const override
+        {
+            return m_fan_out;
+        }
+        void send_up(int level, const std::vector<double> &sample) override
+        {
+            m_sample[level] = sample;
+            m_is_sample_sent[level] = true;
+        }
+        void send_down(int level, const MessageMatrix &policy) override
+        {
+            m_policy[level].assign(policy[0], policy[0] + policy.num_col());
+            m_is_policy_sent[level] = true;
+        }
+        bool receive_up(int level, MessageMatrix &sample) override
+        {
+            bool result = m_is_sample_sent[level];
+            if (result) {
+                for (size_t child = 0; child != sample.num_row(); ++child) {
+                    sample.row(child, m_sample[level]);
+                }
+                m_is_sample_sent[level] = false;
+            }
+            return result;
+        }
+        bool receive_up_aggregate(int level,
+                                  const std::vector<std::function<double(const std::vector<double> &)> > &agg_func,
+                                  std::vector<double> &sample) override
+        {
+            bool result = m_is_sample_sent[level];
+            if (result) {
+                const std::vector<double> &child_sample = m_sample[level];
+                for (size_t sample_idx = 0; sample_idx != sample.size(); ++sample_idx) {
+                    m_operand.assign(m_fan_out, child_sample[sample_idx]);
+                    sample[sample_idx] = agg_func[sample_idx](m_operand);
+                }
+                m_is_sample_sent[level] = false;
+            }
+            return result;
+        }
+        bool receive_down(int level, std::vector<double> &policy) override
+        {
+            bool result = m_is_policy_sent[level];
+            if (result) {
+                policy = m_policy[level];
+                m_is_policy_sent[level] = false;
+            }
+            return result;
+        }
+        size_t overhead_send(void) const override
+        {
+            return 0;
+        }
+        void sample_tolerance(int level, const std::vector<double> &tolerance) override
+        {
+
+        }
+    private:
+        int m_num_level;
+        int m_fan_out;
+        std::vector<std::vector<double> > m_policy;
+        std::vector<std::vector<double> > m_sample;
+        std::vector<bool> m_is_policy_sent;
+        std::vector<bool> m_is_sample_sent;
+        std::vector<double> m_operand;
+};
+
+class BenchApplicationIO : public geopm::IApplicationIO
+{
+    public:
+        BenchApplicationIO() = default;
+        virtual ~BenchApplicationIO() = default;
+        void connect(void) override {}
+        bool do_shutdown(void) const override {return false;}
+        std::string report_name(void) const override {return "";}
+        std::string profile_name(void) const override {return "";}
+        std::set<std::string> region_name_set(void) const override {return {};}
+        double total_region_runtime(uint64_t region_id) const override {return 0.0;}
+        double total_region_mpi_runtime(uint64_t region_id) const override {return 0.0;}
+        double total_app_runtime(void) const override {return 0.0;}
+        double total_app_energy(void) const override {return 0.0;}
+        double total_app_mpi_runtime(void) const override {return 0.0;}
+        double total_epoch_ignore_runtime(void) const override {return 0.0;}
+        double total_epoch_runtime(void) const override {return 0.0;}
+        double total_epoch_mpi_runtime(void) const override {return 0.0;}
+        double total_epoch_energy(void) const override {return 0.0;}
+        int total_count(uint64_t region_id) const override {return 0;}
+        void update(std::shared_ptr<geopm::IComm> comm) override {}
+        std::list<geopm_region_info_s> region_info(void) const override {return {};}
+        void clear_region_info(void) override {}
+        void controller_ready(void) override {}
+        size_t total_profile_drop(void) const override {return 0;}
+};
+
+class BenchReporter : public geopm::IReporter
+{
+    public:
+        BenchReporter() = default;
+        virtual ~BenchReporter() = default;
+        void init(void) override {}
+        void generate(const std::string &agent_name,
+                      const std::vector<std::pair<std::string, std::string> > &agent_report_header,
+                      const std::vector<std::pair<std::string, std::string> > &agent_node_report,
+                      const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report,
+                      const geopm::IApplicationIO &application_io,
+                      std::shared_ptr<geopm::IComm> comm,
+                      const geopm::ITreeComm &tree_comm) override {}
+};
+
+class BenchTracer : public geopm::ITracer
+{
+    public:
+        BenchTracer() = default;
+        virtual ~BenchTracer() = default;
+        void update(const std::vector <struct geopm_telemetry_message_s> &telemetry) override {}
+        void update(const struct geopm_policy_message_s &policy) override {}
+        void columns(const std::vector<std::string> &agent_cols) override {}
+        void update(const std::vector<double> &agent_signals,
+                    std::list<geopm_region_info_s> region_entry_exit) override {}
+        void flush(void) override {}
+};
+
+class BenchManagerIOSampler : public geopm::IManagerIOSampler
+{
+    public:
+        BenchManagerIOSampler(int num_send_down)
+            : m_policy(num_send_down, 0.0)
+        {
+
+        }
+        virtual ~BenchManagerIOSampler() = default;
+        void read_batch(void) override {}
+        double sample(const std::string &signal_name) const override {return 0.0;}
+        std::vector<double> sample(void) const override {return m_policy;}
+        bool is_update_available(void) override {return false;}
+        std::vector<std::string> signal_names(void) const override {return {};}
+    private:
+        std::vector<double> m_policy;
+};
+
+/// Forwards to the wrapped agent except that wait() returns
+/// immediately.
+class BenchAgent : public IAgent
+{
+    public:
+        BenchAgent(std::unique_ptr<IAgent> agent)
+            : m_agent(std::move(agent))
+        {
+
+        }
+        virtual ~BenchAgent() = default;
+        void init(int level) override
+        {
+            m_agent->init(level);
+        }
+        bool descend(const std::vector<double> &in_policy, MessageMatrix &out_policy) override
+        {
+            return m_agent->descend(in_policy, out_policy);
+        }
+        bool ascend(const MessageMatrix &in_sample, std::vector<double> &out_sample) override
+        {
+            return m_agent->ascend(in_sample, out_sample);
+        }
+        std::vector<std::function<double(const std::vector<double> &)> > aggregate_function(void) const override
+        {
+            return m_agent->aggregate_function();
+        }
+        std::vector<double> sample_tolerance(void) const override
+        {
+            return m_agent->sample_tolerance();
+        }
+        bool adjust_platform(const std::vector<double> &policy) override
+        {
+            return m_agent->adjust_platform(policy);
+        }
+        bool sample_platform(std::vector<double> &sample) override
+        {
+            return m_agent->sample_platform(sample);
+        }
+        void wait(void) override
+        {
+
+        }
+        std::vector<std::pair<std::string, std::string> > report_header(void) override
+        {
+            return m_agent->report_header();
+        }
+        std::vector<std::pair<std::string, std::string> > report_node(void) override
+        {
+            return m_agent->report_node();
+        }
+        std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > report_region(void) override
+        {
+            return m_agent->report_region();
+        }
+        std::vector<std::string> trace_names(void) const override
+        {
+            return m_agent->trace_names();
+        }
+        void trace_values(std::vector<double> &values) override
+        {
+            m_agent->trace_values(values);
+        }
+    private:
+        std::unique_ptr<IAgent> m_agent;
+};
+
+struct bench_config_s {
+    int num_level;
+    int fan_out;
+    int num_signal;
+    int num_step;
+    int num_warmup;
+};
+
+struct bench_result_s {
+    double ns_per_step;
+    double alloc_per_step;
+    double miss_per_step;
+};
+
+/// Agents that accept an injected platform.  Plugins without an entry
+/// here are listed as skipped.
+static const std::map<std::string, std::function<IAgent *(IPlatformIO &, IPlatformTopo &)> > &bench_agent_map(void)
+{
+    static const std::map<std::string, std::function<IAgent *(IPlatformIO &, IPlatformTopo &)> > instance {
+        {geopm::MonitorAgent::plugin_name(),
+         [](IPlatformIO &plat_io, IPlatformTopo &plat_topo) {return new geopm::MonitorAgent(plat_io, plat_topo);}},
+        {geopm::BalancingAgent::plugin_name(),
+         [](IPlatformIO &plat_io, IPlatformTopo &plat_topo) {return new geopm::BalancingAgent(plat_io, plat_topo);}},
+        {geopm::EnergyEfficientAgent::plugin_name(),
+         [](IPlatformIO &plat_io, IPlatformTopo &plat_topo) {return new geopm::EnergyEfficientAgent(plat_io, plat_topo);}},
+    };
+    return instance;
+}
+
+static bench_result_s run_bench(const std::string &agent_name, const bench_config_s &config)
+{
+    BenchPlatformTopo plat_topo(2, 16, 2);
+    geopm::PlatformIO plat_io({std::make_shared<BenchIOGroup>()}, plat_topo);
+    int num_send_down = IAgent::num_policy(geopm::agent_factory().dictionary(agent_name));
+    int num_send_up = IAgent::num_sample(geopm::agent_factory().dictionary(agent_name));
+
+    std::vector<std::unique_ptr<IAgent> > level_agent;
+    for (int level = 0; level <= config.num_level; ++level) {
+        std::unique_ptr<IAgent> agent(bench_agent_map().at(agent_name)(plat_io, plat_topo));
+        level_agent.emplace_back(new BenchAgent(std::move(agent)));
+        level_agent.back()->init(level);
+    }
+    for (int signal_idx = 0; signal_idx != config.num_signal; ++signal_idx) {
+        plat_io.push_signal("BENCH::SIGNAL_" + std::to_string(signal_idx),
+                            IPlatformTopo::M_DOMAIN_BOARD, 0);
+    }
+    geopm::Kontroller kontroller(nullptr, plat_topo, plat_io,
+                                 agent_name, num_send_down, num_send_up,
+                                 std::unique_ptr<geopm::ITreeComm>(
+                                     new BenchTreeComm(config.num_level, config.fan_out,
+                                                       num_send_down, num_send_up)),
+                                 std::make_shared<BenchApplicationIO>(),
+                                 std::unique_ptr<geopm::IReporter>(new BenchReporter),
+                                 std::unique_ptr<geopm::ITracer>(new BenchTracer),
+                                 std::move(level_agent),
+                                 std::unique_ptr<geopm::IManagerIOSampler>(
+                                     new BenchManagerIOSampler(num_send_down)));
+    kontroller.setup_trace();
+    for (int step = 0; step != config.num_warmup; ++step) {
+        kontroller.step();
+    }
+
+    CacheMissCounter miss_counter;
+    struct geopm_time_s time_begin;
+    struct geopm_time_s time_end;
+    size_t num_alloc_begin = g_num_alloc;
+    geopm_time(&time_begin);
+    miss_counter.start();
+    for (int step = 0; step != config.num_step; ++step) {
+        kontroller.step();
+    }
+    double num_miss = miss_counter.stop();
+    geopm_time(&time_end);
+    size_t num_alloc_end = g_num_alloc;
+
+    bench_result_s result;
+    result.ns_per_step = 1e9 * geopm_time_diff(&time_begin, &time_end) / config.num_step;
+    result.alloc_per_step = (double)(num_alloc_end - num_alloc_begin) / config.num_step;
+    result.miss_per_step = num_miss / config.num_step;
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    const char *usage = "    %s [--help] [-a agent] [-l num_level] [-f fan_out]\n"
+                        "              [-s num_signal] [-n num_step] [-w num_warmup]\n"
+                        "\n"
+                        "       Report the time, heap allocations and cache misses of each\n"
+                        "       Kontroller::step() for every agent, or only for the named agent.\n"
+                        "       The tree is simulated in process with num_level levels that\n"
+                        "       each have fan_out children, and num_signal extra signals are\n"
+                        "       pushed into the PlatformIO batch.\n"
+                        "\n";
+    int err = 0;
+    int opt;
+    std::string agent_name;
+    bench_config_s config {2, 8, 0, 10000, 100};
+    if (argc > 1 && (strncmp(argv[1], "--help", strlen("--help") + 1) == 0 ||
+                     strncmp(argv[1], "-h", strlen("-h") + 1) == 0)) {
+        printf(usage, argv[0]);
+        return 0;
+    }
+    while (!err && (opt = getopt(argc, argv, "a:l:f:s:n:w:")) != -1) {
+        int *int_ptr = nullptr;
+        switch (opt) {
+            case 'a':
+                agent_name = optarg;
+                break;
+            case 'l':
+                int_ptr = &config.num_level;
+                break;
+            case 'f':
+                int_ptr = &config.fan_out;
+                break;
+            case 's':
+                int_ptr = &config.num_signal;
+                break;
+            case 'n':
+                int_ptr = &config.num_step;
+                break;
+            case 'w':
+                int_ptr = &config.num_warmup;
+                break;
+            default:
+                fprintf(stderr, usage, argv[0]);
+                err = EINVAL;
+                break;
+        }
+        if (int_ptr) {
+            *int_ptr = atoi(optarg);
+            if (*int_ptr < 0) {
+                fprintf(stderr, "Error: option -%c requires a non-negative integer\n", opt);
+                err = EINVAL;
+            }
+        }
+    }
+    if (!err && (config.num_step == 0 || config.fan_out == 0)) {
+        fprintf(stderr, "Error: num_step and fan_out must be positive\n");
+        err = EINVAL;
+    }
+    if (!err) {
+        std::list<std::string> agent_list;
+        if (agent_name.size()) {
+            agent_list.push_back(agent_name);
+        }
+        else {
+            for (const auto &name : geopm::agent_factory().plugin_names()) {
+                agent_list.push_back(name);
+            }
+        }
+        std::cout << "# levels: " << config.num_level
+                  << " fan-out: " << config.fan_out
+                  << " signals: " << config.num_signal
+                  << " steps: " << config.num_step << std::endl;
+        std::cout << std::left << std::setw(24) << "agent"
+                  << std::right << std::setw(14) << "ns/step"
+                  << std::setw(14) << "alloc/step"
+                  << std::setw(14) << "miss/step" << std::endl;
+        for (const auto &name : agent_list) {
+            std::cout << std::left << std::setw(24) << name << std::right;
+            if (bench_agent_map().find(name) == bench_agent_map().end()) {
+                std::cout << "  skipped: agent does not accept an injected platform" << std::endl;
+            }
+            else {
+                // Agents that do not support the simulated tree are
+                // reported without stopping the other measurements.
+                try {
+                    bench_result_s result = run_bench(name, config);
+                    std::cout << std::fixed << std::setprecision(1)
+                              << std::setw(14) << result.ns_per_step
+                              << std::setw(14) << result.alloc_per_step
+                              << std::setw(14) << result.miss_per_step << std::endl;
+                }
+                catch (const std::exception &ex) {
+                    std::cout << "  error: " << ex.what() << std::endl;
+                }
+            }
+        }
+    }
+    return err;
+}